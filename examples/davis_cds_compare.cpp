@@ -0,0 +1,151 @@
+#include <libcaercpp/devices/davis.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <vector>
+
+using namespace std;
+
+static atomic_bool replayDone(false);
+
+static void usbShutdownHandler(void *ptr) {
+	(void) (ptr); // UNUSED.
+
+	// End of the recording.
+	replayDone.store(true);
+}
+
+struct frameCopy {
+	int64_t tsStartOfFrame;
+	int32_t positionX;
+	int32_t positionY;
+	int32_t lengthX;
+	int32_t lengthY;
+	vector<uint16_t> pixels;
+};
+
+// Replay the whole capture file and keep a copy of all frames decoded from it.
+static bool replayFrames(const char *filePath, bool deferredCDS, vector<frameCopy> &frames) {
+	// Replay as fast as possible, timing doesn't change the decoded frames.
+	libcaer::devices::usb::replaySet(filePath, false);
+
+	libcaer::devices::davis davisHandle = libcaer::devices::davis(1);
+
+	davisHandle.sendDefaultConfig();
+
+	davisHandle.configSet(DAVIS_CONFIG_APS, DAVIS_CONFIG_APS_DEFERRED_CDS, deferredCDS);
+
+	// Coalesce instead of dropping, so that all recorded frames are delivered.
+	davisHandle.configSet(CAER_HOST_CONFIG_DATAEXCHANGE, CAER_HOST_CONFIG_DATAEXCHANGE_OVERFLOW_POLICY,
+		CAER_DATAEXCHANGE_OVERFLOW_COALESCE);
+
+	replayDone.store(false);
+
+	davisHandle.dataStart(nullptr, nullptr, nullptr, &usbShutdownHandler, nullptr);
+
+	davisHandle.configSet(CAER_HOST_CONFIG_DATAEXCHANGE, CAER_HOST_CONFIG_DATAEXCHANGE_BLOCKING, true);
+
+	while (true) {
+		// Check before getting data, so that everything queued before the end
+		// of the recording is still fetched.
+		bool done = replayDone.load(memory_order_relaxed);
+
+		std::unique_ptr<libcaer::events::EventPacketContainer> packetContainer = davisHandle.dataGet();
+		if (packetContainer == nullptr) {
+			if (done) {
+				break;
+			}
+
+			continue;
+		}
+
+		std::shared_ptr<const libcaer::events::EventPacket> packet
+			= packetContainer->findEventPacketByType(FRAME_EVENT);
+		if (packet == nullptr) {
+			continue;
+		}
+
+		std::shared_ptr<const libcaer::events::FrameEventPacket> framePacket
+			= std::static_pointer_cast<const libcaer::events::FrameEventPacket>(packet);
+
+		for (const auto &frame : *framePacket) {
+			if (!frame.isValid()) {
+				continue;
+			}
+
+			frameCopy copy;
+
+			copy.tsStartOfFrame = frame.getTSStartOfFrame64(*framePacket);
+			copy.positionX      = frame.getPositionX();
+			copy.positionY      = frame.getPositionY();
+			copy.lengthX        = frame.getLengthX();
+			copy.lengthY        = frame.getLengthY();
+
+			copy.pixels.resize(frame.getPixelsMaxIndex());
+			memcpy(copy.pixels.data(), frame.getPixelArrayUnsafe(), frame.getPixelsSize());
+
+			frames.push_back(std::move(copy));
+		}
+	}
+
+	uint64_t dropped
+		= davisHandle.configGet64(CAER_HOST_CONFIG_DATAEXCHANGE, CAER_HOST_CONFIG_DATAEXCHANGE_DROPPED_NEWEST);
+
+	davisHandle.dataStop();
+
+	// Close automatically done by destructor.
+
+	return (dropped == 0);
+}
+
+int main(int argc, char *argv[]) {
+	if (argc != 2) {
+		printf("Usage: %s <capture file>\n", argv[0]);
+		printf("Record a capture file from a DAVIS by running any program with CAER_USB_CAPTURE=<capture file> set,\n");
+		printf("or generate a synthetic one with usb_capture_generate davis346 or davis640h.\n");
+		printf("Compares frames decoded with per-pixel and with deferred CDS, which must be identical.\n");
+		return (EXIT_FAILURE);
+	}
+
+	caerLogLevelSet(CAER_LOG_WARNING);
+
+	vector<frameCopy> inlineFrames;
+	vector<frameCopy> deferredFrames;
+
+	if (!replayFrames(argv[1], false, inlineFrames) || !replayFrames(argv[1], true, deferredFrames)) {
+		printf("Data was dropped during replay, cannot compare.\n");
+		return (EXIT_FAILURE);
+	}
+
+	// Data still uncommitted at the end of the recording is never delivered, and
+	// when that happens depends on timing, so the last frames may be missing.
+	size_t framesNumber = min(inlineFrames.size(), deferredFrames.size());
+
+	if (framesNumber == 0) {
+		printf("No frames in the recording.\n");
+		return (EXIT_FAILURE);
+	}
+
+	size_t differentFrames = 0;
+
+	for (size_t i = 0; i < framesNumber; i++) {
+		const frameCopy &a = inlineFrames[i];
+		const frameCopy &b = deferredFrames[i];
+
+		if ((a.tsStartOfFrame != b.tsStartOfFrame) || (a.positionX != b.positionX) || (a.positionY != b.positionY)
+			|| (a.lengthX != b.lengthX) || (a.lengthY != b.lengthY) || (a.pixels != b.pixels)) {
+			if (differentFrames == 0) {
+				printf("First difference in frame %zu (ts=%" PRIi64 ", %" PRIi32 "x%" PRIi32 ").\n", i,
+					a.tsStartOfFrame, a.lengthX, a.lengthY);
+			}
+
+			differentFrames++;
+		}
+	}
+
+	printf("%zu frames compared (%zu per-pixel, %zu deferred), %zu different.\n", framesNumber, inlineFrames.size(),
+		deferredFrames.size(), differentFrames);
+
+	return ((differentFrames == 0) ? (EXIT_SUCCESS) : (EXIT_FAILURE));
+}
@@ -0,0 +1,225 @@
+#include <libcaer/filters/dvs_noise.h>
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+
+using namespace std;
+
+// DVXplorer resolution.
+#define SIZE_X 640
+#define SIZE_Y 480
+
+#define EVENTS_PER_PACKET (1024 * 1024)
+#define REPEATS           20
+
+// Hot pixel addresses only need to be distinct and spread over the array.
+// 7919 is prime and thus coprime with the number of pixels.
+static inline size_t hotPixelIndex(size_t idx) {
+	return ((idx * 7919) % (SIZE_X * SIZE_Y));
+}
+
+static void polarityEventAdd(caerPolarityEventPacket packet, int32_t idx, size_t pixel, int32_t ts, bool pol) {
+	caerPolarityEvent event = caerPolarityEventPacketGetEvent(packet, idx);
+
+	caerPolarityEventSetX(event, static_cast<uint16_t>(pixel % SIZE_X));
+	caerPolarityEventSetY(event, static_cast<uint16_t>(pixel / SIZE_X));
+	caerPolarityEventSetTimestamp(event, ts);
+	caerPolarityEventSetPolarity(event, pol);
+	caerPolarityEventValidate(event, packet);
+}
+
+// Learn exactly 'hotPixels' hot pixels: each fires twice with the count
+// threshold at two. Two more events on different pixels, one at the start
+// and one after the learning time, make sure learning always completes.
+static bool hotPixelsLearn(caerFilterDVSNoise noiseFilter, size_t hotPixels) {
+	caerPolarityEventPacket learnPacket
+		= caerPolarityEventPacketAllocate(static_cast<int32_t>((hotPixels * 2) + 2), 1, 0);
+	if (learnPacket == nullptr) {
+		return (false);
+	}
+
+	int32_t idx = 0;
+
+	polarityEventAdd(learnPacket, idx++, hotPixelIndex(hotPixels), 0, true);
+
+	for (size_t i = 0; i < hotPixels; i++) {
+		polarityEventAdd(learnPacket, idx++, hotPixelIndex(i), 0, true);
+		polarityEventAdd(learnPacket, idx++, hotPixelIndex(i), 0, false);
+	}
+
+	polarityEventAdd(learnPacket, idx++, hotPixelIndex(hotPixels + 1), 2000, true);
+
+	caerFilterDVSNoiseConfigSet(noiseFilter, CAER_FILTER_DVS_RESET, true);
+	caerFilterDVSNoiseConfigSet(noiseFilter, CAER_FILTER_DVS_HOTPIXEL_TIME, 1000);
+	caerFilterDVSNoiseConfigSet(noiseFilter, CAER_FILTER_DVS_HOTPIXEL_COUNT, 2);
+	caerFilterDVSNoiseConfigSet(noiseFilter, CAER_FILTER_DVS_HOTPIXEL_LEARN, true);
+
+	caerFilterDVSNoiseApply(noiseFilter, learnPacket);
+
+	free(learnPacket);
+
+	caerFilterDVSPixel hotPixelsArray;
+	ssize_t hotPixelsLearned = caerFilterDVSNoiseGetHotPixels(noiseFilter, &hotPixelsArray);
+	free(hotPixelsArray);
+
+	return (hotPixelsLearned == static_cast<ssize_t>(hotPixels));
+}
+
+int main(void) {
+	caerLogLevelSet(CAER_LOG_WARNING);
+
+	caerFilterDVSNoise noiseFilter = caerFilterDVSNoiseInitialize(SIZE_X, SIZE_Y);
+	if (noiseFilter == nullptr) {
+		return (EXIT_FAILURE);
+	}
+
+	// Random events over the whole array, with increasing timestamps.
+	caerPolarityEventPacket packet = caerPolarityEventPacketAllocate(EVENTS_PER_PACKET, 1, 0);
+	if (packet == nullptr) {
+		caerFilterDVSNoiseDestroy(noiseFilter);
+		return (EXIT_FAILURE);
+	}
+
+	mt19937 generator(42);
+	uniform_int_distribution<size_t> pixelDistribution(0, (SIZE_X * SIZE_Y) - 1);
+
+	for (int32_t i = 0; i < EVENTS_PER_PACKET; i++) {
+		polarityEventAdd(packet, i, pixelDistribution(generator), i, (i & 0x01));
+	}
+
+	printf("Hot Pixel filter on %d random events at %dx%d, %d repeats.\n", EVENTS_PER_PACKET, SIZE_X, SIZE_Y, REPEATS);
+
+	const size_t hotPixelsCounts[] = {0, 16, 256, 1024, 4096};
+
+	for (size_t hotPixels : hotPixelsCounts) {
+		if (!hotPixelsLearn(noiseFilter, hotPixels)) {
+			printf("%zu hot pixels: learning failed!\n", hotPixels);
+			continue;
+		}
+
+		caerFilterDVSNoiseConfigSet(noiseFilter, CAER_FILTER_DVS_HOTPIXEL_ENABLE, true);
+
+		auto start = chrono::steady_clock::now();
+
+		for (size_t r = 0; r < REPEATS; r++) {
+			// Statistics-only mode doesn't modify the packet, so it can be reused.
+			caerFilterDVSNoiseStatsApply(noiseFilter, packet);
+		}
+
+		auto end = chrono::steady_clock::now();
+
+		caerFilterDVSNoiseConfigSet(noiseFilter, CAER_FILTER_DVS_HOTPIXEL_ENABLE, false);
+
+		uint64_t filtered = 0;
+		caerFilterDVSNoiseConfigGet(noiseFilter, CAER_FILTER_DVS_HOTPIXEL_STATISTICS, &filtered);
+
+		double seconds = chrono::duration<double>(end - start).count();
+
+		printf("%zu hot pixels: %.2f ns/event, %" PRIu64 " events filtered.\n", hotPixels,
+			(seconds * 1e9) / (static_cast<double>(EVENTS_PER_PACKET) * REPEATS), filtered);
+	}
+
+	caerFilterDVSNoiseConfigSet(noiseFilter, CAER_FILTER_DVS_RESET, true);
+
+	printf("Hot Pixel filter, continuous learning.\n");
+
+	// Each repeat is a full window later, so each evaluates as many rows as it can.
+	caerFilterDVSNoiseConfigSet(noiseFilter, CAER_FILTER_DVS_HOTPIXEL_TIME, 1000);
+	caerFilterDVSNoiseConfigSet(noiseFilter, CAER_FILTER_DVS_HOTPIXEL_COUNT, 10);
+	caerFilterDVSNoiseConfigSet(noiseFilter, CAER_FILTER_DVS_HOTPIXEL_ENABLE, true);
+
+	if (caerFilterDVSNoiseConfigSet(noiseFilter, CAER_FILTER_DVS_HOTPIXEL_CONTINUOUS, true)) {
+		auto start = chrono::steady_clock::now();
+
+		for (size_t r = 0; r < REPEATS; r++) {
+			// Later timestamps on each repeat, so that learning sees time going on.
+			caerEventPacketHeaderSetEventTSOverflow(&packet->packetHeader, static_cast<int32_t>(r));
+
+			caerFilterDVSNoiseStatsApply(noiseFilter, packet);
+		}
+
+		auto end = chrono::steady_clock::now();
+
+		caerFilterDVSPixel hotPixelsArray;
+		ssize_t hotPixelsLearned = caerFilterDVSNoiseGetHotPixels(noiseFilter, &hotPixelsArray);
+		free(hotPixelsArray);
+
+		double seconds = chrono::duration<double>(end - start).count();
+
+		printf("Continuous: %.2f ns/event, %zd hot pixels.\n",
+			(seconds * 1e9) / (static_cast<double>(EVENTS_PER_PACKET) * REPEATS), hotPixelsLearned);
+
+		caerFilterDVSNoiseConfigSet(noiseFilter, CAER_FILTER_DVS_HOTPIXEL_CONTINUOUS, false);
+		caerEventPacketHeaderSetEventTSOverflow(&packet->packetHeader, 0);
+	}
+
+	caerFilterDVSNoiseConfigSet(noiseFilter, CAER_FILTER_DVS_HOTPIXEL_ENABLE, false);
+	caerFilterDVSNoiseConfigSet(noiseFilter, CAER_FILTER_DVS_RESET, true);
+
+	printf("Background-Activity and Refractory Period filters, 64 and 32 bit timestamps map.\n");
+
+	caerFilterDVSNoiseConfigSet(noiseFilter, CAER_FILTER_DVS_BACKGROUND_ACTIVITY_ENABLE, true);
+	caerFilterDVSNoiseConfigSet(noiseFilter, CAER_FILTER_DVS_REFRACTORY_PERIOD_ENABLE, true);
+
+	for (bool compact : {false, true}) {
+		caerFilterDVSNoiseConfigSet(noiseFilter, CAER_FILTER_DVS_TIMESTAMPS_COMPACT, compact);
+
+		auto start = chrono::steady_clock::now();
+
+		for (size_t r = 0; r < REPEATS; r++) {
+			caerFilterDVSNoiseStatsApply(noiseFilter, packet);
+		}
+
+		auto end = chrono::steady_clock::now();
+
+		uint64_t filteredBA = 0;
+		caerFilterDVSNoiseConfigGet(noiseFilter, CAER_FILTER_DVS_BACKGROUND_ACTIVITY_STATISTICS, &filteredBA);
+
+		uint64_t filteredRP = 0;
+		caerFilterDVSNoiseConfigGet(noiseFilter, CAER_FILTER_DVS_REFRACTORY_PERIOD_STATISTICS, &filteredRP);
+
+		double seconds = chrono::duration<double>(end - start).count();
+
+		printf("%s: %.2f ns/event, %" PRIu64 " + %" PRIu64 " events filtered.\n", (compact) ? ("32 bit") : ("64 bit"),
+			(seconds * 1e9) / (static_cast<double>(EVENTS_PER_PACKET) * REPEATS), filteredBA, filteredRP);
+
+		// Same starting state for the next run.
+		caerFilterDVSNoiseConfigSet(noiseFilter, CAER_FILTER_DVS_RESET, true);
+	}
+
+	caerFilterDVSNoiseConfigSet(noiseFilter, CAER_FILTER_DVS_TIMESTAMPS_COMPACT, false);
+
+	printf("Background-Activity and Refractory Period filters, parallel filtering.\n");
+
+	for (uint32_t threads : {1, 2, 4, 8}) {
+		caerFilterDVSNoiseConfigSet(noiseFilter, CAER_FILTER_DVS_PARALLEL_THREADS, threads);
+
+		auto start = chrono::steady_clock::now();
+
+		for (size_t r = 0; r < REPEATS; r++) {
+			caerFilterDVSNoiseStatsApply(noiseFilter, packet);
+		}
+
+		auto end = chrono::steady_clock::now();
+
+		uint64_t filteredBA = 0;
+		caerFilterDVSNoiseConfigGet(noiseFilter, CAER_FILTER_DVS_BACKGROUND_ACTIVITY_STATISTICS, &filteredBA);
+
+		uint64_t filteredRP = 0;
+		caerFilterDVSNoiseConfigGet(noiseFilter, CAER_FILTER_DVS_REFRACTORY_PERIOD_STATISTICS, &filteredRP);
+
+		double seconds = chrono::duration<double>(end - start).count();
+
+		printf("%" PRIu32 " threads: %.2f ns/event, %" PRIu64 " + %" PRIu64 " events filtered.\n", threads,
+			(seconds * 1e9) / (static_cast<double>(EVENTS_PER_PACKET) * REPEATS), filteredBA, filteredRP);
+
+		caerFilterDVSNoiseConfigSet(noiseFilter, CAER_FILTER_DVS_RESET, true);
+	}
+
+	free(packet);
+
+	caerFilterDVSNoiseDestroy(noiseFilter);
+
+	return (EXIT_SUCCESS);
+}
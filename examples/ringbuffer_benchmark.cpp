@@ -0,0 +1,137 @@
+#include <libcaer/ringbuffer.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+#define RINGBUFFER_SIZE   64
+#define ELEMENTS_TOTAL    (16 * 1024 * 1024)
+#define ELEMENTS_PER_CALL 16
+
+// Elements only need to be non-NULL and unique, they are never dereferenced.
+static inline void *elementFromIndex(size_t idx) {
+	return (reinterpret_cast<void *>(idx + 1));
+}
+
+static double benchmarkSingle(void) {
+	caerRingBuffer rBuf = caerRingBufferInit(RINGBUFFER_SIZE);
+	if (rBuf == nullptr) {
+		return (0);
+	}
+
+	auto start = chrono::steady_clock::now();
+
+	thread producer([rBuf]() {
+		for (size_t i = 0; i < ELEMENTS_TOTAL;) {
+			if (caerRingBufferPut(rBuf, elementFromIndex(i))) {
+				i++;
+			}
+			else {
+				this_thread::yield();
+			}
+		}
+	});
+
+	size_t errors = 0;
+
+	for (size_t i = 0; i < ELEMENTS_TOTAL;) {
+		void *elem = caerRingBufferGet(rBuf);
+		if (elem != nullptr) {
+			if (elem != elementFromIndex(i)) {
+				errors++;
+			}
+
+			i++;
+		}
+		else {
+			this_thread::yield();
+		}
+	}
+
+	producer.join();
+
+	auto end = chrono::steady_clock::now();
+
+	caerRingBufferFree(rBuf);
+
+	if (errors > 0) {
+		printf("Single: %zu elements out of order!\n", errors);
+	}
+
+	return (chrono::duration<double>(end - start).count());
+}
+
+static double benchmarkMany(void) {
+	caerRingBuffer rBuf = caerRingBufferInit(RINGBUFFER_SIZE);
+	if (rBuf == nullptr) {
+		return (0);
+	}
+
+	auto start = chrono::steady_clock::now();
+
+	thread producer([rBuf]() {
+		void *elems[ELEMENTS_PER_CALL];
+
+		for (size_t i = 0; i < ELEMENTS_TOTAL;) {
+			size_t num = ((ELEMENTS_TOTAL - i) < ELEMENTS_PER_CALL) ? (ELEMENTS_TOTAL - i) : (ELEMENTS_PER_CALL);
+
+			for (size_t j = 0; j < num; j++) {
+				elems[j] = elementFromIndex(i + j);
+			}
+
+			size_t put = caerRingBufferPutMany(rBuf, elems, num);
+			if (put == 0) {
+				this_thread::yield();
+			}
+
+			i += put;
+		}
+	});
+
+	void *elems[ELEMENTS_PER_CALL];
+	size_t errors = 0;
+
+	for (size_t i = 0; i < ELEMENTS_TOTAL;) {
+		size_t num = caerRingBufferGetMany(rBuf, elems, ELEMENTS_PER_CALL);
+		if (num == 0) {
+			this_thread::yield();
+		}
+
+		for (size_t j = 0; j < num; j++) {
+			if (elems[j] != elementFromIndex(i + j)) {
+				errors++;
+			}
+		}
+
+		i += num;
+	}
+
+	producer.join();
+
+	auto end = chrono::steady_clock::now();
+
+	caerRingBufferFree(rBuf);
+
+	if (errors > 0) {
+		printf("Many: %zu elements out of order!\n", errors);
+	}
+
+	return (chrono::duration<double>(end - start).count());
+}
+
+int main(void) {
+	printf("Moving %d elements through a ring-buffer of size %d.\n", ELEMENTS_TOTAL, RINGBUFFER_SIZE);
+
+	double single = benchmarkSingle();
+	printf("caerRingBufferPut/Get: %.3f s, %.1f ns/element.\n", single, (single * 1e9) / ELEMENTS_TOTAL);
+
+	double many = benchmarkMany();
+	printf("caerRingBufferPutMany/GetMany (%d per call): %.3f s, %.1f ns/element.\n", ELEMENTS_PER_CALL, many,
+		(many * 1e9) / ELEMENTS_TOTAL);
+
+	return (EXIT_SUCCESS);
+}
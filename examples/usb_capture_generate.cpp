@@ -0,0 +1,508 @@
+#include <libcaer/devices/davis.h>
+#include <libcaer/devices/dvxplorer.h>
+#include <libcaer/devices/samsung_evk.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+// Capture file layout, same as written with CAER_USB_CAPTURE set (see src/usb_capture.h).
+// All values in host byte order.
+#define CAPTURE_MAGIC            "CAERUSB1"
+#define CAPTURE_MAGIC_LENGTH     8
+#define MAX_SERIAL_NUMBER_LENGTH 8
+
+enum { CAPTURE_INFO = 0, CAPTURE_CONTROL_IN = 1, CAPTURE_DATA = 2 };
+
+struct captureRecord {
+	uint64_t timestamp;
+	uint32_t length;
+	uint16_t wValue;
+	uint16_t wIndex;
+	uint8_t type;
+	uint8_t bRequest;
+	uint16_t reserved1;
+	uint32_t reserved2;
+};
+
+struct captureInfo {
+	uint16_t devVID;
+	uint16_t devPID;
+	int16_t firmwareVersion;
+	int16_t logicVersion;
+	uint8_t busNumber;
+	uint8_t devAddress;
+	char serialNumber[MAX_SERIAL_NUMBER_LENGTH + 1];
+};
+
+// Device USB IDs and vendor requests, see src/usb_utils.h and the device headers.
+#define USB_DEFAULT_DEVICE_VID     0x152A
+#define DVXPLORER_DEVICE_PID       0x8419
+#define DAVIS_FX3_DEVICE_PID       0x841A
+#define SAMSUNG_EVK_DEVICE_VID     0x04B4
+#define SAMSUNG_EVK_DEVICE_PID     0x00F1
+#define VENDOR_REQUEST_FPGA_CONFIG 0xBF
+#define VENDOR_REQUEST_I2C_READ    0xBB
+
+// Size of each recorded data transfer, same as the devices' default.
+#define TRANSFER_SIZE 8192
+
+class captureWriter {
+private:
+	FILE *file;
+	vector<uint8_t> data;
+	uint64_t dataTimestamp;
+
+	void writeRecord(uint8_t type, uint8_t bRequest, uint16_t wValue, uint16_t wIndex, uint64_t timestamp,
+		const void *payload, size_t payloadSize) {
+		struct captureRecord record;
+		memset(&record, 0, sizeof(record));
+
+		record.timestamp = timestamp;
+		record.length    = static_cast<uint32_t>(payloadSize);
+		record.wValue    = wValue;
+		record.wIndex    = wIndex;
+		record.type      = type;
+		record.bRequest  = bRequest;
+
+		fwrite(&record, sizeof(record), 1, file);
+		fwrite(payload, payloadSize, 1, file);
+	}
+
+public:
+	captureWriter(FILE *f, uint16_t devVID, uint16_t devPID) : file(f), dataTimestamp(0) {
+		fwrite(CAPTURE_MAGIC, CAPTURE_MAGIC_LENGTH, 1, file);
+
+		struct captureInfo info;
+		memset(&info, 0, sizeof(info));
+
+		info.devVID = devVID;
+		info.devPID = devPID;
+		strcpy(info.serialNumber, "SYNTH001");
+
+		writeRecord(CAPTURE_INFO, 0, 0, 0, 0, &info, sizeof(info));
+	}
+
+	// Reply to spiConfigReceive(): 32 bit value, big-endian.
+	void configReply(uint16_t moduleAddr, uint16_t paramAddr, uint32_t value) {
+		uint8_t reply[4] = {static_cast<uint8_t>(value >> 24), static_cast<uint8_t>(value >> 16),
+			static_cast<uint8_t>(value >> 8), static_cast<uint8_t>(value)};
+
+		writeRecord(CAPTURE_CONTROL_IN, VENDOR_REQUEST_FPGA_CONFIG, moduleAddr, paramAddr, 0, reply, sizeof(reply));
+	}
+
+	// Reply to i2cConfigReceive(): one byte.
+	void i2cReply(uint16_t deviceAddr, uint16_t byteAddr, uint8_t value) {
+		writeRecord(CAPTURE_CONTROL_IN, VENDOR_REQUEST_I2C_READ, deviceAddr, byteAddr, 0, &value, sizeof(value));
+	}
+
+	// Append one 16 bit little-endian event word to the data stream. Full
+	// transfers are recorded as arriving at the device time 'timestamp' (µs).
+	void event16(uint16_t event, int64_t timestamp) {
+		data.push_back(static_cast<uint8_t>(event));
+		data.push_back(static_cast<uint8_t>(event >> 8));
+
+		dataTimestamp = static_cast<uint64_t>(timestamp) * 1000;
+
+		if (data.size() >= TRANSFER_SIZE) {
+			flush();
+		}
+	}
+
+	// Append one 32 bit big-endian event word, same as event16() otherwise.
+	void event32(uint32_t event, int64_t timestamp) {
+		data.push_back(static_cast<uint8_t>(event >> 24));
+		data.push_back(static_cast<uint8_t>(event >> 16));
+		data.push_back(static_cast<uint8_t>(event >> 8));
+		data.push_back(static_cast<uint8_t>(event));
+
+		dataTimestamp = static_cast<uint64_t>(timestamp) * 1000;
+
+		if (data.size() >= TRANSFER_SIZE) {
+			flush();
+		}
+	}
+
+	void flush() {
+		if (!data.empty()) {
+			writeRecord(CAPTURE_DATA, 0, 0, 0, dataTimestamp, data.data(), data.size());
+			data.clear();
+		}
+	}
+
+	size_t written() {
+		return (static_cast<size_t>(ftell(file)) + data.size());
+	}
+};
+
+// DVXplorer in its default MGROUP format: each readout is a timestamp, and
+// then per active column its address, followed by pairs of 8-pixel groups,
+// each pair an address event plus one group event per group.
+static void generateDVXplorer(captureWriter &capture, size_t bytes, mt19937 &rng) {
+	capture.configReply(DVX_SYSINFO, DVX_SYSINFO_CHIP_IDENTIFIER, DVXPLORER_CHIP_ID);
+	capture.configReply(DVX_SYSINFO, DVX_SYSINFO_DEVICE_IS_MASTER, 1);
+	capture.configReply(DVX_SYSINFO, DVX_SYSINFO_LOGIC_CLOCK, 104);
+	capture.configReply(DVX_SYSINFO, DVX_SYSINFO_USB_CLOCK, 100);
+	capture.configReply(DVX_SYSINFO, DVX_SYSINFO_CLOCK_DEVIATION, 1000);
+	capture.configReply(DVX_DVS, DVX_DVS_SIZE_COLUMNS, 640);
+	capture.configReply(DVX_DVS, DVX_DVS_SIZE_ROWS, 480);
+	capture.configReply(DVX_DVS, DVX_DVS_ORIENTATION_INFO, 0);
+	capture.configReply(DVX_DVS, DVX_DVS_HAS_STATISTICS, 1);
+	capture.configReply(DVX_IMU, DVX_IMU_TYPE, 0);
+	capture.configReply(DVX_IMU, DVX_IMU_ORIENTATION_INFO, 0);
+	capture.configReply(DVX_MUX, DVX_MUX_HAS_STATISTICS, 1);
+	capture.configReply(DVX_EXTINPUT, DVX_EXTINPUT_HAS_GENERATOR, 1);
+
+	// Chip registers read back by the default configuration (DEVICE_DVS, see
+	// src/dvxplorer.h): packet format (MGROUP), digital enable, subsample
+	// ratio and mode control. Their values don't matter, only writes follow.
+	capture.configReply(5, 0x3067, 0x00);
+	capture.configReply(5, 0x3200, 0x00);
+	capture.configReply(5, 0x3204, 0x00);
+	capture.configReply(5, 0x3255, 0x00);
+
+	const uint16_t columns = 640;
+	const uint16_t groups  = 480 / 8;
+
+	int64_t timestamp = 0;
+	int64_t wrapBase  = 0;
+
+	while (capture.written() < bytes) {
+		timestamp += 1 + static_cast<int64_t>(rng() % 32);
+
+		// Timestamps are 15 bit, each wrap event adds 2^15 µs and
+		// is itself the timestamp at the wrap point.
+		while ((timestamp - wrapBase) >= 0x8000) {
+			wrapBase += 0x8000;
+			capture.event16(0x7001, timestamp);
+		}
+
+		if (timestamp == wrapBase) {
+			timestamp++;
+		}
+
+		capture.event16(static_cast<uint16_t>(0x8000 | (timestamp - wrapBase)), timestamp);
+
+		// Columns in readout order, the first one marks the start of the readout.
+		uint16_t activeColumns = static_cast<uint16_t>(1 + (rng() % 16));
+		uint16_t column        = static_cast<uint16_t>(rng() % (columns / 2));
+
+		for (uint16_t c = 0; (c < activeColumns) && (column < columns); c++) {
+			capture.event16(static_cast<uint16_t>(0x1000 | ((c == 0) ? (0x0800) : (0)) | column), timestamp);
+
+			uint16_t activePairs = static_cast<uint16_t>(1 + (rng() % 4));
+
+			for (uint16_t p = 0; p < activePairs; p++) {
+				// Group 2 is addressed relative to group 1, at most 31 groups away.
+				int32_t group1 = static_cast<int32_t>(rng() % groups);
+				int32_t group2 = group1 + static_cast<int32_t>(rng() % 63) - 31;
+
+				if ((group2 < 0) || (group2 >= groups)) {
+					group2 = group1;
+				}
+
+				uint16_t below  = (group2 < group1) ? (0x0800) : (0);
+				uint16_t offset = static_cast<uint16_t>(abs(group2 - group1));
+
+				capture.event16(static_cast<uint16_t>(0x4000 | below | (offset << 6) | group1), timestamp);
+
+				// Group events: bit 8 set is OFF polarity, the low 8 bits the active pixels.
+				uint16_t polarity = (rng() & 0x01) ? (0x0100) : (0);
+				capture.event16(static_cast<uint16_t>(0x3000 | polarity | (1 + (rng() % 255))), timestamp);
+				capture.event16(static_cast<uint16_t>(0x2000 | polarity | (1 + (rng() % 255))), timestamp);
+			}
+
+			column = static_cast<uint16_t>(column + 1 + (rng() % 8));
+		}
+	}
+
+	capture.flush();
+}
+
+// Samsung EVK in SGROUP format: a millisecond reference timestamp whenever it
+// changes, then per active column its address with the microseconds since
+// the reference, followed by its 8-pixel groups, each with an OFF and an ON
+// mask, so one group event can carry both polarities.
+static void generateSamsungEVK(captureWriter &capture, size_t bytes, mt19937 &rng) {
+	// Firmware version (DEVICE_FPGA), the only read at open, and the chip
+	// registers read back by the default configuration (DEVICE_DVS, see
+	// src/samsung_evk.h), same ones as on the DVXplorer.
+	capture.i2cReply(0x0040, 0xFF00, 1);
+	capture.i2cReply(0x0020, 0x3067, 0x00);
+	capture.i2cReply(0x0020, 0x3200, 0x00);
+	capture.i2cReply(0x0020, 0x3204, 0x00);
+	capture.i2cReply(0x0020, 0x3255, 0x00);
+
+	const uint32_t columns = 640;
+	const uint32_t groups  = 480 / 8;
+
+	int64_t timestamp = 1000;
+	int64_t reference = -1;
+
+	while (capture.written() < bytes) {
+		timestamp += 1 + static_cast<int64_t>(rng() % 32);
+
+		if ((timestamp / 1000) != reference) {
+			reference = timestamp / 1000;
+			capture.event32(0x08000000 | static_cast<uint32_t>(reference), timestamp);
+		}
+
+		uint32_t sub = static_cast<uint32_t>(timestamp % 1000);
+
+		// Columns in readout order, the first one marks the start of the readout.
+		uint32_t activeColumns = 1 + (rng() % 16);
+		uint32_t column        = rng() % (columns / 2);
+
+		for (uint32_t c = 0; (c < activeColumns) && (column < columns); c++) {
+			capture.event32(0x04000000 | ((c == 0) ? (0x00200000) : (0)) | (sub << 11) | column, timestamp);
+
+			uint32_t activeGroups = 1 + (rng() % 8);
+
+			for (uint32_t g = 0; g < activeGroups; g++) {
+				// OFF mask in bits 8-15, ON mask in bits 0-7, at least one pixel active.
+				uint32_t masks = 1 + (rng() % 0xFFFF);
+
+				capture.event32(0x80000000 | ((rng() % groups) << 18) | masks, timestamp);
+			}
+
+			column += 1 + (rng() % 8);
+		}
+	}
+
+	capture.flush();
+}
+
+// DAVIS on FX3: DVS events around APS frames, alternating between rolling
+// and global shutter. Frames contain the cases CDS has to handle: pixels
+// seen as overexposed (signal 0, or reset below 384), out of range samples,
+// and columns whose second readout ends early, so some pixels never get
+// their second sample. On the DAVIS640H, global shutter reads the signal
+// first; its APS is inverted, so columns are read along the 640 pixels.
+static void generateDAVIS(captureWriter &capture, size_t bytes, mt19937 &rng, bool davis640H) {
+	const uint16_t dvsSizeX = (davis640H) ? (640) : (346);
+	const uint16_t dvsSizeY = (davis640H) ? (480) : (260);
+
+	// APS size and orientation as seen by the chip, the frames are 640x480 and 346x260.
+	const uint16_t apsColumns     = (davis640H) ? (480) : (346);
+	const uint16_t apsRows        = (davis640H) ? (640) : (260);
+	const uint32_t apsOrientation = (davis640H) ? (0x04) : (0x03); // Invert XY, or flip X and Y.
+
+	capture.configReply(DAVIS_CONFIG_SYSINFO, DAVIS_CONFIG_SYSINFO_CHIP_IDENTIFIER,
+		(davis640H) ? (DAVIS_CHIP_DAVIS640H) : (DAVIS_CHIP_DAVIS346B));
+	capture.configReply(DAVIS_CONFIG_SYSINFO, DAVIS_CONFIG_SYSINFO_DEVICE_IS_MASTER, 1);
+	capture.configReply(DAVIS_CONFIG_SYSINFO, DAVIS_CONFIG_SYSINFO_LOGIC_CLOCK, 104);
+	capture.configReply(DAVIS_CONFIG_SYSINFO, DAVIS_CONFIG_SYSINFO_ADC_CLOCK, 104);
+	capture.configReply(DAVIS_CONFIG_SYSINFO, DAVIS_CONFIG_SYSINFO_USB_CLOCK, 80);
+	capture.configReply(DAVIS_CONFIG_SYSINFO, DAVIS_CONFIG_SYSINFO_CLOCK_DEVIATION, 1000);
+	capture.configReply(DAVIS_CONFIG_DVS, DAVIS_CONFIG_DVS_HAS_PIXEL_FILTER, 0);
+	capture.configReply(DAVIS_CONFIG_DVS, DAVIS_CONFIG_DVS_HAS_BACKGROUND_ACTIVITY_FILTER, 0);
+	capture.configReply(DAVIS_CONFIG_DVS, DAVIS_CONFIG_DVS_HAS_ROI_FILTER, 0);
+	capture.configReply(DAVIS_CONFIG_DVS, DAVIS_CONFIG_DVS_HAS_SKIP_FILTER, 0);
+	capture.configReply(DAVIS_CONFIG_DVS, DAVIS_CONFIG_DVS_HAS_POLARITY_FILTER, 0);
+	capture.configReply(DAVIS_CONFIG_DVS, DAVIS_CONFIG_DVS_HAS_STATISTICS, 0);
+	capture.configReply(DAVIS_CONFIG_DVS, DAVIS_CONFIG_DVS_SIZE_COLUMNS, dvsSizeX);
+	capture.configReply(DAVIS_CONFIG_DVS, DAVIS_CONFIG_DVS_SIZE_ROWS, dvsSizeY);
+	capture.configReply(DAVIS_CONFIG_DVS, DAVIS_CONFIG_DVS_ORIENTATION_INFO, 0);
+	capture.configReply(DAVIS_CONFIG_APS, DAVIS_CONFIG_APS_COLOR_FILTER, MONO);
+	capture.configReply(DAVIS_CONFIG_APS, DAVIS_CONFIG_APS_HAS_GLOBAL_SHUTTER, 1);
+	capture.configReply(DAVIS_CONFIG_APS, DAVIS_CONFIG_APS_SIZE_COLUMNS, apsColumns);
+	capture.configReply(DAVIS_CONFIG_APS, DAVIS_CONFIG_APS_SIZE_ROWS, apsRows);
+	capture.configReply(DAVIS_CONFIG_APS, DAVIS_CONFIG_APS_ORIENTATION_INFO, apsOrientation);
+	capture.configReply(DAVIS_CONFIG_APS, DAVIS_CONFIG_APS_RUN, 0);
+	capture.configReply(DAVIS_CONFIG_EXTINPUT, DAVIS_CONFIG_EXTINPUT_HAS_GENERATOR, 0);
+	capture.configReply(DAVIS_CONFIG_MUX, DAVIS_CONFIG_MUX_HAS_STATISTICS, 0);
+	capture.configReply(DAVIS_CONFIG_IMU, DAVIS_CONFIG_IMU_TYPE, 0);
+	capture.configReply(DAVIS_CONFIG_IMU, DAVIS_CONFIG_IMU_ORIENTATION_INFO, 0);
+
+	int64_t timestamp = 0;
+	int64_t wrapBase  = 0;
+
+	// Timestamps are 15 bit, each wrap event adds 2^15 µs and is itself the
+	// timestamp at the wrap point, same as on the DVXplorer.
+	auto advance = [&](int64_t microseconds) {
+		timestamp += microseconds;
+
+		while ((timestamp - wrapBase) >= 0x8000) {
+			wrapBase += 0x8000;
+			capture.event16(0x7001, timestamp);
+		}
+
+		if (timestamp == wrapBase) {
+			timestamp++;
+		}
+
+		capture.event16(static_cast<uint16_t>(0x8000 | (timestamp - wrapBase)), timestamp);
+	};
+
+	// Y address, then one or more X addresses with their polarity on that row.
+	auto dvsEvents = [&](size_t number) {
+		for (size_t i = 0; i < number; i++) {
+			advance(1 + static_cast<int64_t>(rng() % 4));
+
+			capture.event16(static_cast<uint16_t>(0x1000 | (rng() % dvsSizeY)), timestamp);
+
+			uint32_t xNumber = 1 + (rng() % 4);
+
+			for (uint32_t x = 0; x < xNumber; x++) {
+				uint16_t polarity = (rng() & 0x01) ? (0x3000) : (0x2000);
+				capture.event16(static_cast<uint16_t>(polarity | (rng() % dvsSizeX)), timestamp);
+			}
+		}
+	};
+
+	auto apsSample = [&](uint16_t sample) {
+		capture.event16(static_cast<uint16_t>(0x4000 | (sample & 0x0FFF)), timestamp);
+	};
+
+	for (size_t frame = 0; capture.written() < bytes; frame++) {
+		dvsEvents(500 + (rng() % 1500));
+
+		bool globalShutter = ((frame % 2) == 1);
+
+		// Special events 8 and 9: global and rolling shutter frame start.
+		capture.event16((globalShutter) ? (0x0008) : (0x0009), timestamp);
+
+		// ROI in frame coordinates, a random window every few frames. The
+		// DAVIS640H readout order only covers whole columns, so it stays full.
+		uint16_t frameSizeX = (davis640H) ? (apsRows) : (apsColumns);
+		uint16_t frameSizeY = (davis640H) ? (apsColumns) : (apsRows);
+
+		uint16_t startX = 0;
+		uint16_t startY = 0;
+		uint16_t endX   = static_cast<uint16_t>(frameSizeX - 1);
+		uint16_t endY   = static_cast<uint16_t>(frameSizeY - 1);
+
+		if ((!davis640H) && ((frame % 3) == 2)) {
+			startX = static_cast<uint16_t>(rng() % (frameSizeX / 2));
+			startY = static_cast<uint16_t>(rng() % (frameSizeY / 2));
+			endX   = static_cast<uint16_t>(startX + (rng() % (frameSizeX - startX)));
+			endY   = static_cast<uint16_t>(startY + (rng() % (frameSizeY - startY)));
+		}
+
+		// Misc8 events 1 and 2: high and low byte of start column, start row, end column, end row.
+		for (uint16_t roiValue : {startX, startY, endX, endY}) {
+			capture.event16(static_cast<uint16_t>(0x5100 | (roiValue >> 8)), timestamp);
+			capture.event16(static_cast<uint16_t>(0x5200 | (roiValue & 0xFF)), timestamp);
+		}
+
+		// Special events 14 and 15: exposure start and end.
+		capture.event16(0x000E, timestamp);
+		dvsEvents(100 + (rng() % 400));
+		capture.event16(0x000F, timestamp);
+
+		// Readout columns run along the frame's X, or Y if inverted.
+		uint16_t columns = static_cast<uint16_t>((davis640H) ? (endY + 1 - startY) : (endX + 1 - startX));
+		uint16_t rows    = static_cast<uint16_t>((davis640H) ? (endX + 1 - startX) : (endY + 1 - startY));
+
+		// DAVIS640H global shutter reads the signal first, everything else the reset.
+		bool signalFirst = (davis640H && globalShutter);
+
+		vector<uint16_t> resetValues(rows);
+		vector<uint16_t> signalValues(rows);
+
+		for (uint16_t column = 0; column < columns; column++) {
+			advance(1);
+
+			for (uint16_t row = 0; row < rows; row++) {
+				uint32_t kind = rng() % 100;
+
+				if (kind == 0) {
+					// Overexposed, signal at 0.
+					resetValues[row]  = static_cast<uint16_t>(384 + (rng() % 640));
+					signalValues[row] = 0;
+				}
+				else if (kind == 1) {
+					// Reset never went back up.
+					resetValues[row]  = static_cast<uint16_t>(rng() % 384);
+					signalValues[row] = static_cast<uint16_t>(rng() % 1024);
+				}
+				else if (kind == 2) {
+					// Signal above reset, or out of the 10 bit range.
+					resetValues[row]  = static_cast<uint16_t>(384 + (rng() % 640));
+					signalValues[row] = static_cast<uint16_t>(resetValues[row] + (rng() % 3000));
+				}
+				else {
+					resetValues[row]  = static_cast<uint16_t>(384 + (rng() % 640));
+					signalValues[row] = static_cast<uint16_t>(rng() % (resetValues[row] + 1));
+				}
+			}
+
+			const vector<uint16_t> &first  = (signalFirst) ? (signalValues) : (resetValues);
+			const vector<uint16_t> &second = (signalFirst) ? (resetValues) : (signalValues);
+
+			// Special events 11, 12 and 13: reset column start, signal column start, column end.
+			capture.event16((signalFirst) ? (0x000C) : (0x000B), timestamp);
+			for (uint16_t row = 0; row < rows; row++) {
+				apsSample(first[row]);
+			}
+			capture.event16(0x000D, timestamp);
+
+			// Some second readouts end early, those pixels keep their first sample.
+			uint16_t secondRows = ((rng() % 50) == 0) ? (static_cast<uint16_t>(rng() % rows)) : (rows);
+
+			capture.event16((signalFirst) ? (0x000B) : (0x000C), timestamp);
+			for (uint16_t row = 0; row < secondRows; row++) {
+				apsSample(second[row]);
+			}
+			capture.event16(0x000D, timestamp);
+
+			if ((rng() % 8) == 0) {
+				dvsEvents(rng() % 16);
+			}
+		}
+
+		// Special event 10: frame end.
+		capture.event16(0x000A, timestamp);
+	}
+
+	capture.flush();
+}
+
+int main(int argc, char *argv[]) {
+	if ((argc != 3) && (argc != 4)) {
+		printf("Usage: %s <dvxplorer|samsung_evk|davis346|davis640h> <capture file> [size in MiB, default 256]\n",
+			argv[0]);
+		printf("Generates a reproducible synthetic capture, to replay with CAER_USB_REPLAY=<capture file> set,\n");
+		printf("for example with usb_replay_benchmark, or davis_cds_compare for the DAVIS ones.\n");
+		return (EXIT_FAILURE);
+	}
+
+	size_t bytes = ((argc == 4) ? (strtoul(argv[3], nullptr, 10)) : (256)) * 1024 * 1024;
+
+	FILE *file = fopen(argv[2], "wb");
+	if (file == nullptr) {
+		printf("Failed to open '%s' for writing.\n", argv[2]);
+		return (EXIT_FAILURE);
+	}
+
+	// Fixed seed, so that the same capture is generated everywhere.
+	mt19937 rng(42);
+
+	if (strcmp(argv[1], "dvxplorer") == 0) {
+		captureWriter capture(file, USB_DEFAULT_DEVICE_VID, DVXPLORER_DEVICE_PID);
+		generateDVXplorer(capture, bytes, rng);
+	}
+	else if (strcmp(argv[1], "samsung_evk") == 0) {
+		captureWriter capture(file, SAMSUNG_EVK_DEVICE_VID, SAMSUNG_EVK_DEVICE_PID);
+		generateSamsungEVK(capture, bytes, rng);
+	}
+	else if ((strcmp(argv[1], "davis346") == 0) || (strcmp(argv[1], "davis640h") == 0)) {
+		captureWriter capture(file, USB_DEFAULT_DEVICE_VID, DAVIS_FX3_DEVICE_PID);
+		generateDAVIS(capture, bytes, rng, (strcmp(argv[1], "davis640h") == 0));
+	}
+	else {
+		printf("Unknown device type '%s'.\n", argv[1]);
+		fclose(file);
+		return (EXIT_FAILURE);
+	}
+
+	fclose(file);
+
+	printf("Generated %zu MiB synthetic %s capture in '%s'.\n", bytes / (1024 * 1024), argv[1], argv[2]);
+
+	return (EXIT_SUCCESS);
+}
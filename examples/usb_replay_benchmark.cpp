@@ -0,0 +1,135 @@
+#include <libcaercpp/devices/davis.hpp>
+#include <libcaercpp/devices/dvxplorer.hpp>
+#include <libcaercpp/devices/samsung_evk.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstring>
+#include <memory>
+#include <sys/resource.h>
+
+using namespace std;
+
+static atomic_bool globalShutdown(false);
+
+static void globalShutdownSignalHandler(int signal) {
+	// Simply set the running flag to false on SIGTERM and SIGINT (CTRL+C) for global shutdown.
+	if (signal == SIGTERM || signal == SIGINT) {
+		globalShutdown.store(true);
+	}
+}
+
+static void usbShutdownHandler(void *ptr) {
+	(void) (ptr); // UNUSED.
+
+	// End of the recording.
+	globalShutdown.store(true);
+}
+
+// User plus system CPU time used by the whole process, all threads included.
+static double cpuTimeUsed(void) {
+	struct rusage usage;
+	getrusage(RUSAGE_SELF, &usage);
+
+	return (static_cast<double>(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec)
+			+ (static_cast<double>(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1e6));
+}
+
+static unique_ptr<libcaer::devices::usb> openDevice(const char *type) {
+	if (strcmp(type, "davis") == 0) {
+		return (unique_ptr<libcaer::devices::usb>(new libcaer::devices::davis(1)));
+	}
+	else if (strcmp(type, "dvxplorer") == 0) {
+		return (unique_ptr<libcaer::devices::usb>(new libcaer::devices::dvXplorer(1)));
+	}
+	else if (strcmp(type, "samsung_evk") == 0) {
+		return (unique_ptr<libcaer::devices::usb>(new libcaer::devices::samsungEVK(1)));
+	}
+
+	return (nullptr);
+}
+
+int main(int argc, char *argv[]) {
+	if (argc != 3) {
+		printf("Usage: %s <davis|dvxplorer|samsung_evk> <capture file>\n", argv[0]);
+		printf("Record a capture file by running any program with CAER_USB_CAPTURE=<capture file> set,\n");
+		printf("or generate a synthetic one with usb_capture_generate.\n");
+		return (EXIT_FAILURE);
+	}
+
+	struct sigaction shutdownAction;
+
+	shutdownAction.sa_handler = &globalShutdownSignalHandler;
+	shutdownAction.sa_flags   = 0;
+	sigemptyset(&shutdownAction.sa_mask);
+	sigaddset(&shutdownAction.sa_mask, SIGTERM);
+	sigaddset(&shutdownAction.sa_mask, SIGINT);
+
+	if (sigaction(SIGTERM, &shutdownAction, NULL) == -1) {
+		libcaer::log::log(libcaer::log::logLevel::CRITICAL, "ShutdownAction",
+			"Failed to set signal handler for SIGTERM. Error: %d.", errno);
+		return (EXIT_FAILURE);
+	}
+
+	if (sigaction(SIGINT, &shutdownAction, NULL) == -1) {
+		libcaer::log::log(libcaer::log::logLevel::CRITICAL, "ShutdownAction",
+			"Failed to set signal handler for SIGINT. Error: %d.", errno);
+		return (EXIT_FAILURE);
+	}
+
+	// Replay as fast as possible, so that the host-side decoding is the limit.
+	libcaer::devices::usb::replaySet(argv[2], false);
+
+	auto handle = openDevice(argv[1]);
+	if (handle == nullptr) {
+		printf("Unknown device type '%s'.\n", argv[1]);
+		return (EXIT_FAILURE);
+	}
+
+	printf("%s: replaying '%s'.\n", handle->toString().c_str(), argv[2]);
+
+	handle->sendDefaultConfig();
+
+	handle->configSet(CAER_HOST_CONFIG_STATISTICS, CAER_HOST_CONFIG_STATISTICS_RESET, true);
+
+	// Coalesce instead of dropping, so that all recorded events are decoded and counted.
+	handle->configSet(CAER_HOST_CONFIG_DATAEXCHANGE, CAER_HOST_CONFIG_DATAEXCHANGE_OVERFLOW_POLICY,
+		CAER_DATAEXCHANGE_OVERFLOW_COALESCE);
+
+	handle->dataStart(nullptr, nullptr, nullptr, &usbShutdownHandler, nullptr);
+
+	// Let's turn on blocking data-get mode to avoid wasting resources.
+	handle->configSet(CAER_HOST_CONFIG_DATAEXCHANGE, CAER_HOST_CONFIG_DATAEXCHANGE_BLOCKING, true);
+
+	auto wallStart  = chrono::steady_clock::now();
+	double cpuStart = cpuTimeUsed();
+
+	while (!globalShutdown.load(memory_order_relaxed)) {
+		// Only fetch and drop containers, the cost of interest is decoding.
+		handle->dataGet();
+	}
+
+	double cpu  = cpuTimeUsed() - cpuStart;
+	double wall = chrono::duration<double>(chrono::steady_clock::now() - wallStart).count();
+
+	uint64_t bytes  = handle->configGet64(CAER_HOST_CONFIG_STATISTICS, CAER_HOST_CONFIG_STATISTICS_BYTES_RECEIVED);
+	uint64_t events = 0;
+
+	for (uint8_t type = 0; type < CAER_DEFAULT_EVENT_TYPES_COUNT; type++) {
+		events += handle->configGet64(
+			CAER_HOST_CONFIG_STATISTICS, static_cast<uint8_t>(CAER_HOST_CONFIG_STATISTICS_EVENTS + (2 * type)));
+	}
+
+	handle->dataStop();
+
+	printf("%.3f s, %.1f%% CPU, %.3f GB/s, %.2f Mev/s, %.2f Mev/s per CPU.\n", wall, (cpu / wall) * 100.0,
+		(static_cast<double>(bytes) / 1e9) / wall, (static_cast<double>(events) / 1e6) / wall,
+		(cpu > 0) ? ((static_cast<double>(events) / 1e6) / cpu) : (0.0));
+
+	// Close automatically done by destructor.
+
+	printf("Shutdown successful.\n");
+
+	return (EXIT_SUCCESS);
+}
@@ -0,0 +1,117 @@
+#include <libcaercpp/devices/dvxplorer.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <sys/resource.h>
+
+using namespace std;
+
+#define BENCHMARK_SECONDS 10
+
+static atomic_bool globalShutdown(false);
+
+static void globalShutdownSignalHandler(int signal) {
+	// Simply set the running flag to false on SIGTERM and SIGINT (CTRL+C) for global shutdown.
+	if (signal == SIGTERM || signal == SIGINT) {
+		globalShutdown.store(true);
+	}
+}
+
+static void usbShutdownHandler(void *ptr) {
+	(void) (ptr); // UNUSED.
+
+	globalShutdown.store(true);
+}
+
+// User plus system CPU time used by the whole process, all threads included.
+static double cpuTimeUsed(void) {
+	struct rusage usage;
+	getrusage(RUSAGE_SELF, &usage);
+
+	return (static_cast<double>(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec)
+			+ (static_cast<double>(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1e6));
+}
+
+static void benchmarkRun(const libcaer::devices::dvXplorer &handle, bool zeroCopy) {
+	handle.configSet(CAER_HOST_CONFIG_USB, CAER_HOST_CONFIG_USB_ZERO_COPY, zeroCopy);
+	handle.configSet(CAER_HOST_CONFIG_STATISTICS, CAER_HOST_CONFIG_STATISTICS_RESET, true);
+
+	handle.dataStart(nullptr, nullptr, nullptr, &usbShutdownHandler, nullptr);
+
+	// Let's turn on blocking data-get mode to avoid wasting resources.
+	handle.configSet(CAER_HOST_CONFIG_DATAEXCHANGE, CAER_HOST_CONFIG_DATAEXCHANGE_BLOCKING, true);
+
+	auto wallStart  = chrono::steady_clock::now();
+	double cpuStart = cpuTimeUsed();
+
+	while (!globalShutdown.load(memory_order_relaxed)
+		   && (chrono::steady_clock::now() - wallStart) < chrono::seconds(BENCHMARK_SECONDS)) {
+		// Only fetch and drop containers, the cost of interest is on the USB side.
+		handle.dataGet();
+	}
+
+	double cpu  = cpuTimeUsed() - cpuStart;
+	double wall = chrono::duration<double>(chrono::steady_clock::now() - wallStart).count();
+
+	uint64_t bytes = handle.configGet64(CAER_HOST_CONFIG_STATISTICS, CAER_HOST_CONFIG_STATISTICS_BYTES_RECEIVED);
+
+	handle.dataStop();
+
+	double gbPerSecond = (static_cast<double>(bytes) / 1e9) / wall;
+	double cpuLoad     = cpu / wall;
+
+	printf("%s: %.3f GB/s, %.1f%% CPU, %.1f%% CPU per GB/s.\n", (zeroCopy) ? ("Zero-copy") : ("Copy"), gbPerSecond,
+		cpuLoad * 100.0, (gbPerSecond > 0) ? ((cpuLoad * 100.0) / gbPerSecond) : (0.0));
+}
+
+int main(void) {
+	struct sigaction shutdownAction;
+
+	shutdownAction.sa_handler = &globalShutdownSignalHandler;
+	shutdownAction.sa_flags   = 0;
+	sigemptyset(&shutdownAction.sa_mask);
+	sigaddset(&shutdownAction.sa_mask, SIGTERM);
+	sigaddset(&shutdownAction.sa_mask, SIGINT);
+
+	if (sigaction(SIGTERM, &shutdownAction, NULL) == -1) {
+		libcaer::log::log(libcaer::log::logLevel::CRITICAL, "ShutdownAction",
+			"Failed to set signal handler for SIGTERM. Error: %d.", errno);
+		return (EXIT_FAILURE);
+	}
+
+	if (sigaction(SIGINT, &shutdownAction, NULL) == -1) {
+		libcaer::log::log(libcaer::log::logLevel::CRITICAL, "ShutdownAction",
+			"Failed to set signal handler for SIGINT. Error: %d.", errno);
+		return (EXIT_FAILURE);
+	}
+
+	// Open a DVXplorer, give it a device ID of 1, and don't care about USB bus or SN restrictions.
+	auto handle = libcaer::devices::dvXplorer(1);
+
+	auto info = handle.infoGet();
+
+	printf("%s --- ID: %d, DVS X: %d, DVS Y: %d, Firmware: %d, Logic: %d.\n", info.deviceString, info.deviceID,
+		info.dvsSizeX, info.dvsSizeY, info.firmwareVersion, info.logicVersion);
+
+	// Maximum sensitivity to get close to the highest event rates the device supports.
+	// Point the camera at a busy scene, or shake it, for meaningful results.
+	handle.sendDefaultConfig();
+
+	handle.configSet(DVX_DVS_CHIP, DVX_DVS_CHIP_GLOBAL_HOLD_ENABLE, true);
+	handle.configSet(DVX_DVS_CHIP_BIAS, DVX_DVS_CHIP_BIAS_SIMPLE, DVX_DVS_CHIP_BIAS_SIMPLE_VERY_HIGH);
+
+	printf("Measuring %d seconds each, with normal and zero-copy USB transfer buffers.\n", BENCHMARK_SECONDS);
+
+	benchmarkRun(handle, false);
+
+	if (!globalShutdown.load()) {
+		benchmarkRun(handle, true);
+	}
+
+	// Close automatically done by destructor.
+
+	printf("Shutdown successful.\n");
+
+	return (EXIT_SUCCESS);
+}
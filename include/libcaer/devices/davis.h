@@ -806,6 +806,18 @@ enum caer_davis_aps_frame_modes {
  */
 #define DAVIS_CONFIG_APS_FRAME_MODE 102
 
+/**
+ * Parameter address for module DAVIS_CONFIG_APS:
+ * defer correlated double sampling (CDS) to the end of each frame.
+ * Instead of computing every pixel value as soon as its second ADC
+ * sample arrives, both samples are stored as they come in, and the
+ * whole frame is then processed in one pass, which the compiler can
+ * vectorize. This lowers the per-sample decoding cost on sensors with
+ * large frames, at the price of one more frame-sized sample buffer.
+ * The resulting frames are identical. Takes effect on the next frame.
+ */
+#define DAVIS_CONFIG_APS_DEFERRED_CDS 103
+
 /**
  * Parameter address for module DAVIS_CONFIG_IMU:
  * read-only parameter, contains information on the type of IMU
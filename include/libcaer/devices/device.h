@@ -49,6 +49,10 @@ typedef struct caer_device_handle *caerDeviceHandle;
  * Module address: host-side logging configuration.
  */
 #define CAER_HOST_CONFIG_LOG -4
+/**
+ * Module address: host-side data path statistics.
+ */
+#define CAER_HOST_CONFIG_STATISTICS -5
 
 /**
  * Parameter address for module CAER_HOST_CONFIG_DATAEXCHANGE:
@@ -57,6 +61,9 @@ typedef struct caer_device_handle *caerDeviceHandle;
  * The default values are usually fine, only change them if you're
  * running into lots of dropped/missing packets; you can turn on
  * the INFO log level to see when this is the case.
+ * Must be a power of two, other values are rejected. Can be changed
+ * while data transfers are running: containers already queued are all
+ * delivered, in order, before the ones committed after the change.
  */
 #define CAER_HOST_CONFIG_DATAEXCHANGE_BUFFER_SIZE 0
 /**
@@ -89,6 +96,65 @@ typedef struct caer_device_handle *caerDeviceHandle;
  * need precise control over which ones are running at any time.
  */
 #define CAER_HOST_CONFIG_DATAEXCHANGE_STOP_PRODUCERS 3
+/**
+ * Parameter address for module CAER_HOST_CONFIG_DATAEXCHANGE:
+ * maximum time, in microseconds, that caerDeviceDataGet() waits for a new
+ * EventPacketContainer in blocking mode (see CAER_HOST_CONFIG_DATAEXCHANGE_BLOCKING)
+ * before returning NULL. The waiting thread is woken up as soon as a new
+ * container is available, and uses no CPU time while waiting.
+ * Set to zero to wait without limit, until data is available or the data
+ * transfers are stopped. Defaults to one second.
+ */
+#define CAER_HOST_CONFIG_DATAEXCHANGE_BLOCKING_TIMEOUT 4
+
+/**
+ * List of supported data exchange overflow policies.
+ */
+enum caer_dataexchange_overflow_policies {
+	CAER_DATAEXCHANGE_OVERFLOW_DROP_NEWEST = 0,
+	CAER_DATAEXCHANGE_OVERFLOW_DROP_OLDEST = 1,
+	CAER_DATAEXCHANGE_OVERFLOW_COALESCE    = 2,
+};
+
+/**
+ * Parameter address for module CAER_HOST_CONFIG_DATAEXCHANGE:
+ * what to do with a new EventPacketContainer when the FIFO buffer
+ * is full because caerDeviceDataGet() is not keeping up. Available are:
+ * - CAER_DATAEXCHANGE_OVERFLOW_DROP_NEWEST (default): drop the new container.
+ * - CAER_DATAEXCHANGE_OVERFLOW_DROP_OLDEST: drop the oldest queued container
+ *   to make space for the new one, so the freshest data is always delivered.
+ * - CAER_DATAEXCHANGE_OVERFLOW_COALESCE: append the events of the new container
+ *   to the newest queued one, so no events are lost, but containers can grow
+ *   beyond the CAER_HOST_CONFIG_PACKETS limits. If the two containers can't be
+ *   merged, or there is not enough memory to merge them, the new one is dropped.
+ * Only takes effect on the next caerDeviceDataStart() call.
+ */
+#define CAER_HOST_CONFIG_DATAEXCHANGE_OVERFLOW_POLICY 5
+/**
+ * Parameter address for module CAER_HOST_CONFIG_DATAEXCHANGE:
+ * read-only counter of EventPacketContainers dropped because the
+ * FIFO buffer was full, under the DROP_NEWEST policy, or under
+ * the COALESCE policy when merging was not possible.
+ * Reset on caerDeviceDataStart().
+ * This is a 64bit value, use caerDeviceConfigGet64() to read it.
+ */
+#define CAER_HOST_CONFIG_DATAEXCHANGE_DROPPED_NEWEST 6
+/**
+ * Parameter address for module CAER_HOST_CONFIG_DATAEXCHANGE:
+ * read-only counter of queued EventPacketContainers dropped to make
+ * space for new ones, under the DROP_OLDEST policy.
+ * Reset on caerDeviceDataStart().
+ * This is a 64bit value, use caerDeviceConfigGet64() to read it.
+ */
+#define CAER_HOST_CONFIG_DATAEXCHANGE_DROPPED_OLDEST 8
+/**
+ * Parameter address for module CAER_HOST_CONFIG_DATAEXCHANGE:
+ * read-only counter of EventPacketContainers merged into a queued
+ * one, under the COALESCE policy.
+ * Reset on caerDeviceDataStart().
+ * This is a 64bit value, use caerDeviceConfigGet64() to read it.
+ */
+#define CAER_HOST_CONFIG_DATAEXCHANGE_COALESCED 10
 
 /**
  * Parameter address for module CAER_HOST_CONFIG_PACKETS:
@@ -107,6 +173,52 @@ typedef struct caer_device_handle *caerDeviceHandle;
  * types of events contained in the EventPacketContainer.
  */
 #define CAER_HOST_CONFIG_PACKETS_MAX_CONTAINER_INTERVAL 1
+/**
+ * Parameter address for module CAER_HOST_CONFIG_PACKETS:
+ * set the maximum number of EventPacketContainers handed back with
+ * caerDeviceDataRecycle() that are kept for reuse, together with their
+ * EventPackets (rounded up to a power of two). Set to zero to disable
+ * reuse, recycled containers are then simply freed.
+ * Only takes effect on caerDeviceDataStart().
+ */
+#define CAER_HOST_CONFIG_PACKETS_POOL_SIZE 2
+/**
+ * Parameter address for module CAER_HOST_CONFIG_PACKETS:
+ * set the maximum wall-clock time, in microseconds, a packet container
+ * may be pending on the host before it's made available to the user,
+ * even if the device goes quiet and no new data arrives to reach the
+ * other limits. Set to zero to disable (default).
+ * For USB devices using a shared USB thread without the translator
+ * thread, it's only checked when new data arrives.
+ */
+#define CAER_HOST_CONFIG_PACKETS_MAX_CONTAINER_LATENCY 3
+/**
+ * Parameter address for module CAER_HOST_CONFIG_PACKETS:
+ * read-only counter of EventPacketContainers and EventPackets
+ * that were reused from the pool instead of allocated.
+ * Reset on caerDeviceDataStart().
+ * This is a 64bit value, use caerDeviceConfigGet64() to read it.
+ */
+#define CAER_HOST_CONFIG_PACKETS_POOL_HITS 4
+/**
+ * Parameter address for module CAER_HOST_CONFIG_PACKETS:
+ * read-only counter of EventPacketContainers and EventPackets
+ * that had to be allocated because the pool had none to reuse.
+ * Only counted while the pool is enabled.
+ * Reset on caerDeviceDataStart().
+ * This is a 64bit value, use caerDeviceConfigGet64() to read it.
+ */
+#define CAER_HOST_CONFIG_PACKETS_POOL_MISSES 6
+/**
+ * Parameter address for module CAER_HOST_CONFIG_PACKETS:
+ * read-only counter of EventPackets that had to be grown (reallocated
+ * and copied) because more events arrived than they could hold.
+ * New packets are sized from a moving average of the events per type
+ * in recent containers, so this should stay low under steady activity.
+ * Reset on caerDeviceDataStart().
+ * This is a 64bit value, use caerDeviceConfigGet64() to read it.
+ */
+#define CAER_HOST_CONFIG_PACKETS_GROWS 8
 
 /**
  * Parameter address for module CAER_HOST_CONFIG_LOG:
@@ -116,6 +228,61 @@ typedef struct caer_device_handle *caerDeviceHandle;
  */
 #define CAER_HOST_CONFIG_LOG_LEVEL 0
 
+/**
+ * Parameter address for module CAER_HOST_CONFIG_STATISTICS:
+ * reset all statistics counters to zero. This is an impulse,
+ * it resets itself automatically.
+ * All statistics are kept from when the device is opened, across
+ * caerDeviceDataStart()/caerDeviceDataStop() calls, and are cheap
+ * enough to be always on; they can be read at any time.
+ */
+#define CAER_HOST_CONFIG_STATISTICS_RESET 0
+/**
+ * Parameter address for module CAER_HOST_CONFIG_STATISTICS:
+ * highest number of EventPacketContainers that were waiting in the
+ * data exchange FIFO buffer at the same time. A value close to
+ * CAER_HOST_CONFIG_DATAEXCHANGE_BUFFER_SIZE means your processing
+ * is close to not keeping up.
+ */
+#define CAER_HOST_CONFIG_STATISTICS_BUFFER_HIGH_WATER 1
+/**
+ * Parameter address for module CAER_HOST_CONFIG_STATISTICS:
+ * number of bytes received from the device.
+ * This is a 64bit value, use caerDeviceConfigGet64() to read it.
+ */
+#define CAER_HOST_CONFIG_STATISTICS_BYTES_RECEIVED 2
+/**
+ * Parameter address for module CAER_HOST_CONFIG_STATISTICS:
+ * number of EventPacketContainers made available to
+ * caerDeviceDataGet().
+ * This is a 64bit value, use caerDeviceConfigGet64() to read it.
+ */
+#define CAER_HOST_CONFIG_STATISTICS_CONTAINERS_COMMITTED 4
+/**
+ * Parameter address for module CAER_HOST_CONFIG_STATISTICS:
+ * number of EventPacketContainers dropped because the data exchange
+ * FIFO buffer was full, be it the new or the oldest queued ones, see
+ * CAER_HOST_CONFIG_DATAEXCHANGE_OVERFLOW_POLICY.
+ * This is a 64bit value, use caerDeviceConfigGet64() to read it.
+ */
+#define CAER_HOST_CONFIG_STATISTICS_CONTAINERS_DROPPED 6
+/**
+ * Parameter address for module CAER_HOST_CONFIG_STATISTICS:
+ * highest event timestamp, in microseconds, of the last committed
+ * EventPacketContainer. -1 if nothing was committed yet.
+ * This is a 64bit value, use caerDeviceConfigGet64() to read it.
+ */
+#define CAER_HOST_CONFIG_STATISTICS_LAST_COMMIT_TIMESTAMP 8
+/**
+ * Parameter address for module CAER_HOST_CONFIG_STATISTICS:
+ * number of events decoded from the device data, per event type.
+ * Use address CAER_HOST_CONFIG_STATISTICS_EVENTS + (2 * eventType),
+ * for all types in 'enum caer_default_event_types'.
+ * This includes events in dropped containers.
+ * These are 64bit values, use caerDeviceConfigGet64() to read them.
+ */
+#define CAER_HOST_CONFIG_STATISTICS_EVENTS 16
+
 /**
  * Close a previously opened device and invalidate its handle.
  *
@@ -240,7 +407,8 @@ bool caerDeviceDataStop(caerDeviceHandle handle);
  * The caerEventPacketContainerFree() function can be used to correctly free the full
  * container memory. For single caerEventPackets, just use free().
  * This function can be made blocking with the CAER_HOST_CONFIG_DATAEXCHANGE_BLOCKING
- * configuration parameter. By default it is non-blocking.
+ * configuration parameter. By default it is non-blocking. In blocking mode, the
+ * maximum wait time is set by CAER_HOST_CONFIG_DATAEXCHANGE_BLOCKING_TIMEOUT.
  *
  * @param handle a valid device handle.
  *
@@ -250,6 +418,70 @@ bool caerDeviceDataStop(caerDeviceHandle handle);
  */
 caerEventPacketContainer caerDeviceDataGet(caerDeviceHandle handle);
 
+/**
+ * Get up to containersNumber event packet containers at once, in the same order
+ * caerDeviceDataGet() would return them. Moving several containers in one call
+ * is cheaper than calling caerDeviceDataGet() repeatedly, as the synchronization
+ * with the data acquisition thread is only done once per call.
+ * The same memory ownership rules as for caerDeviceDataGet() apply to each
+ * returned container.
+ * If CAER_HOST_CONFIG_DATAEXCHANGE_BLOCKING is enabled, this blocks until at
+ * least one container is available, and then returns all that are available,
+ * up to containersNumber.
+ *
+ * @param handle a valid device handle.
+ * @param containers array of at least containersNumber elements, to be filled
+ *                   with valid event packet containers.
+ * @param containersNumber maximum number of containers to get.
+ *
+ * @return number of valid event packet containers written to the start of the
+ *         containers array. Zero will be returned on errors, such as exceptional
+ *         device shutdown, or when there is no container available in
+ *         non-blocking mode.
+ */
+size_t caerDeviceDataGetMany(caerDeviceHandle handle, caerEventPacketContainer *containers, size_t containersNumber);
+
+/**
+ * Get a file descriptor that can be used with poll(), select() or epoll to
+ * wait for event packet containers to become available, so that a device can
+ * be integrated into an existing event loop instead of dedicating a thread to
+ * a blocking caerDeviceDataGet() call.
+ * The file descriptor is readable as long as there are containers available
+ * for caerDeviceDataGet()/caerDeviceDataGetMany(). It must only be polled,
+ * never read from or written to directly, nor closed.
+ * It is only valid between caerDeviceDataStart() and caerDeviceDataStop(): call
+ * this function after each caerDeviceDataStart(), and remove the descriptor from
+ * your event loop before calling caerDeviceDataStop().
+ * Only supported on POSIX systems (eventfd on Linux, a pipe elsewhere).
+ *
+ * @param handle a valid device handle.
+ *
+ * @return a valid file descriptor, or -1 on errors, such as data transfers
+ *         not running or the platform not supporting this functionality.
+ */
+int caerDeviceDataGetFD(caerDeviceHandle handle);
+
+/**
+ * Hand an event packet container obtained from caerDeviceDataGet() or
+ * caerDeviceDataGetMany() back to the device once done with it, instead of
+ * freeing it with caerEventPacketContainerFree(). The container and all the
+ * event packets still in it are then reused for new data, which avoids
+ * allocating and freeing memory for every container on both the data
+ * acquisition and the consumer side. Packets you want to keep can be
+ * taken out of the container first, by setting their pointers to NULL.
+ * The pool size is set with CAER_HOST_CONFIG_PACKETS_POOL_SIZE; if it is
+ * disabled or full, or data transfers are not running, the container is freed.
+ * Must only be called from one thread, normally the one calling
+ * caerDeviceDataGet(), and not concurrently with caerDeviceDataStop().
+ * Only recycle unmodified containers from this same device: the packets
+ * may have had events invalidated, but not been reallocated or replaced.
+ *
+ * @param handle a valid device handle.
+ * @param container an event packet container, ownership passes to the device.
+ *                  NULL is allowed and ignored.
+ */
+void caerDeviceDataRecycle(caerDeviceHandle handle, caerEventPacketContainer container);
+
 #ifdef __cplusplus
 }
 #endif
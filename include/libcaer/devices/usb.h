@@ -34,6 +34,120 @@ extern "C" {
  * them if you're running into I/O limits.
  */
 #define CAER_HOST_CONFIG_USB_BUFFER_SIZE 1
+/**
+ * Parameter address for module CAER_HOST_CONFIG_USB:
+ * decode data in a separate translator thread instead of directly in the
+ * USB thread. Received transfer buffers are queued for the translator thread,
+ * in order, and the transfer itself is resubmitted right away with a fresh
+ * buffer, so that slow decoding does not delay USB handling. If decoding
+ * falls so far behind that no free buffer is left, transfers are held back
+ * until the translator thread frees one, so the device waits and no data
+ * is lost, while the USB thread itself never stalls.
+ * Disabled by default, changes take effect on the next data start.
+ */
+#define CAER_HOST_CONFIG_USB_TRANSLATOR_THREAD 2
+/**
+ * Parameter address for module CAER_HOST_CONFIG_USB:
+ * allocate the buffers for asynchronous data transfers in device memory
+ * (libusb_dev_mem_alloc()), so that data is parsed directly from memory
+ * mapped by the kernel, instead of being copied into user-space first.
+ * Only supported on Linux, with libusb 1.0.21 or newer; buffers that cannot
+ * be allocated this way fall back to normal memory. Does not apply to the
+ * translator thread buffers (CAER_HOST_CONFIG_USB_TRANSLATOR_THREAD).
+ * Disabled by default, changes take effect on the next data start.
+ */
+#define CAER_HOST_CONFIG_USB_ZERO_COPY 3
+/**
+ * Parameter address for module CAER_HOST_CONFIG_USB:
+ * automatically adapt number and size of the buffers used for asynchronous
+ * data transfers to the current data rate. Transfers that arrive full raise
+ * number or size (up to 4x the configured values), while mostly empty ones
+ * lower them again (down to the configured number and 1/4 of the configured
+ * size), to reduce latency when idle. New transfers are always submitted
+ * before old ones are retired, so data keeps flowing during the change.
+ * Not applied while CAER_HOST_CONFIG_USB_TRANSLATOR_THREAD is active.
+ * Disabled by default, takes effect immediately; changing BUFFER_NUMBER
+ * or BUFFER_SIZE resets the transfers to the configured values.
+ */
+#define CAER_HOST_CONFIG_USB_AUTOTUNE 4
+
+/**
+ * Maximum number of shared USB event handling threads,
+ * see caerDeviceUSBSharedThreadsSet().
+ */
+#define CAER_USB_SHARED_THREADS_MAX 8
+
+/**
+ * Service all USB devices opened from now on with a small process-wide set of
+ * shared libusb contexts, each with one event handling thread, instead of giving
+ * every device its own context and thread. Each new device is assigned to the
+ * shared thread currently serving the fewest devices. Shared threads start with
+ * the first device assigned to them and stop when their last device is closed.
+ * Devices that are already open are not affected.
+ * With many devices on one host this reduces the number of threads and context
+ * switches. Devices on the same thread do share it though, so any delay in
+ * handling one of them (like a full translator thread queue) delays the others.
+ * The libusb log level is per context, so the last device to set it wins.
+ *
+ * @param threadsNumber number of shared threads, up to CAER_USB_SHARED_THREADS_MAX.
+ *                      Zero disables sharing, which is the default.
+ *
+ * @return true on success, false if threadsNumber is out of range.
+ */
+bool caerDeviceUSBSharedThreadsSet(uint8_t threadsNumber);
+
+/**
+ * Get the number of shared USB event handling threads new devices are assigned to.
+ *
+ * @return number of shared threads, zero if sharing is disabled.
+ */
+uint8_t caerDeviceUSBSharedThreadsGet(void);
+
+/**
+ * Pin a shared USB event handling thread to one CPU core. Applied right away
+ * if the thread is running, or as soon as it starts. Only supported on Linux.
+ *
+ * @param threadIndex index of the shared thread, less than CAER_USB_SHARED_THREADS_MAX.
+ * @param cpuCore CPU core to run on, or -1 to allow all cores (default).
+ *
+ * @return true on success, false if threadIndex is out of range or the
+ *         platform does not support setting thread affinity.
+ */
+bool caerDeviceUSBSharedThreadsAffinitySet(uint8_t threadIndex, int32_t cpuCore);
+
+/**
+ * Capture the raw USB traffic of all USB devices opened from now on to a file:
+ * device information, replies to control requests, and all data transfers with
+ * their arrival time. Such a file can then be opened as a virtual device with
+ * caerDeviceUSBReplaySet(), to reproduce issues and benchmark the host-side data
+ * path without hardware. Each device opened overwrites the file, so open only
+ * one at a time while capturing.
+ * If never called, the CAER_USB_CAPTURE environment variable is used instead.
+ *
+ * @param filePath path to the capture file, NULL or empty to disable capture (default).
+ *
+ * @return true on success, false on memory allocation failure.
+ */
+bool caerDeviceUSBCaptureSet(const char *filePath);
+
+/**
+ * Replay a file recorded with caerDeviceUSBCaptureSet() instead of opening real
+ * hardware. USB devices opened from now on only succeed if the file was captured
+ * from the same kind of device (USB VID/PID); control requests are answered from
+ * the recorded replies, and on data start all recorded data is fed to the normal
+ * data translation path, from its own thread. The end of the recording is handled
+ * like a device disconnect, calling the data shutdown notification callback.
+ * If never called, the CAER_USB_REPLAY environment variable is used instead, plus
+ * CAER_USB_REPLAY_FAST=1 to disable real-time replay.
+ *
+ * @param filePath path to the capture file, NULL or empty to disable replay (default).
+ * @param realTime true to keep the recorded timing between data transfers, false
+ *                 to replay as fast as possible. When going as fast as possible,
+ *                 whether data is dropped depends on the data exchange settings.
+ *
+ * @return true on success, false on memory allocation failure.
+ */
+bool caerDeviceUSBReplaySet(const char *filePath, bool realTime);
 
 /**
  * Open a specified USB device, assign an ID to it and return a handle for further usage.
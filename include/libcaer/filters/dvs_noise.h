@@ -140,6 +140,8 @@ ssize_t caerFilterDVSNoiseGetHotPixels(caerFilterDVSNoise noiseFilter, caerFilte
  * Once learning is enabled, do not disable it until completed. To verify
  * completion, query this parameter and wait for it to switch from 'true'
  * back to 'false'.
+ * Cannot be enabled during continuous learning, see
+ * CAER_FILTER_DVS_HOTPIXEL_CONTINUOUS.
  */
 #define CAER_FILTER_DVS_HOTPIXEL_LEARN 0
 /**
@@ -275,6 +277,48 @@ ssize_t caerFilterDVSNoiseGetHotPixels(caerFilterDVSNoise noiseFilter, caerFilte
  */
 #define CAER_FILTER_DVS_BACKGROUND_ACTIVITY_CHECK_POLARITY 16
 
+/**
+ * DVS Noise Filter:
+ * store the per-pixel timestamps map used by the background-activity and
+ * refractory period filters in 32 bit, relative to an epoch that is moved
+ * forward as time advances, instead of in 64 bit. This halves the memory
+ * traffic of the map, for the same filtering results, as long as the
+ * background-activity and refractory period times are below 2^30 µs
+ * (about 17 minutes) and timestamps don't jump backwards. Enabling fails
+ * if either time is 2^30 µs or more, and so does setting either time that
+ * high while enabled. Enabling or disabling converts the current map.
+ * Disabled by default.
+ */
+#define CAER_FILTER_DVS_TIMESTAMPS_COMPACT 23
+
+/**
+ * DVS Noise Filter:
+ * number of worker threads to filter with. The pixel array is split
+ * into that many horizontal bands (at most one per four rows), which are
+ * filtered concurrently, with exactly the same results as filtering on
+ * the calling thread. Packets are still filtered on the calling thread
+ * while hot pixels are being learned. Only worth it for high event rates.
+ * 0 or 1 to filter on the calling thread only, which is the default.
+ */
+#define CAER_FILTER_DVS_PARALLEL_THREADS 24
+
+/**
+ * DVS HotPixel Filter:
+ * learn hot pixels continuously, instead of once. Every pixel keeps an
+ * activity estimate, updated once per CAER_FILTER_DVS_HOTPIXEL_TIME as
+ * the average of its previous value and the latest event count. Pixels
+ * become hot when that estimate reaches CAER_FILTER_DVS_HOTPIXEL_COUNT,
+ * and stop being hot when it falls below half of it. Updates are spread
+ * over packets, a few rows at a time, so the work per packet is bounded.
+ * While enabled, caerFilterDVSNoiseGetHotPixels() returns the current
+ * hot pixels. Use CAER_FILTER_DVS_HOTPIXEL_ENABLE to filter them out.
+ * Continuous learning starts from the hot pixels found by the last
+ * one-shot learning (CAER_FILTER_DVS_HOTPIXEL_LEARN), and when disabled,
+ * the filter goes back to those; what was learned continuously is lost.
+ * The two are exclusive: enabling one while the other is running fails.
+ */
+#define CAER_FILTER_DVS_HOTPIXEL_CONTINUOUS 25
+
 #ifdef __cplusplus
 }
 #endif
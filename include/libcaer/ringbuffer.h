@@ -23,8 +23,10 @@ typedef struct caer_ring_buffer *caerRingBuffer;
 caerRingBuffer caerRingBufferInit(size_t size);
 void caerRingBufferFree(caerRingBuffer rBuf);
 bool caerRingBufferPut(caerRingBuffer rBuf, void *elem);
+size_t caerRingBufferPutMany(caerRingBuffer rBuf, void **elems, size_t elemsNumber);
 bool caerRingBufferFull(caerRingBuffer rBuf);
 void *caerRingBufferGet(caerRingBuffer rBuf);
+size_t caerRingBufferGetMany(caerRingBuffer rBuf, void **elems, size_t elemsNumber);
 void *caerRingBufferLook(caerRingBuffer rBuf);
 bool caerRingBufferEmpty(caerRingBuffer rBuf);
 
@@ -10,6 +10,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace libcaer {
 namespace devices {
@@ -107,6 +108,35 @@ public:
 
 		return (cppContainer);
 	}
+
+	std::vector<std::unique_ptr<libcaer::events::EventPacketContainer>> dataGetMany(size_t containersNumber) const {
+		std::vector<caerEventPacketContainer> cContainers(containersNumber);
+		std::vector<std::unique_ptr<libcaer::events::EventPacketContainer>> cppContainers;
+
+		size_t containersGot = caerDeviceDataGetMany(handle.get(), cContainers.data(), containersNumber);
+
+		cppContainers.reserve(containersGot);
+
+		for (size_t i = 0; i < containersGot; i++) {
+			cppContainers.emplace_back(new libcaer::events::EventPacketContainer(cContainers[i]));
+
+			// Free original C container. The event packet memory is now managed by
+			// the EventPacket classes inside the new C++ EventPacketContainer.
+			free(cContainers[i]);
+		}
+
+		return (cppContainers);
+	}
+
+	int dataGetFD() const {
+		int fd = caerDeviceDataGetFD(handle.get());
+		if (fd < 0) {
+			std::string exc = toString() + ": failed to get data notification file descriptor.";
+			throw std::runtime_error(exc);
+		}
+
+		return (fd);
+	}
 };
 } // namespace devices
 } // namespace libcaer
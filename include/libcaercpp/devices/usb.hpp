@@ -36,6 +36,44 @@ protected:
 
 		handle = std::shared_ptr<struct caer_device_handle>(h, deleteDeviceHandle);
 	}
+
+public:
+	static void sharedThreadsSet(uint8_t threadsNumber) {
+		bool success = caerDeviceUSBSharedThreadsSet(threadsNumber);
+		if (!success) {
+			std::string exc = "Failed to set number of shared USB threads to " + std::to_string(threadsNumber) + ".";
+			throw std::runtime_error(exc);
+		}
+	}
+
+	static uint8_t sharedThreadsGet() noexcept {
+		return (caerDeviceUSBSharedThreadsGet());
+	}
+
+	static void sharedThreadsAffinitySet(uint8_t threadIndex, int32_t cpuCore) {
+		bool success = caerDeviceUSBSharedThreadsAffinitySet(threadIndex, cpuCore);
+		if (!success) {
+			std::string exc = "Failed to set affinity of shared USB thread " + std::to_string(threadIndex)
+							  + " to CPU " + std::to_string(cpuCore) + ".";
+			throw std::runtime_error(exc);
+		}
+	}
+
+	static void captureSet(const std::string &filePath) {
+		bool success = caerDeviceUSBCaptureSet(filePath.c_str());
+		if (!success) {
+			std::string exc = "Failed to set USB capture file to '" + filePath + "'.";
+			throw std::runtime_error(exc);
+		}
+	}
+
+	static void replaySet(const std::string &filePath, bool realTime = true) {
+		bool success = caerDeviceUSBReplaySet(filePath.c_str(), realTime);
+		if (!success) {
+			std::string exc = "Failed to set USB replay file to '" + filePath + "'.";
+			throw std::runtime_error(exc);
+		}
+	}
 };
 } // namespace devices
 } // namespace libcaer
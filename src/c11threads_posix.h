@@ -17,6 +17,7 @@
 typedef pthread_t thrd_t;
 typedef pthread_once_t once_flag;
 typedef pthread_mutex_t mtx_t;
+typedef pthread_cond_t cnd_t;
 typedef int (*thrd_start_t)(void *);
 
 enum {
@@ -202,6 +203,134 @@ static inline int mtx_unlock(mtx_t *mutex) {
 	return (thrd_success);
 }
 
+static inline int cnd_init(cnd_t *cond) {
+	int ret = pthread_cond_init(cond, NULL);
+
+	switch (ret) {
+		case 0:
+			return (thrd_success);
+
+		case ENOMEM:
+			return (thrd_nomem);
+
+		default:
+			return (thrd_error);
+	}
+}
+
+static inline void cnd_destroy(cnd_t *cond) {
+	pthread_cond_destroy(cond);
+}
+
+static inline int cnd_signal(cnd_t *cond) {
+	if (pthread_cond_signal(cond) != 0) {
+		return (thrd_error);
+	}
+
+	return (thrd_success);
+}
+
+static inline int cnd_broadcast(cnd_t *cond) {
+	if (pthread_cond_broadcast(cond) != 0) {
+		return (thrd_error);
+	}
+
+	return (thrd_success);
+}
+
+static inline int cnd_wait(cnd_t *cond, mtx_t *mutex) {
+	if (pthread_cond_wait(cond, mutex) != 0) {
+		return (thrd_error);
+	}
+
+	return (thrd_success);
+}
+
+// As in C11, time_point is an absolute calendar time (TIME_UTC / CLOCK_REALTIME).
+static inline int cnd_timedwait(
+	cnd_t *restrict cond, mtx_t *restrict mutex, const struct timespec *restrict time_point) {
+	int ret = pthread_cond_timedwait(cond, mutex, time_point);
+
+	switch (ret) {
+		case 0:
+			return (thrd_success);
+
+		case ETIMEDOUT:
+			return (thrd_timedout);
+
+		default:
+			return (thrd_error);
+	}
+}
+
+// NON STANDARD!
+// Condition variable for cnd_timedwait_relative(), timed on the monotonic
+// clock, so that waits are not stretched or cut short by wall-clock changes.
+static inline int cnd_init_monotonic(cnd_t *cond) {
+#if defined(__APPLE__)
+	// No clock attribute on MacOS X, relative waits are used instead.
+	return (cnd_init(cond));
+#else
+	pthread_condattr_t attr;
+	if (pthread_condattr_init(&attr) != 0) {
+		return (thrd_error);
+	}
+
+	if (pthread_condattr_setclock(&attr, CLOCK_MONOTONIC) != 0) {
+		pthread_condattr_destroy(&attr);
+		return (thrd_error);
+	}
+
+	int ret = pthread_cond_init(cond, &attr);
+
+	pthread_condattr_destroy(&attr);
+
+	switch (ret) {
+		case 0:
+			return (thrd_success);
+
+		case ENOMEM:
+			return (thrd_nomem);
+
+		default:
+			return (thrd_error);
+	}
+#endif
+}
+
+// NON STANDARD!
+// Wait at most 'duration' on a condition variable from cnd_init_monotonic().
+static inline int cnd_timedwait_relative(
+	cnd_t *restrict cond, mtx_t *restrict mutex, const struct timespec *restrict duration) {
+#if defined(__APPLE__)
+	int ret = pthread_cond_timedwait_relative_np(cond, mutex, duration);
+#else
+	struct timespec time_point;
+	clock_gettime(CLOCK_MONOTONIC, &time_point);
+
+	time_point.tv_sec += duration->tv_sec;
+	time_point.tv_nsec += duration->tv_nsec;
+
+	if (time_point.tv_nsec >= 1000000000) {
+		time_point.tv_sec++;
+		time_point.tv_nsec -= 1000000000;
+	}
+
+	int ret = pthread_cond_timedwait(cond, mutex, &time_point);
+#endif
+
+	switch (ret) {
+		case 0:
+			return (thrd_success);
+
+		case ETIMEDOUT:
+			return (thrd_timedout);
+
+		default:
+			return (thrd_error);
+	}
+}
+
 // NON STANDARD!
 static inline int thrd_set_name(const char *name) {
 #if defined(__linux__)
@@ -3,16 +3,63 @@
 
 #include "libcaer/libcaer.h"
 
+#include "libcaer/events/frame.h"
+#include "libcaer/events/imu6.h"
+#include "libcaer/events/polarity.h"
 #include "libcaer/events/special.h"
+#include "libcaer/events/spike.h"
 
 #include "data_exchange.h"
 #include "timestamps.h"
 
+// Packet size history: exponential moving average of the events per type in
+// each committed container, fixed point with 4 fractional bits, weight 1/8.
+#define CONTAINER_GENERATION_HISTORY_FRACTION 4
+#define CONTAINER_GENERATION_HISTORY_WEIGHT   8
+
+struct container_generation_packet {
+	// Where the translator keeps the packet it fills, and its fill position.
+	caerEventPacketHeader *packet;
+	int32_t *position;
+	int16_t eventType;
+	int32_t eventSize;
+	int32_t eventTSOffset;
+	int32_t defaultCapacity;
+	// Most events a single input word can generate. Space for all the words
+	// of a buffer is reserved before translating it. Zero for composite
+	// events (frames, IMU samples), which complete only over many words, and
+	// are reserved one by one on completion instead.
+	int32_t eventsPerWord;
+};
+
 struct container_generation {
 	caerEventPacketContainer currentPacketContainer;
 	atomic_uint_fast32_t maxPacketContainerPacketSize;
 	atomic_uint_fast32_t maxPacketContainerInterval;
+	atomic_uint_fast32_t maxPacketContainerLatency;
 	int64_t currentPacketContainerCommitTimestamp;
+	int64_t currentPacketContainerDeadline; // Monotonic clock, in ns, -1 if none.
+	// Recycling pool: containers handed back by the consumer, packets still
+	// attached, wait in poolBuffer (consumer puts, translator gets). The
+	// translator then reuses the container, and keeps its packets by type in
+	// poolPackets until new packets of that type are needed.
+	caerRingBuffer poolBuffer;
+	atomic_uint_fast32_t poolSize; // Only takes effect on DataStart() calls!
+	caerEventPacketHeader poolPackets[CAER_DEFAULT_EVENT_TYPES_COUNT];
+	atomic_uint_fast64_t poolHits;
+	atomic_uint_fast64_t poolMisses;
+	// New packets are sized from the history, so that they rarely have to be
+	// grown (reallocated and copied) while being filled.
+	int64_t packetSizeHistory[CAER_DEFAULT_EVENT_TYPES_COUNT]; // Translator only.
+	atomic_uint_fast64_t packetGrows;
+	// Packets being filled by the translator, by container position. Each
+	// device describes them once, so that allocation, reservation and commit
+	// are the same for all devices.
+	struct container_generation_packet packets[CAER_DEFAULT_EVENT_TYPES_COUNT];
+	int32_t packetsNumber;
+	int16_t packetsSource;
+	const char *deviceString;
+	atomic_uint_fast8_t *deviceLogLevel;
 };
 
 typedef struct container_generation *containerGeneration;
@@ -22,28 +69,370 @@ static inline void containerGenerationSettingsInit(containerGeneration state) {
 	// By default governed by time only, set at 10 milliseconds.
 	atomic_store(&state->maxPacketContainerPacketSize, 0);
 	atomic_store(&state->maxPacketContainerInterval, 10000);
+
+	// No wall-clock latency limit by default.
+	atomic_store(&state->maxPacketContainerLatency, 0);
+
+	// Recycling pool enabled, up to 16 containers.
+	atomic_store(&state->poolSize, 16);
+}
+
+static inline bool containerGenerationPoolInit(containerGeneration state) {
+	atomic_store(&state->poolHits, 0);
+	atomic_store(&state->poolMisses, 0);
+	atomic_store(&state->packetGrows, 0);
+
+	for (size_t i = 0; i < CAER_DEFAULT_EVENT_TYPES_COUNT; i++) {
+		state->packetSizeHistory[i] = 0;
+	}
+
+	uint32_t poolSize = U32T(atomic_load(&state->poolSize));
+	if (poolSize == 0) {
+		state->poolBuffer = NULL;
+		return (true);
+	}
+
+	// Ring-buffer size must be a power of two.
+	size_t bufferSize = 1;
+	while (bufferSize < poolSize) {
+		bufferSize <<= 1;
+	}
+
+	state->poolBuffer = caerRingBufferInit(bufferSize);
+
+	return (state->poolBuffer != NULL);
+}
+
+static inline void containerGenerationSetPacket(containerGeneration state, int32_t pos, caerEventPacketHeader packet) {
+	if (state->currentPacketContainer != NULL) {
+		caerEventPacketContainerSetEventPacket(state->currentPacketContainer, pos, packet);
+	}
 }
 
 static inline void containerGenerationDestroy(containerGeneration state) {
+	// Since the current event packets aren't necessarily
+	// already assigned to the current packet container, we
+	// free them separately from it.
+	for (int32_t i = 0; i < state->packetsNumber; i++) {
+		struct container_generation_packet *slot = &state->packets[i];
+
+		if ((slot->packet == NULL) || (*slot->packet == NULL)) {
+			continue;
+		}
+
+		free(*slot->packet);
+		*slot->packet   = NULL;
+		*slot->position = 0;
+
+		containerGenerationSetPacket(state, i, NULL);
+	}
+
 	if (state->currentPacketContainer != NULL) {
 		caerEventPacketContainerFree(state->currentPacketContainer);
 		state->currentPacketContainer = NULL;
 	}
+
+	if (state->poolBuffer != NULL) {
+		caerEventPacketContainer container;
+		while ((container = caerRingBufferGet(state->poolBuffer)) != NULL) {
+			caerEventPacketContainerFree(container);
+		}
+
+		caerRingBufferFree(state->poolBuffer);
+		state->poolBuffer = NULL;
+	}
+
+	for (size_t i = 0; i < CAER_DEFAULT_EVENT_TYPES_COUNT; i++) {
+		free(state->poolPackets[i]);
+		state->poolPackets[i] = NULL;
+	}
 }
 
-static inline void containerGenerationSetPacket(containerGeneration state, int32_t pos, caerEventPacketHeader packet) {
-	if (state->currentPacketContainer != NULL) {
-		caerEventPacketContainerSetEventPacket(state->currentPacketContainer, pos, packet);
+/**
+ * Hand a container obtained from the data exchange back for reuse. Consumer
+ * side, must always be called from the same thread. If the pool is disabled
+ * or full, the container is simply freed.
+ */
+static inline void containerGenerationRecycle(containerGeneration state, caerEventPacketContainer container) {
+	if (container == NULL) {
+		return;
+	}
+
+	if ((state->poolBuffer == NULL) || !caerRingBufferPut(state->poolBuffer, container)) {
+		caerEventPacketContainerFree(container);
+	}
+}
+
+// Take a recycled container, if any, keeping its packets for later reuse.
+static inline caerEventPacketContainer containerGenerationPoolGet(
+	containerGeneration state, int32_t eventPacketNumber) {
+	caerEventPacketContainer container = caerRingBufferGet(state->poolBuffer);
+	if (container == NULL) {
+		return (NULL);
+	}
+
+	for (int32_t i = 0; i < caerEventPacketContainerGetEventPacketsNumber(container); i++) {
+		caerEventPacketHeader packet = caerEventPacketContainerGetEventPacket(container, i);
+		if (packet == NULL) {
+			continue;
+		}
+
+		int16_t type = caerEventPacketHeaderGetEventType(packet);
+
+		if ((type >= 0) && (type < CAER_DEFAULT_EVENT_TYPES_COUNT) && (state->poolPackets[type] == NULL)) {
+			state->poolPackets[type] = packet;
+		}
+		else {
+			free(packet);
+		}
+
+		container->eventPackets[i] = NULL;
+	}
+
+	// Containers of a different layout (like the one-packet timestamp
+	// reset containers) only give their packets.
+	if (caerEventPacketContainerGetEventPacketsNumber(container) != eventPacketNumber) {
+		free(container);
+		return (NULL);
+	}
+
+	container->lowestEventTimestamp  = -1;
+	container->highestEventTimestamp = -1;
+	container->eventsNumber          = 0;
+	container->eventsValidNumber     = 0;
+
+	return (container);
+}
+
+static inline void containerGenerationHistoryUpdate(containerGeneration state, caerEventPacketContainer container) {
+	int32_t eventsNumber[CAER_DEFAULT_EVENT_TYPES_COUNT] = {0};
+
+	CAER_EVENT_PACKET_CONTAINER_ITERATOR_START(container)
+	int16_t type = caerEventPacketHeaderGetEventType(caerEventPacketContainerIteratorElement);
+
+	if ((type >= 0) && (type < CAER_DEFAULT_EVENT_TYPES_COUNT)) {
+		eventsNumber[type] += caerEventPacketHeaderGetEventNumber(caerEventPacketContainerIteratorElement);
+	}
+	CAER_EVENT_PACKET_CONTAINER_ITERATOR_END
+
+	// Types missing from the container count as empty, so the history decays.
+	for (size_t i = 0; i < CAER_DEFAULT_EVENT_TYPES_COUNT; i++) {
+		int64_t sample = I64T(eventsNumber[i]) * (1 << CONTAINER_GENERATION_HISTORY_FRACTION);
+
+		state->packetSizeHistory[i] += (sample - state->packetSizeHistory[i]) / CONTAINER_GENERATION_HISTORY_WEIGHT;
+	}
+}
+
+/**
+ * Capacity for a new packet of the given type: the average number of events
+ * per container plus 25% headroom, never less than the device default, nor
+ * more than the container packet size limit, if set.
+ */
+static inline int32_t containerGenerationPacketCapacity(
+	containerGeneration state, int16_t eventType, int32_t defaultCapacity) {
+	int64_t capacity = state->packetSizeHistory[eventType] >> CONTAINER_GENERATION_HISTORY_FRACTION;
+	capacity += (capacity / 4);
+
+	int64_t maxPacketSize = I64T(atomic_load_explicit(&state->maxPacketContainerPacketSize, memory_order_relaxed));
+	if ((maxPacketSize > 0) && (capacity > maxPacketSize)) {
+		capacity = maxPacketSize;
+	}
+
+	if (capacity < defaultCapacity) {
+		return (defaultCapacity);
+	}
+
+	return ((capacity > INT32_MAX) ? (INT32_MAX) : (I32T(capacity)));
+}
+
+// Called by the translators every time a packet had to be grown while filling it.
+static inline void containerGenerationPacketGrown(containerGeneration state) {
+	atomic_fetch_add_explicit(&state->packetGrows, 1, memory_order_relaxed);
+}
+
+/**
+ * Get a recycled packet of the given type, cleared and ready for use, or NULL
+ * if there is none, in which case a new packet has to be allocated as usual.
+ * Recycled packets keep their capacity, so they may be larger than new ones;
+ * those smaller than the wanted capacity are freed instead of reused.
+ */
+static inline caerEventPacketHeader containerGenerationPacketReuse(
+	containerGeneration state, int16_t eventType, int32_t eventCapacity, int16_t eventSource, int32_t tsOverflow) {
+	if (state->poolBuffer == NULL) {
+		return (NULL);
+	}
+
+	caerEventPacketHeader packet = state->poolPackets[eventType];
+	state->poolPackets[eventType] = NULL;
+
+	if ((packet != NULL) && (caerEventPacketHeaderGetEventCapacity(packet) < eventCapacity)) {
+		free(packet);
+		packet = NULL;
+	}
+
+	if (packet == NULL) {
+		atomic_fetch_add_explicit(&state->poolMisses, 1, memory_order_relaxed);
+		return (NULL);
+	}
+
+	atomic_fetch_add_explicit(&state->poolHits, 1, memory_order_relaxed);
+
+	caerEventPacketClear(packet);
+	caerEventPacketHeaderSetEventSource(packet, eventSource);
+	caerEventPacketHeaderSetEventTSOverflow(packet, tsOverflow);
+
+	return (packet);
+}
+
+/**
+ * Start describing the packets a translator fills: 'eventPacketNumber' is
+ * the container size, 'eventSource' the device ID. Called on data start,
+ * followed by containerGenerationPacketsAdd() for each packet.
+ */
+static inline void containerGenerationPacketsInit(containerGeneration state, int32_t eventPacketNumber,
+	int16_t eventSource, const char *deviceString, atomic_uint_fast8_t *deviceLogLevel) {
+	memset(state->packets, 0, sizeof(state->packets));
+
+	state->packetsNumber  = eventPacketNumber;
+	state->packetsSource  = eventSource;
+	state->deviceString   = deviceString;
+	state->deviceLogLevel = deviceLogLevel;
+}
+
+/**
+ * Describe a packet the translator fills, of a fixed-size event type.
+ * 'packet' and 'position' point to where the translator keeps the packet
+ * and its fill position, 'eventsPerWord' is the most events of this type a
+ * single input word can generate, or zero for composite events.
+ */
+static inline void containerGenerationPacketsAdd(containerGeneration state, int32_t containerPosition,
+	int16_t eventType, void *packet, int32_t *position, int32_t defaultCapacity, int32_t eventsPerWord) {
+	struct container_generation_packet *slot = &state->packets[containerPosition];
+
+	slot->packet          = packet;
+	slot->position        = position;
+	slot->eventType       = eventType;
+	slot->defaultCapacity = defaultCapacity;
+	slot->eventsPerWord   = eventsPerWord;
+
+	switch (eventType) {
+		case SPECIAL_EVENT:
+			slot->eventSize     = I32T(sizeof(struct caer_special_event));
+			slot->eventTSOffset = I32T(offsetof(struct caer_special_event, timestamp));
+			break;
+
+		case POLARITY_EVENT:
+			slot->eventSize     = I32T(sizeof(struct caer_polarity_event));
+			slot->eventTSOffset = I32T(offsetof(struct caer_polarity_event, timestamp));
+			break;
+
+		case IMU6_EVENT:
+			slot->eventSize     = I32T(sizeof(struct caer_imu6_event));
+			slot->eventTSOffset = I32T(offsetof(struct caer_imu6_event, timestamp));
+			break;
+
+		case SPIKE_EVENT:
+			slot->eventSize     = I32T(sizeof(struct caer_spike_event));
+			slot->eventTSOffset = I32T(offsetof(struct caer_spike_event, timestamp));
+			break;
+
+		default:
+			// Unknown size, the packet is never allocated.
+			slot->packet   = NULL;
+			slot->position = NULL;
+			break;
+	}
+}
+
+// Frames are sized for the device's full resolution and number of channels.
+static inline void containerGenerationPacketsAddFrame(containerGeneration state, int32_t containerPosition,
+	void *packet, int32_t *position, int32_t defaultCapacity, int32_t maxNumPixels, int16_t maxChannelNumber) {
+	struct container_generation_packet *slot = &state->packets[containerPosition];
+
+	slot->packet          = packet;
+	slot->position        = position;
+	slot->eventType       = FRAME_EVENT;
+	slot->defaultCapacity = defaultCapacity;
+	slot->eventsPerWord   = 0;
+
+	// '- sizeof(uint16_t)' to compensate for pixels[1] at end of struct for C++ compatibility.
+	slot->eventSize = I32T((sizeof(struct caer_frame_event) - sizeof(uint16_t))
+						   + (sizeof(uint16_t) * (size_t) maxNumPixels * (size_t) maxChannelNumber));
+	slot->eventTSOffset = I32T(offsetof(struct caer_frame_event, ts_endframe));
+}
+
+// New packet for the translator: sized from the history, but at least
+// 'minCapacity', reusing a recycled packet if possible.
+static inline caerEventPacketHeader containerGenerationPacketAllocate(containerGeneration state,
+	const struct container_generation_packet *slot, int32_t minCapacity, int32_t tsOverflow) {
+	int32_t eventCapacity = containerGenerationPacketCapacity(state, slot->eventType, slot->defaultCapacity);
+
+	// A recycled packet too small for the reservation is grown by the caller,
+	// it then stays large enough for the following reuses.
+	caerEventPacketHeader packet
+		= containerGenerationPacketReuse(state, slot->eventType, eventCapacity, state->packetsSource, tsOverflow);
+	if (packet != NULL) {
+		return (packet);
+	}
+
+	if (eventCapacity < minCapacity) {
+		eventCapacity = minCapacity;
+	}
+
+	return (caerEventPacketAllocate(
+		eventCapacity, state->packetsSource, tsOverflow, slot->eventType, slot->eventSize, slot->eventTSOffset));
+}
+
+static inline int64_t containerGenerationMonotonicNow(void) {
+	struct timespec now;
+	portable_clock_gettime_monotonic(&now);
+
+	return ((I64T(now.tv_sec) * 1000000000LL) + I64T(now.tv_nsec));
+}
+
+// A new container starts: it must be committed by this time at the latest.
+static inline void containerGenerationDeadlineInit(containerGeneration state) {
+	uint32_t maxLatency = U32T(atomic_load_explicit(&state->maxPacketContainerLatency, memory_order_relaxed));
+
+	state->currentPacketContainerDeadline
+		= (maxLatency > 0) ? (containerGenerationMonotonicNow() + (I64T(maxLatency) * 1000)) : (-1);
+}
+
+/**
+ * True if the current container was started longer ago than the maximum
+ * latency, and should be committed regardless of the device timestamps.
+ * Reads the clock, so translators only check this once per buffer, and
+ * when called without data while the device is idle.
+ */
+static inline bool containerGenerationIsLatencyElapsed(containerGeneration state) {
+	if ((state->currentPacketContainer == NULL) || (state->currentPacketContainerDeadline < 0)) {
+		return (false);
 	}
+
+	return (containerGenerationMonotonicNow() >= state->currentPacketContainerDeadline);
 }
 
 static inline bool containerGenerationAllocate(containerGeneration state, int32_t eventPacketNumber) {
 	if (state->currentPacketContainer == NULL) {
+		if (state->poolBuffer != NULL) {
+			state->currentPacketContainer = containerGenerationPoolGet(state, eventPacketNumber);
+
+			if (state->currentPacketContainer != NULL) {
+				atomic_fetch_add_explicit(&state->poolHits, 1, memory_order_relaxed);
+				containerGenerationDeadlineInit(state);
+				return (true);
+			}
+
+			atomic_fetch_add_explicit(&state->poolMisses, 1, memory_order_relaxed);
+		}
+
 		// Allocate packets.
 		state->currentPacketContainer = caerEventPacketContainerAllocate(eventPacketNumber);
 		if (state->currentPacketContainer == NULL) {
 			return (false);
 		}
+
+		containerGenerationDeadlineInit(state);
 	}
 
 	return (true);
@@ -53,6 +442,95 @@ static inline int32_t containerGenerationGetMaxPacketSize(containerGeneration st
 	return (I32T(atomic_load_explicit(&state->maxPacketContainerPacketSize, memory_order_relaxed)));
 }
 
+/**
+ * Make sure the packet at the given container position has space for at
+ * least 'events' more events, growing it if needed.
+ */
+static inline bool containerGenerationPacketReserve(
+	containerGeneration state, int32_t containerPosition, size_t events) {
+	struct container_generation_packet *slot = &state->packets[containerPosition];
+
+	size_t capacity = (size_t) caerEventPacketHeaderGetEventCapacity(*slot->packet);
+	size_t needed   = (size_t) *slot->position + events;
+
+	if (needed <= capacity) {
+		return (true);
+	}
+
+	// Double the capacity, or more if reserving for a whole buffer at once.
+	size_t newCapacity = capacity * 2;
+	if (newCapacity < needed) {
+		newCapacity = needed;
+	}
+
+	caerEventPacketHeader grownPacket = NULL;
+	if (newCapacity <= INT32_MAX) {
+		grownPacket = caerEventPacketGrow(*slot->packet, I32T(newCapacity));
+	}
+
+	if (grownPacket == NULL) {
+		commonLog(CAER_LOG_CRITICAL, state->deviceString,
+			atomic_load_explicit(state->deviceLogLevel, memory_order_relaxed),
+			"Failed to grow event packet of type %d.", slot->eventType);
+		return (false);
+	}
+
+	*slot->packet = grownPacket;
+	containerGenerationPacketGrown(state);
+
+	return (true);
+}
+
+/**
+ * Allocate the container and all the packets taken by the last commit, and
+ * reserve space for all the events the next 'words' input words can generate,
+ * so that translators don't have to check capacity for each event. Called
+ * before translating a buffer, and after commits in the middle of it.
+ */
+static inline bool containerGenerationPacketsAllocate(containerGeneration state, size_t words, int32_t tsOverflow) {
+	if (!containerGenerationAllocate(state, state->packetsNumber)) {
+		commonLog(CAER_LOG_CRITICAL, state->deviceString,
+			atomic_load_explicit(state->deviceLogLevel, memory_order_relaxed),
+			"Failed to allocate event packet container.");
+		return (false);
+	}
+
+	// With a packet size limit, the container is committed as soon as any
+	// packet reaches it, so no packet can ever go much past it.
+	size_t maxPacketSize = (size_t) containerGenerationGetMaxPacketSize(state);
+
+	for (int32_t i = 0; i < state->packetsNumber; i++) {
+		struct container_generation_packet *slot = &state->packets[i];
+
+		if (slot->packet == NULL) {
+			continue;
+		}
+
+		size_t events = words * (size_t) slot->eventsPerWord;
+
+		if ((maxPacketSize > 0) && (events > (maxPacketSize + (size_t) slot->eventsPerWord))) {
+			events = maxPacketSize + (size_t) slot->eventsPerWord;
+		}
+
+		if (*slot->packet == NULL) {
+			*slot->packet = containerGenerationPacketAllocate(
+				state, slot, (events > INT32_MAX) ? (INT32_MAX) : (I32T(events)), tsOverflow);
+			if (*slot->packet == NULL) {
+				commonLog(CAER_LOG_CRITICAL, state->deviceString,
+					atomic_load_explicit(state->deviceLogLevel, memory_order_relaxed),
+					"Failed to allocate event packet of type %d.", slot->eventType);
+				return (false);
+			}
+		}
+
+		if (!containerGenerationPacketReserve(state, i, events)) {
+			return (false);
+		}
+	}
+
+	return (true);
+}
+
 static inline int32_t containerGenerationGetMaxInterval(containerGeneration state) {
 	return (I32T(atomic_load_explicit(&state->maxPacketContainerInterval, memory_order_relaxed)));
 }
@@ -95,7 +573,16 @@ static inline void containerGenerationExecute(containerGeneration state, bool em
 		state->currentPacketContainer = NULL;
 	}
 	else {
-		if (!dataExchangePut(dataState, state->currentPacketContainer)) {
+		// Read everything needed for statistics now, as the container belongs
+		// to the consumer as soon as it's committed.
+		statisticsAddEvents(&dataState->statistics, state->currentPacketContainer);
+		containerGenerationHistoryUpdate(state, state->currentPacketContainer);
+		int64_t commitTimestamp = caerEventPacketContainerGetHighestEventTimestamp(state->currentPacketContainer);
+
+		if (dataExchangePut(dataState, state->currentPacketContainer)) {
+			statisticsContainerCommitted(&dataState->statistics, commitTimestamp, dataExchangeBufferUsage(dataState));
+		}
+		else {
 			// Failed to forward packet container, just drop it, it doesn't contain
 			// any critical information anyway.
 			commonLog(CAER_LOG_NOTICE, deviceString, deviceLogLevel,
@@ -143,8 +630,38 @@ static inline void containerGenerationExecute(containerGeneration state, bool em
 		// Reset MUST be committed, always, else downstream data processing and
 		// outputs get confused if they have no notification of timestamps
 		// jumping back go zero.
+		statisticsAddEvents(&dataState->statistics, tsResetContainer);
+
 		dataExchangePutForce(dataState, transfersRunning, tsResetContainer);
+
+		statisticsContainerCommitted(&dataState->statistics, -1, dataExchangeBufferUsage(dataState));
+	}
+}
+
+/**
+ * Commit all non-empty packets in the current container, and then the
+ * container itself. Empty packets are not forwarded to save memory.
+ */
+static inline void containerGenerationPacketsCommit(containerGeneration state, bool tsReset, int32_t tsWrapOverflow,
+	int32_t tsCurrent, dataExchange dataState, atomic_uint_fast32_t *transfersRunning) {
+	bool emptyContainerCommit = true;
+
+	for (int32_t i = 0; i < state->packetsNumber; i++) {
+		struct container_generation_packet *slot = &state->packets[i];
+
+		if ((slot->packet == NULL) || (*slot->position == 0)) {
+			continue;
+		}
+
+		containerGenerationSetPacket(state, i, *slot->packet);
+
+		*slot->packet        = NULL;
+		*slot->position      = 0;
+		emptyContainerCommit = false;
 	}
+
+	containerGenerationExecute(state, emptyContainerCommit, tsReset, tsWrapOverflow, tsCurrent, dataState,
+		transfersRunning, state->packetsSource, state->deviceString, state->deviceLogLevel);
 }
 
 static inline bool containerGenerationConfigSet(containerGeneration state, uint8_t paramAddr, uint32_t param) {
@@ -157,6 +674,14 @@ static inline bool containerGenerationConfigSet(containerGeneration state, uint8
 			atomic_store(&state->maxPacketContainerInterval, param);
 			break;
 
+		case CAER_HOST_CONFIG_PACKETS_POOL_SIZE:
+			atomic_store(&state->poolSize, param);
+			break;
+
+		case CAER_HOST_CONFIG_PACKETS_MAX_CONTAINER_LATENCY:
+			atomic_store(&state->maxPacketContainerLatency, param);
+			break;
+
 		default:
 			return (false);
 			break;
@@ -166,13 +691,43 @@ static inline bool containerGenerationConfigSet(containerGeneration state, uint8
 }
 
 static inline bool containerGenerationConfigGet(containerGeneration state, uint8_t paramAddr, uint32_t *param) {
+	// 64 bit values are split over two addresses, upper 32 bits first.
+	uint64_t value = 0;
+
 	switch (paramAddr) {
 		case CAER_HOST_CONFIG_PACKETS_MAX_CONTAINER_PACKET_SIZE:
 			*param = U32T(atomic_load(&state->maxPacketContainerPacketSize));
+			return (true);
 			break;
 
 		case CAER_HOST_CONFIG_PACKETS_MAX_CONTAINER_INTERVAL:
 			*param = U32T(atomic_load(&state->maxPacketContainerInterval));
+			return (true);
+			break;
+
+		case CAER_HOST_CONFIG_PACKETS_POOL_SIZE:
+			*param = U32T(atomic_load(&state->poolSize));
+			return (true);
+			break;
+
+		case CAER_HOST_CONFIG_PACKETS_MAX_CONTAINER_LATENCY:
+			*param = U32T(atomic_load(&state->maxPacketContainerLatency));
+			return (true);
+			break;
+
+		case CAER_HOST_CONFIG_PACKETS_POOL_HITS:
+		case CAER_HOST_CONFIG_PACKETS_POOL_HITS + 1:
+			value = U64T(atomic_load_explicit(&state->poolHits, memory_order_relaxed));
+			break;
+
+		case CAER_HOST_CONFIG_PACKETS_POOL_MISSES:
+		case CAER_HOST_CONFIG_PACKETS_POOL_MISSES + 1:
+			value = U64T(atomic_load_explicit(&state->poolMisses, memory_order_relaxed));
+			break;
+
+		case CAER_HOST_CONFIG_PACKETS_GROWS:
+		case CAER_HOST_CONFIG_PACKETS_GROWS + 1:
+			value = U64T(atomic_load_explicit(&state->packetGrows, memory_order_relaxed));
 			break;
 
 		default:
@@ -180,6 +735,9 @@ static inline bool containerGenerationConfigGet(containerGeneration state, uint8
 			break;
 	}
 
+	// All 64 bit values start at even addresses.
+	*param = ((paramAddr & 0x01) == 0) ? (U32T(value >> 32)) : (U32T(value));
+
 	return (true);
 }
 
@@ -6,23 +6,70 @@
 
 #include "libcaer/devices/device.h"
 
+#include "portable_time.h"
+#include "statistics.h"
+
 #include <stdatomic.h>
 
 #if defined(HAVE_PTHREADS)
 #	include "c11threads_posix.h"
 #endif
 
+#if defined(OS_LINUX)
+#	include <sys/eventfd.h>
+#	include <unistd.h>
+#elif defined(OS_UNIX)
+#	include <fcntl.h>
+#	include <unistd.h>
+#endif
+
+// Maximum time a blocking wait sleeps before re-checking if the data
+// transfers are still running (exceptional shutdown detection), in µs.
+#define DATA_EXCHANGE_WAIT_SLICE 100000
+
 enum { THR_IDLE = 0, THR_RUNNING = 1, THR_EXITED = 2 };
 
 struct data_exchange {
-	caerRingBuffer buffer;
-	atomic_uint_fast32_t bufferSize; // Only takes effect on DataStart() calls!
+	caerRingBuffer buffer;    // Consumer side.
+	caerRingBuffer putBuffer; // Producer side.
+	atomic_uint_fast32_t bufferSize;
+	// Live resize: a new buffer is prepared in pendingBuffer, the producer
+	// moves over to it and announces it in nextBuffer, and the consumer
+	// follows once it has emptied the old one, so nothing is reordered.
+	atomic_uintptr_t pendingBuffer;
+	atomic_uintptr_t nextBuffer;
+	atomic_uint_fast32_t bufferUsage;
 	atomic_bool blocking;
+	atomic_uint_fast32_t blockingTimeout;
 	atomic_bool startProducers;
 	atomic_bool stopProducers;
+	atomic_uint_fast32_t overflowPolicy; // Only takes effect on DataStart() calls!
+	// Overflow handling: all policies except drop-newest touch the consumer
+	// side of the buffer from the producer, which then must be serialized.
+	uint32_t overflowPolicyActive;
+	mtx_t bufferLock;
+	caerEventPacketContainer lastPut; // Producer only.
+	atomic_uint_fast64_t droppedNewest;
+	atomic_uint_fast64_t droppedOldest;
+	atomic_uint_fast64_t coalesced;
 	void (*notifyDataIncrease)(void *ptr);
 	void (*notifyDataDecrease)(void *ptr);
 	void *notifyDataUserPtr;
+	struct host_statistics statistics;
+	// Blocking wait support: consumers sleep on waitCond, producers only
+	// signal it when someone is actually waiting.
+	mtx_t waitLock;
+	cnd_t waitCond;
+	atomic_uint_fast32_t waiters;
+	// Consumers inside a get call, or a live resize. On shutdown, no new ones
+	// are let in, and the buffers and the above are only destroyed once all
+	// have left.
+	atomic_bool shutdown;
+	atomic_uint_fast32_t consumers;
+	// Pollable notification file descriptor, created on demand. Readable
+	// as long as there are containers in the buffer.
+	atomic_int notifyFD;
+	atomic_int notifyFDWrite;
 };
 
 typedef struct data_exchange *dataExchange;
@@ -30,8 +77,16 @@ typedef struct data_exchange *dataExchange;
 static inline void dataExchangeSettingsInit(dataExchange state) {
 	atomic_store(&state->bufferSize, 64);
 	atomic_store(&state->blocking, false);
+	atomic_store(&state->blockingTimeout, 1000000);
 	atomic_store(&state->startProducers, true);
 	atomic_store(&state->stopProducers, true);
+	atomic_store(&state->overflowPolicy, CAER_DATAEXCHANGE_OVERFLOW_DROP_NEWEST);
+	atomic_store(&state->notifyFD, -1);
+	atomic_store(&state->notifyFDWrite, -1);
+	atomic_store(&state->shutdown, true);
+	atomic_store(&state->consumers, 0);
+
+	statisticsReset(&state->statistics);
 }
 
 static inline bool dataExchangeBufferInit(dataExchange state) {
@@ -41,85 +96,815 @@ static inline bool dataExchangeBufferInit(dataExchange state) {
 		return (false);
 	}
 
+	// Initialize blocking wait support. Lives as long as the buffer.
+	if (mtx_init(&state->waitLock, mtx_plain) != thrd_success) {
+		caerRingBufferFree(state->buffer);
+		state->buffer = NULL;
+		return (false);
+	}
+
+#if defined(HAVE_PTHREADS)
+	if (cnd_init_monotonic(&state->waitCond) != thrd_success) {
+#else
+	if (cnd_init(&state->waitCond) != thrd_success) {
+#endif
+		mtx_destroy(&state->waitLock);
+		caerRingBufferFree(state->buffer);
+		state->buffer = NULL;
+		return (false);
+	}
+
+	if (mtx_init(&state->bufferLock, mtx_plain) != thrd_success) {
+		cnd_destroy(&state->waitCond);
+		mtx_destroy(&state->waitLock);
+		caerRingBufferFree(state->buffer);
+		state->buffer = NULL;
+		return (false);
+	}
+
+	state->putBuffer = state->buffer;
+	atomic_store(&state->pendingBuffer, (uintptr_t) NULL);
+	atomic_store(&state->nextBuffer, (uintptr_t) NULL);
+	atomic_store(&state->bufferUsage, 0);
+
+	atomic_store(&state->waiters, 0);
+
+	state->overflowPolicyActive = U32T(atomic_load(&state->overflowPolicy));
+	state->lastPut              = NULL;
+
+	atomic_store(&state->droppedNewest, 0);
+	atomic_store(&state->droppedOldest, 0);
+	atomic_store(&state->coalesced, 0);
+
+	// Let consumers in.
+	atomic_store(&state->shutdown, false);
+
+	return (true);
+}
+
+/**
+ * Register a consumer for the duration of a get call or a live resize. Fails
+ * once shutdown has begun, the buffers must not be touched anymore then.
+ */
+static inline bool dataExchangeConsumerEnter(dataExchange state) {
+	atomic_fetch_add(&state->consumers, 1);
+
+	if (atomic_load(&state->shutdown)) {
+		atomic_fetch_sub(&state->consumers, 1);
+		return (false);
+	}
+
 	return (true);
 }
 
+static inline void dataExchangeConsumerLeave(dataExchange state) {
+	atomic_fetch_sub(&state->consumers, 1);
+}
+
+static inline void dataExchangeCondWait(dataExchange state, const struct timespec *duration) {
+#if defined(HAVE_PTHREADS)
+	cnd_timedwait_relative(&state->waitCond, &state->waitLock, duration);
+#else
+	// C11 only has wall-clock timeouts, a clock change affects this one wait.
+	struct timespec timePoint;
+	portable_clock_gettime_realtime(&timePoint);
+
+	timePoint.tv_sec += duration->tv_sec;
+	timePoint.tv_nsec += duration->tv_nsec;
+
+	if (timePoint.tv_nsec >= 1000000000) {
+		timePoint.tv_sec++;
+		timePoint.tv_nsec -= 1000000000;
+	}
+
+	cnd_timedwait(&state->waitCond, &state->waitLock, &timePoint);
+#endif
+}
+
+/**
+ * Stop letting consumers in, wake up the ones blocked waiting for data,
+ * and wait until all of them have left. Consumers don't signal when they
+ * leave, as the lock may be gone by then, so re-check periodically.
+ */
+static inline void dataExchangeShutdown(dataExchange state) {
+	atomic_store(&state->shutdown, true);
+
+	const struct timespec recheck = {.tv_sec = 0, .tv_nsec = 1000000};
+
+	mtx_lock(&state->waitLock);
+
+	while (atomic_load(&state->consumers) > 0) {
+		cnd_broadcast(&state->waitCond);
+		dataExchangeCondWait(state, &recheck);
+	}
+
+	mtx_unlock(&state->waitLock);
+}
+
+static inline void dataExchangeFDClose(int notifyFD, int notifyFDWrite) {
+#if defined(OS_LINUX) || defined(OS_UNIX)
+	if (notifyFDWrite != notifyFD) {
+		close(notifyFDWrite);
+	}
+
+	close(notifyFD);
+#else
+	(void) (notifyFD);      // UNUSED.
+	(void) (notifyFDWrite); // UNUSED.
+#endif
+}
+
 static inline void dataExchangeDestroy(dataExchange state) {
 	if (state->buffer != NULL) {
+		dataExchangeShutdown(state);
+	}
+
+	int notifyFD = atomic_exchange(&state->notifyFD, -1);
+	if (notifyFD >= 0) {
+		dataExchangeFDClose(notifyFD, atomic_exchange(&state->notifyFDWrite, -1));
+	}
+
+	if (state->buffer != NULL) {
+		caerRingBuffer pendingBuffer = (caerRingBuffer) atomic_exchange(&state->pendingBuffer, (uintptr_t) NULL);
+		if (pendingBuffer != NULL) {
+			caerRingBufferFree(pendingBuffer);
+		}
+
+		// Producer already moved to a new buffer, that the consumer hasn't
+		// followed yet. Free it too.
+		if (state->putBuffer != state->buffer) {
+			caerRingBufferFree(state->putBuffer);
+		}
+
+		state->putBuffer = NULL;
+		atomic_store(&state->nextBuffer, (uintptr_t) NULL);
+
+		mtx_destroy(&state->bufferLock);
+		cnd_destroy(&state->waitCond);
+		mtx_destroy(&state->waitLock);
+
 		caerRingBufferFree(state->buffer);
 		state->buffer = NULL;
 	}
 }
 
+static inline void dataExchangeBufferLock(dataExchange state) {
+	if (state->overflowPolicyActive != CAER_DATAEXCHANGE_OVERFLOW_DROP_NEWEST) {
+		mtx_lock(&state->bufferLock);
+	}
+}
+
+static inline void dataExchangeBufferUnlock(dataExchange state) {
+	if (state->overflowPolicyActive != CAER_DATAEXCHANGE_OVERFLOW_DROP_NEWEST) {
+		mtx_unlock(&state->bufferLock);
+	}
+}
+
+/**
+ * Consumer side of a live resize: follow the producer to its new buffer,
+ * once the old one has been fully emptied. The producer announces the new
+ * buffer only after its last put into the old one, so an empty old buffer
+ * will stay empty from here on.
+ */
+static inline void dataExchangeBufferFollow(dataExchange state) {
+	caerRingBuffer nextBuffer = (caerRingBuffer) atomic_load_explicit(&state->nextBuffer, memory_order_acquire);
+
+	if ((nextBuffer == NULL) || !caerRingBufferEmpty(state->buffer)) {
+		return;
+	}
+
+	caerRingBufferFree(state->buffer);
+	state->buffer = nextBuffer;
+
+	// Allow the producer to move on again.
+	atomic_store_explicit(&state->nextBuffer, (uintptr_t) NULL, memory_order_release);
+}
+
+/**
+ * Producer side of a live resize: move over to a prepared new buffer. Only
+ * one resize can be in flight, so wait for the consumer to have followed
+ * the previous one first.
+ */
+static inline void dataExchangeBufferMove(dataExchange state) {
+	if (atomic_load_explicit(&state->pendingBuffer, memory_order_relaxed) == (uintptr_t) NULL) {
+		return;
+	}
+
+	if (atomic_load_explicit(&state->nextBuffer, memory_order_acquire) != (uintptr_t) NULL) {
+		return;
+	}
+
+	caerRingBuffer pendingBuffer
+		= (caerRingBuffer) atomic_exchange_explicit(&state->pendingBuffer, (uintptr_t) NULL, memory_order_acquire);
+	if (pendingBuffer == NULL) {
+		return;
+	}
+
+	state->putBuffer = pendingBuffer;
+
+	atomic_store_explicit(&state->nextBuffer, (uintptr_t) pendingBuffer, memory_order_release);
+}
+
+static inline bool dataExchangeBufferResize(dataExchange state, uint32_t size) {
+	caerRingBuffer newBuffer = caerRingBufferInit(size);
+	if (newBuffer == NULL) {
+		return (false);
+	}
+
+	// A previous resize may not have been picked up by the producer yet,
+	// in that case this one replaces it.
+	caerRingBuffer oldPendingBuffer
+		= (caerRingBuffer) atomic_exchange_explicit(&state->pendingBuffer, (uintptr_t) newBuffer, memory_order_acq_rel);
+	if (oldPendingBuffer != NULL) {
+		caerRingBufferFree(oldPendingBuffer);
+	}
+
+	return (true);
+}
+
+static inline bool dataExchangeBufferIsEmpty(dataExchange state) {
+	dataExchangeBufferLock(state);
+	dataExchangeBufferFollow(state);
+	bool empty = caerRingBufferEmpty(state->buffer);
+	dataExchangeBufferUnlock(state);
+
+	return (empty);
+}
+
+/**
+ * Emptiness check that doesn't touch the buffers, usable from any thread.
+ * The usage is raised before a container becomes visible and lowered only
+ * after it was taken out, so it never reports empty while data is queued.
+ */
+static inline bool dataExchangeBufferIsUnused(dataExchange state) {
+	return (atomic_load_explicit(&state->bufferUsage, memory_order_relaxed) == 0);
+}
+
+static inline void dataExchangeFDSignal(dataExchange state) {
+	int notifyFDWrite = atomic_load_explicit(&state->notifyFDWrite, memory_order_relaxed);
+	if (notifyFDWrite < 0) {
+		return;
+	}
+
+#if defined(OS_LINUX)
+	uint64_t increment = 1;
+	ssize_t res        = write(notifyFDWrite, &increment, sizeof(increment));
+#elif defined(OS_UNIX)
+	// A full pipe means it's readable already, so failures can be ignored.
+	uint8_t increment = 1;
+	ssize_t res       = write(notifyFDWrite, &increment, sizeof(increment));
+#else
+	ssize_t res = 0;
+#endif
+	(void) (res); // UNUSED.
+}
+
+static inline void dataExchangeFDDrain(dataExchange state) {
+	if (atomic_load_explicit(&state->notifyFD, memory_order_relaxed) < 0) {
+		return;
+	}
+
+	// Reset the notification first, then check if anything is left: a commit
+	// racing with this either happens before the check, and we signal again,
+	// or after the reset, and the producer signals.
+#if defined(OS_LINUX)
+	uint64_t counter;
+	ssize_t res = read(atomic_load_explicit(&state->notifyFD, memory_order_relaxed), &counter, sizeof(counter));
+	(void) (res); // UNUSED.
+#elif defined(OS_UNIX)
+	uint8_t drain[64];
+	while (read(atomic_load_explicit(&state->notifyFD, memory_order_relaxed), drain, sizeof(drain)) > 0) {
+		;
+	}
+#endif
+
+	if (!dataExchangeBufferIsUnused(state)) {
+		dataExchangeFDSignal(state);
+	}
+}
+
+static inline int dataExchangeGetFD(dataExchange state) {
+	int notifyFD = atomic_load(&state->notifyFD);
+	if (notifyFD >= 0) {
+		return (notifyFD);
+	}
+
+	// Only available while data transfers are running.
+	if (!dataExchangeConsumerEnter(state)) {
+		return (-1);
+	}
+
+	int notifyFDWrite = -1;
+
+#if defined(OS_LINUX)
+	notifyFD = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+	if (notifyFD < 0) {
+		dataExchangeConsumerLeave(state);
+		return (-1);
+	}
+
+	notifyFDWrite = notifyFD;
+#elif defined(OS_UNIX)
+	int pipeFDs[2];
+	if (pipe(pipeFDs) != 0) {
+		dataExchangeConsumerLeave(state);
+		return (-1);
+	}
+
+	for (size_t i = 0; i < 2; i++) {
+		fcntl(pipeFDs[i], F_SETFL, fcntl(pipeFDs[i], F_GETFL) | O_NONBLOCK);
+		fcntl(pipeFDs[i], F_SETFD, FD_CLOEXEC);
+	}
+
+	notifyFD      = pipeFDs[0];
+	notifyFDWrite = pipeFDs[1];
+#else
+	dataExchangeConsumerLeave(state);
+	return (-1);
+#endif
+
+	// Concurrent callers: only one file descriptor is published, the
+	// others are closed again and the published one is returned.
+	int publishedFD = -1;
+	if (!atomic_compare_exchange_strong(&state->notifyFD, &publishedFD, notifyFD)) {
+		dataExchangeFDClose(notifyFD, notifyFDWrite);
+		dataExchangeConsumerLeave(state);
+		return (publishedFD);
+	}
+
+	atomic_store(&state->notifyFDWrite, notifyFDWrite);
+	atomic_thread_fence(memory_order_seq_cst);
+
+	// Containers may have been committed before the producer could see
+	// the new file descriptor.
+	if (!dataExchangeBufferIsUnused(state)) {
+		dataExchangeFDSignal(state);
+	}
+
+	dataExchangeConsumerLeave(state);
+
+	return (notifyFD);
+}
+
+static inline void dataExchangeNotifyWaiters(dataExchange state) {
+	// Order the preceding ring-buffer put before reading the number of waiters.
+	// Pairs with the fence in dataExchangeWait(): either the consumer sees the
+	// new container when re-checking, or we see it waiting and wake it up.
+	atomic_thread_fence(memory_order_seq_cst);
+
+	dataExchangeFDSignal(state);
+
+	if (atomic_load_explicit(&state->waiters, memory_order_relaxed) > 0) {
+		mtx_lock(&state->waitLock);
+		cnd_broadcast(&state->waitCond);
+		mtx_unlock(&state->waitLock);
+	}
+}
+
+static inline void dataExchangeWaitEndInit(dataExchange state, struct timespec *waitEnd) {
+	uint32_t timeout = U32T(atomic_load_explicit(&state->blockingTimeout, memory_order_relaxed));
+
+	// Zero timeout means no limit, signaled by a zero end time.
+	if (timeout == 0) {
+		waitEnd->tv_sec  = 0;
+		waitEnd->tv_nsec = 0;
+		return;
+	}
+
+	portable_clock_gettime_monotonic(waitEnd);
+
+	waitEnd->tv_sec += timeout / 1000000;
+	waitEnd->tv_nsec += (long) (timeout % 1000000) * 1000;
+
+	if (waitEnd->tv_nsec >= 1000000000) {
+		waitEnd->tv_sec++;
+		waitEnd->tv_nsec -= 1000000000;
+	}
+}
+
+static inline bool dataExchangeTimeReached(const struct timespec *now, const struct timespec *end) {
+	return ((now->tv_sec > end->tv_sec) || ((now->tv_sec == end->tv_sec) && (now->tv_nsec >= end->tv_nsec)));
+}
+
+/**
+ * Wait for new data to be committed, or until waitEnd is reached.
+ * waitEnd is on the monotonic clock, so that wall-clock changes don't
+ * affect the timeout. Returns true if the caller should try to get data
+ * again, false if the wait timed out, data transfers are not running
+ * anymore, or shutdown has begun.
+ */
+static inline bool dataExchangeWait(
+	dataExchange state, atomic_uint_fast32_t *transfersRunning, const struct timespec *waitEnd) {
+	if ((atomic_load(transfersRunning) != THR_RUNNING) || atomic_load(&state->shutdown)) {
+		return (false);
+	}
+
+	struct timespec now;
+	portable_clock_gettime_monotonic(&now);
+
+	bool waitEndLimit = ((waitEnd->tv_sec != 0) || (waitEnd->tv_nsec != 0));
+
+	if (waitEndLimit && dataExchangeTimeReached(&now, waitEnd)) {
+		return (false);
+	}
+
+	// Never sleep longer than a slice, so that an exceptional shutdown, which
+	// doesn't signal the condition variable, is detected in reasonable time.
+	struct timespec slice = {.tv_sec = 0, .tv_nsec = DATA_EXCHANGE_WAIT_SLICE * 1000L};
+
+	if (waitEndLimit) {
+		struct timespec remaining = {.tv_sec = waitEnd->tv_sec - now.tv_sec, .tv_nsec = waitEnd->tv_nsec - now.tv_nsec};
+
+		if (remaining.tv_nsec < 0) {
+			remaining.tv_sec--;
+			remaining.tv_nsec += 1000000000;
+		}
+
+		if (dataExchangeTimeReached(&slice, &remaining)) {
+			slice = remaining;
+		}
+	}
+
+	atomic_fetch_add(&state->waiters, 1);
+	atomic_thread_fence(memory_order_seq_cst);
+
+	mtx_lock(&state->waitLock);
+
+	// Check again while holding the lock: a container committed before we
+	// registered as a waiter would not wake us up anymore.
+	if (dataExchangeBufferIsEmpty(state) && (atomic_load(transfersRunning) == THR_RUNNING)
+		&& !atomic_load(&state->shutdown)) {
+		dataExchangeCondWait(state, &slice);
+	}
+
+	mtx_unlock(&state->waitLock);
+
+	atomic_fetch_sub(&state->waiters, 1);
+
+	return (true);
+}
+
 static inline caerEventPacketContainer dataExchangeGet(dataExchange state, atomic_uint_fast32_t *transfersRunning) {
 	caerEventPacketContainer container = NULL;
-	uint32_t sleepCounter              = 0;
+	struct timespec waitEnd            = {.tv_sec = 0, .tv_nsec = 0};
+	bool waitEndInit                   = false;
+
+	if (!dataExchangeConsumerEnter(state)) {
+		return (NULL);
+	}
 
 retry:
+	dataExchangeBufferLock(state);
+	dataExchangeBufferFollow(state);
 	container = caerRingBufferGet(state->buffer);
+	dataExchangeBufferUnlock(state);
 
 	if (container != NULL) {
+		atomic_fetch_sub_explicit(&state->bufferUsage, 1, memory_order_relaxed);
+
+		dataExchangeFDDrain(state);
+
 		// Found an event container, return it and signal this piece of data
 		// is no longer available for later acquisition.
 		if (state->notifyDataDecrease != NULL) {
 			state->notifyDataDecrease(state->notifyDataUserPtr);
 		}
 
+		dataExchangeConsumerLeave(state);
+
 		return (container);
 	}
 
-	// Didn't find any event container, either report this or retry, depending
-	// on blocking setting. Every 1000 sleeps (so ~1s) we return, to avoid possible
-	// dead-lock on this function.
-	if (atomic_load_explicit(&state->blocking, memory_order_relaxed) && (atomic_load(transfersRunning) == THR_RUNNING)
-		&& (sleepCounter < 1000)) {
-		// Don't retry right away in a tight loop, back off and wait a little.
-		// If no data is available, sleep for a millisecond to avoid wasting resources.
-		struct timespec noDataSleep = {.tv_sec = 0, .tv_nsec = 1000000};
-		if (thrd_sleep(&noDataSleep, NULL) == 0) {
-			sleepCounter++;
+	// Didn't find any event container, either report this or wait for a new
+	// one to be committed, depending on blocking setting. The wait is bounded
+	// by the blocking timeout, to avoid possible dead-lock on this function.
+	if (atomic_load_explicit(&state->blocking, memory_order_relaxed)) {
+		if (!waitEndInit) {
+			dataExchangeWaitEndInit(state, &waitEnd);
+			waitEndInit = true;
+		}
+
+		if (dataExchangeWait(state, transfersRunning, &waitEnd)) {
 			goto retry;
 		}
 	}
 
+	dataExchangeConsumerLeave(state);
+
 	// Nothing.
 	return (NULL);
 }
 
-static inline bool dataExchangePut(dataExchange state, caerEventPacketContainer container) {
-	if (!caerRingBufferPut(state->buffer, container)) {
+static inline size_t dataExchangeGetMany(dataExchange state, atomic_uint_fast32_t *transfersRunning,
+	caerEventPacketContainer *containers, size_t containersNumber) {
+	size_t containersGot    = 0;
+	struct timespec waitEnd = {.tv_sec = 0, .tv_nsec = 0};
+	bool waitEndInit        = false;
+
+	if (containersNumber == 0) {
+		return (0);
+	}
+
+	if (!dataExchangeConsumerEnter(state)) {
+		return (0);
+	}
+
+retry:
+	dataExchangeBufferLock(state);
+	dataExchangeBufferFollow(state);
+	containersGot = caerRingBufferGetMany(state->buffer, (void **) containers, containersNumber);
+	dataExchangeBufferUnlock(state);
+
+	if (containersGot > 0) {
+		atomic_fetch_sub_explicit(&state->bufferUsage, containersGot, memory_order_relaxed);
+
+		dataExchangeFDDrain(state);
+
+		// Found event containers, return them and signal these pieces of data
+		// are no longer available for later acquisition.
+		if (state->notifyDataDecrease != NULL) {
+			for (size_t i = 0; i < containersGot; i++) {
+				state->notifyDataDecrease(state->notifyDataUserPtr);
+			}
+		}
+
+		dataExchangeConsumerLeave(state);
+
+		return (containersGot);
+	}
+
+	// Same blocking behavior as dataExchangeGet(): block only until at least
+	// one container is available, then return whatever is there.
+	if (atomic_load_explicit(&state->blocking, memory_order_relaxed)) {
+		if (!waitEndInit) {
+			dataExchangeWaitEndInit(state, &waitEnd);
+			waitEndInit = true;
+		}
+
+		if (dataExchangeWait(state, transfersRunning, &waitEnd)) {
+			goto retry;
+		}
+	}
+
+	dataExchangeConsumerLeave(state);
+
+	// Nothing.
+	return (0);
+}
+
+/**
+ * Merge all packets of container into queued, if they are compatible and
+ * there is enough memory. On success, container is freed. On failure, it
+ * is not touched, and neither are the queued events (their packets may
+ * have grown, that's all).
+ */
+static inline bool dataExchangeCoalesce(caerEventPacketContainer queued, caerEventPacketContainer container) {
+	int32_t packetsNumber = caerEventPacketContainerGetEventPacketsNumber(container);
+
+	if (caerEventPacketContainerGetEventPacketsNumber(queued) != packetsNumber) {
 		return (false);
 	}
+
+	// Check everything first, so that either all packets are merged or none.
+	for (int32_t i = 0; i < packetsNumber; i++) {
+		caerEventPacketHeader queuedPacket = caerEventPacketContainerGetEventPacket(queued, i);
+		caerEventPacketHeader packet       = caerEventPacketContainerGetEventPacket(container, i);
+
+		if ((queuedPacket == NULL) || (packet == NULL)) {
+			continue;
+		}
+
+		if ((caerEventPacketHeaderGetEventType(queuedPacket) != caerEventPacketHeaderGetEventType(packet))
+			|| (caerEventPacketHeaderGetEventSize(queuedPacket) != caerEventPacketHeaderGetEventSize(packet))
+			|| (caerEventPacketHeaderGetEventTSOverflow(queuedPacket)
+				!= caerEventPacketHeaderGetEventTSOverflow(packet))) {
+			return (false);
+		}
+	}
+
+	// Make space for all packets first, as that's the only step that can
+	// fail, so that either all packets are merged or none.
+	for (int32_t i = 0; i < packetsNumber; i++) {
+		caerEventPacketHeader queuedPacket = caerEventPacketContainerGetEventPacket(queued, i);
+		caerEventPacketHeader packet       = caerEventPacketContainerGetEventPacket(container, i);
+
+		if ((queuedPacket == NULL) || (packet == NULL)) {
+			continue;
+		}
+
+		int32_t queuedCapacity = caerEventPacketHeaderGetEventCapacity(queuedPacket);
+
+		if ((queuedCapacity - caerEventPacketHeaderGetEventNumber(queuedPacket))
+			>= caerEventPacketHeaderGetEventNumber(packet)) {
+			continue;
+		}
+
+		caerEventPacketHeader grownPacket
+			= caerEventPacketGrow(queuedPacket, queuedCapacity + caerEventPacketHeaderGetEventCapacity(packet));
+		if (grownPacket == NULL) {
+			caerLog(CAER_LOG_ERROR, "Data Exchange",
+				"Failed to grow queued packet for coalescing, dropping new container instead.");
+			return (false);
+		}
+
+		caerEventPacketContainerSetEventPacket(queued, i, grownPacket);
+	}
+
+	for (int32_t i = 0; i < packetsNumber; i++) {
+		caerEventPacketHeader queuedPacket = caerEventPacketContainerGetEventPacket(queued, i);
+		caerEventPacketHeader packet       = caerEventPacketContainerGetEventPacket(container, i);
+
+		if (packet == NULL) {
+			continue;
+		}
+
+		if (queuedPacket == NULL) {
+			// Just move the packet over.
+			caerEventPacketContainerSetEventPacket(queued, i, packet);
+			caerEventPacketContainerSetEventPacket(container, i, NULL);
+			continue;
+		}
+
+		// Append events into the free space.
+		int32_t queuedNumber = caerEventPacketHeaderGetEventNumber(queuedPacket);
+		int32_t packetNumber = caerEventPacketHeaderGetEventNumber(packet);
+		size_t eventSize     = (size_t) caerEventPacketHeaderGetEventSize(packet);
+
+		memcpy(((uint8_t *) queuedPacket) + CAER_EVENT_PACKET_HEADER_SIZE + ((size_t) queuedNumber * eventSize),
+			((uint8_t *) packet) + CAER_EVENT_PACKET_HEADER_SIZE, (size_t) packetNumber * eventSize);
+
+		caerEventPacketHeaderSetEventValid(queuedPacket,
+			caerEventPacketHeaderGetEventValid(queuedPacket) + caerEventPacketHeaderGetEventValid(packet));
+		caerEventPacketHeaderSetEventNumber(queuedPacket, queuedNumber + packetNumber);
+
+		// Update the container statistics.
+		caerEventPacketContainerSetEventPacket(queued, i, queuedPacket);
+	}
+
+	caerEventPacketContainerFree(container);
+
+	return (true);
+}
+
+/**
+ * Apply the overflow policy to a container that didn't fit into the
+ * full buffer. Returns true if it was committed (or merged into the
+ * newest queued container), false if it has to be dropped.
+ */
+static inline bool dataExchangePutOverflow(
+	dataExchange state, caerEventPacketContainer container, bool *committed) {
+	caerEventPacketContainer oldest = NULL;
+	bool success                    = false;
+
+	*committed = false;
+
+	mtx_lock(&state->bufferLock);
+
+	// The consumer could have made space in the meantime.
+	if (caerRingBufferPut(state->putBuffer, container)) {
+		*committed = true;
+		success    = true;
+	}
+	else if (state->overflowPolicyActive == CAER_DATAEXCHANGE_OVERFLOW_DROP_OLDEST) {
+		// Buffer is full and the consumer is locked out: the oldest
+		// container is there to take, and then the put must succeed.
+		// During a resize, the oldest is still in the old buffer, if
+		// the consumer hasn't emptied it yet. The first container of
+		// the new buffer then moves over to the old one, to make space
+		// in the new one while keeping the order.
+		if (state->buffer != state->putBuffer) {
+			oldest = caerRingBufferGet(state->buffer);
+
+			if (oldest != NULL) {
+				caerRingBufferPut(state->buffer, caerRingBufferGet(state->putBuffer));
+			}
+		}
+
+		if (oldest == NULL) {
+			oldest = caerRingBufferGet(state->putBuffer);
+		}
+
+		caerRingBufferPut(state->putBuffer, container);
+
+		*committed = true;
+		success    = true;
+	}
 	else {
-		if (state->notifyDataIncrease != NULL) {
-			state->notifyDataIncrease(state->notifyDataUserPtr);
+		// Buffer is full and the consumer is locked out: the newest queued
+		// container is the last one we put, and it can safely be modified.
+		success = dataExchangeCoalesce(state->lastPut, container);
+	}
+
+	mtx_unlock(&state->bufferLock);
+
+	if (oldest != NULL) {
+		atomic_fetch_add(&state->droppedOldest, 1);
+		atomic_fetch_sub_explicit(&state->bufferUsage, 1, memory_order_relaxed);
+		statisticsContainerDropped(&state->statistics);
+
+		if (state->notifyDataDecrease != NULL) {
+			state->notifyDataDecrease(state->notifyDataUserPtr);
 		}
 
-		return (true);
+		caerEventPacketContainerFree(oldest);
 	}
+	else if (success && !*committed) {
+		atomic_fetch_add(&state->coalesced, 1);
+	}
+	else if (!success) {
+		atomic_fetch_add(&state->droppedNewest, 1);
+		statisticsContainerDropped(&state->statistics);
+	}
+
+	return (success);
+}
+
+static inline bool dataExchangePut(dataExchange state, caerEventPacketContainer container) {
+	dataExchangeBufferMove(state);
+
+	// Account for the new container before it becomes visible to the consumer,
+	// so that the usage never goes below zero.
+	atomic_fetch_add_explicit(&state->bufferUsage, 1, memory_order_relaxed);
+
+	if (!caerRingBufferPut(state->putBuffer, container)) {
+		if (state->overflowPolicyActive == CAER_DATAEXCHANGE_OVERFLOW_DROP_NEWEST) {
+			atomic_fetch_sub_explicit(&state->bufferUsage, 1, memory_order_relaxed);
+			atomic_fetch_add(&state->droppedNewest, 1);
+			statisticsContainerDropped(&state->statistics);
+			return (false);
+		}
+
+		bool committed = false;
+		bool success   = dataExchangePutOverflow(state, container, &committed);
+
+		if (!committed) {
+			atomic_fetch_sub_explicit(&state->bufferUsage, 1, memory_order_relaxed);
+
+			// Dropped, or merged into an already queued container, which
+			// means there is nothing new to signal.
+			return (success);
+		}
+	}
+
+	state->lastPut = container;
+
+	dataExchangeNotifyWaiters(state);
+
+	if (state->notifyDataIncrease != NULL) {
+		state->notifyDataIncrease(state->notifyDataUserPtr);
+	}
+
+	return (true);
 }
 
 static inline void dataExchangePutForce(
 	dataExchange state, atomic_uint_fast32_t *transfersRunning, caerEventPacketContainer container) {
-	while (!caerRingBufferPut(state->buffer, container)) {
+	dataExchangeBufferMove(state);
+
+	atomic_fetch_add_explicit(&state->bufferUsage, 1, memory_order_relaxed);
+
+	while (!caerRingBufferPut(state->putBuffer, container)) {
 		// Prevent dead-lock if shutdown is requested and nothing is consuming
 		// data anymore, but the ring-buffer is full (and would thus never empty),
 		// thus blocking the USB handling thread in this loop.
 		if (atomic_load(transfersRunning) != THR_RUNNING) {
+			atomic_fetch_sub_explicit(&state->bufferUsage, 1, memory_order_relaxed);
 			return;
 		}
 	}
 
 	// Signal new container as usual.
+	state->lastPut = container;
+
+	dataExchangeNotifyWaiters(state);
+
 	if (state->notifyDataIncrease != NULL) {
 		state->notifyDataIncrease(state->notifyDataUserPtr);
 	}
 }
 
 static inline void dataExchangeBufferEmpty(dataExchange state) {
-	// Empty ringbuffer.
-	caerEventPacketContainer container;
-	while ((container = caerRingBufferGet(state->buffer)) != NULL) {
+	if (state->buffer == NULL) {
+		return;
+	}
+
+	// Data transfers are stopped at this point, wake up any blocked
+	// consumer, also through the notification file descriptor, and wait
+	// for all of them to return, as emptying the buffer is consumer work.
+	dataExchangeNotifyWaiters(state);
+	dataExchangeShutdown(state);
+
+	// Empty ringbuffer, following the producer through any resize.
+	while (true) {
+		dataExchangeBufferFollow(state);
+
+		caerEventPacketContainer container = caerRingBufferGet(state->buffer);
+		if (container == NULL) {
+			break;
+		}
+
+		atomic_fetch_sub_explicit(&state->bufferUsage, 1, memory_order_relaxed);
+
 		// Notify data-not-available call-back.
 		if (state->notifyDataDecrease != NULL) {
 			state->notifyDataDecrease(state->notifyDataUserPtr);
@@ -130,6 +915,10 @@ static inline void dataExchangeBufferEmpty(dataExchange state) {
 	}
 }
 
+static inline uint32_t dataExchangeBufferUsage(dataExchange state) {
+	return (U32T(atomic_load_explicit(&state->bufferUsage, memory_order_relaxed)));
+}
+
 static inline void dataExchangeSetNotify(dataExchange state, void (*dataNotifyIncrease)(void *ptr),
 	void (*dataNotifyDecrease)(void *ptr), void *dataNotifyUserPtr) {
 	state->notifyDataIncrease = dataNotifyIncrease;
@@ -148,6 +937,24 @@ static inline bool dataExchangeStopProducers(dataExchange state) {
 static inline bool dataExchangeConfigSet(dataExchange state, uint8_t paramAddr, uint32_t param) {
 	switch (paramAddr) {
 		case CAER_HOST_CONFIG_DATAEXCHANGE_BUFFER_SIZE:
+			// Ring-buffers only support power of two sizes.
+			if ((param == 0) || ((param & (param - 1)) != 0)) {
+				return (false);
+			}
+
+			// While running, resize the buffer live, keeping all queued data.
+			// Registered like a consumer, so that a concurrent shutdown
+			// waits for the new buffer to be installed, and then frees it.
+			if (dataExchangeConsumerEnter(state)) {
+				bool resized = dataExchangeBufferResize(state, param);
+
+				dataExchangeConsumerLeave(state);
+
+				if (!resized) {
+					return (false);
+				}
+			}
+
 			atomic_store(&state->bufferSize, param);
 			break;
 
@@ -155,6 +962,10 @@ static inline bool dataExchangeConfigSet(dataExchange state, uint8_t paramAddr,
 			atomic_store(&state->blocking, param);
 			break;
 
+		case CAER_HOST_CONFIG_DATAEXCHANGE_BLOCKING_TIMEOUT:
+			atomic_store(&state->blockingTimeout, param);
+			break;
+
 		case CAER_HOST_CONFIG_DATAEXCHANGE_START_PRODUCERS:
 			atomic_store(&state->startProducers, param);
 			break;
@@ -163,6 +974,14 @@ static inline bool dataExchangeConfigSet(dataExchange state, uint8_t paramAddr,
 			atomic_store(&state->stopProducers, param);
 			break;
 
+		case CAER_HOST_CONFIG_DATAEXCHANGE_OVERFLOW_POLICY:
+			if (param > CAER_DATAEXCHANGE_OVERFLOW_COALESCE) {
+				return (false);
+			}
+
+			atomic_store(&state->overflowPolicy, param);
+			break;
+
 		default:
 			return (false);
 			break;
@@ -171,6 +990,12 @@ static inline bool dataExchangeConfigSet(dataExchange state, uint8_t paramAddr,
 	return (true);
 }
 
+// 64 bit values are split over two addresses, upper 32 bits first, so that
+// they can be read with caerDeviceConfigGet64(). They start at even addresses.
+static inline uint32_t dataExchangeConfigGet64Part(uint64_t value, uint8_t paramAddr) {
+	return (((paramAddr & 0x01) == 0) ? (U32T(value >> 32)) : (U32T(value)));
+}
+
 static inline bool dataExchangeConfigGet(dataExchange state, uint8_t paramAddr, uint32_t *param) {
 	switch (paramAddr) {
 		case CAER_HOST_CONFIG_DATAEXCHANGE_BUFFER_SIZE:
@@ -181,6 +1006,10 @@ static inline bool dataExchangeConfigGet(dataExchange state, uint8_t paramAddr,
 			*param = atomic_load(&state->blocking);
 			break;
 
+		case CAER_HOST_CONFIG_DATAEXCHANGE_BLOCKING_TIMEOUT:
+			*param = U32T(atomic_load(&state->blockingTimeout));
+			break;
+
 		case CAER_HOST_CONFIG_DATAEXCHANGE_START_PRODUCERS:
 			*param = atomic_load(&state->startProducers);
 			break;
@@ -189,6 +1018,25 @@ static inline bool dataExchangeConfigGet(dataExchange state, uint8_t paramAddr,
 			*param = atomic_load(&state->stopProducers);
 			break;
 
+		case CAER_HOST_CONFIG_DATAEXCHANGE_OVERFLOW_POLICY:
+			*param = U32T(atomic_load(&state->overflowPolicy));
+			break;
+
+		case CAER_HOST_CONFIG_DATAEXCHANGE_DROPPED_NEWEST:
+		case CAER_HOST_CONFIG_DATAEXCHANGE_DROPPED_NEWEST + 1:
+			*param = dataExchangeConfigGet64Part(U64T(atomic_load(&state->droppedNewest)), paramAddr);
+			break;
+
+		case CAER_HOST_CONFIG_DATAEXCHANGE_DROPPED_OLDEST:
+		case CAER_HOST_CONFIG_DATAEXCHANGE_DROPPED_OLDEST + 1:
+			*param = dataExchangeConfigGet64Part(U64T(atomic_load(&state->droppedOldest)), paramAddr);
+			break;
+
+		case CAER_HOST_CONFIG_DATAEXCHANGE_COALESCED:
+		case CAER_HOST_CONFIG_DATAEXCHANGE_COALESCED + 1:
+			*param = dataExchangeConfigGet64Part(U64T(atomic_load(&state->coalesced)), paramAddr);
+			break;
+
 		default:
 			return (false);
 			break;
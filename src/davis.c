@@ -342,6 +342,12 @@ bool davisConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr, uin
 		// Also set standard device log-level.
 		return (davisCommonConfigSet(&handle->cHandle, CAER_HOST_CONFIG_LOG, CAER_HOST_CONFIG_LOG_LEVEL, param));
 	}
+	else if (modAddr == CAER_HOST_CONFIG_PACKETS && paramAddr == CAER_HOST_CONFIG_PACKETS_MAX_CONTAINER_LATENCY) {
+		// Wake up often enough to commit on time, even without new data.
+		usbSetDataIdleInterval(&handle->usbState, param);
+
+		return (davisCommonConfigSet(&handle->cHandle, modAddr, paramAddr, param));
+	}
 	else if (modAddr == DAVIS_CONFIG_USB) {
 		switch (paramAddr) {
 			case DAVIS_CONFIG_USB_RUN:
@@ -504,6 +510,25 @@ caerEventPacketContainer davisDataGet(caerDeviceHandle cdh) {
 	return (dataExchangeGet(&handle->cHandle.state.dataExchange, &handle->usbState.dataTransfersRun));
 }
 
+size_t davisDataGetMany(caerDeviceHandle cdh, caerEventPacketContainer *containers, size_t containersNumber) {
+	davisHandle handle = (davisHandle) cdh;
+
+	return (dataExchangeGetMany(
+		&handle->cHandle.state.dataExchange, &handle->usbState.dataTransfersRun, containers, containersNumber));
+}
+
+int davisDataGetFD(caerDeviceHandle cdh) {
+	davisHandle handle = (davisHandle) cdh;
+
+	return (dataExchangeGetFD(&handle->cHandle.state.dataExchange));
+}
+
+void davisDataRecycle(caerDeviceHandle cdh, caerEventPacketContainer container) {
+	davisHandle handle = (davisHandle) cdh;
+
+	containerGenerationRecycle(&handle->cHandle.state.container, container);
+}
+
 static void davisEventTranslator(void *vhd, const uint8_t *buffer, size_t bytesSent) {
 	davisHandle handle = (davisHandle) vhd;
 
@@ -522,6 +547,11 @@ static void davisEventTranslator(void *vhd, const uint8_t *buffer, size_t bytesS
 /// FX3 Debug Transfer Support ///
 //////////////////////////////////
 static void allocateDebugTransfers(davisHandle handle) {
+	// No debug channel when replaying a capture file.
+	if (usbReplayActive(&handle->usbState)) {
+		return;
+	}
+
 	// Allocate transfers and set them up.
 	for (size_t i = 0; i < DEBUG_TRANSFER_NUM; i++) {
 		handle->fx3Support.debugTransfers[i] = libusb_alloc_transfer(0);
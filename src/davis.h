@@ -58,5 +58,8 @@ bool davisDataStart(caerDeviceHandle handle, void (*dataNotifyIncrease)(void *pt
 	void *dataShutdownUserPtr);
 bool davisDataStop(caerDeviceHandle handle);
 caerEventPacketContainer davisDataGet(caerDeviceHandle handle);
+size_t davisDataGetMany(caerDeviceHandle handle, caerEventPacketContainer *containers, size_t containersNumber);
+int davisDataGetFD(caerDeviceHandle handle);
+void davisDataRecycle(caerDeviceHandle handle, caerEventPacketContainer container);
 
 #endif /* LIBCAER_SRC_DAVIS_H_ */
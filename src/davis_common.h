@@ -32,6 +32,9 @@
 
 #define APS_ADC_DEPTH 10
 
+// Marks second samples not received, device samples are at most 13 bits.
+#define APS_SAMPLE_MISSING 0xFFFF
+
 #define DVS_HOTPIXEL_HW_MAX 8
 
 #define IMU_TYPE_TEMP   0x01
@@ -59,6 +62,9 @@ struct davis_common_state {
 		uint16_t sizeX;
 		uint16_t sizeY;
 		bool invertXY;
+		// Where the device's X and Y addresses go in polarity events, swapped by invertXY.
+		uint8_t xAddrShift;
+		uint8_t yAddrShift;
 		struct {
 			atomic_bool autoTrainRunning;
 			caerFilterDVSNoise noiseFilter;
@@ -81,6 +87,10 @@ struct davis_common_state {
 		struct {
 			caerFrameEvent currentEvent;
 			atomic_uint_fast8_t mode;
+			atomic_bool deferredCDS;
+			// Deferred CDS of the current frame: second samples, CDS done at frame end.
+			bool deferredCDSActive;
+			uint16_t *secondSamples;
 #if APS_DEBUG_FRAME == 1
 			uint16_t *resetPixels;
 			uint16_t *signalPixels;
@@ -97,9 +107,12 @@ struct davis_common_state {
 			uint16_t sizeY;
 		} roi;
 		struct {
-			bool offsetDirection; // 0 is increasing, 1 is decreasing.
-			int16_t offset;
-		} cDavisSupport;
+			// Frame pixel index of a readout position, from flip, invert and ROI settings:
+			// base + (countX * strideX) + offsetsY[countY]. Updated only on ROI changes.
+			int32_t base;
+			int32_t strideX;
+			int32_t *offsetsY;
+		} pixelIndex;
 		struct {
 			uint8_t tmpData;
 			uint32_t currentFrameExposure;
@@ -195,37 +208,6 @@ static void davisLog(enum caer_log_level logLevel, davisCommonHandle handle, con
 static inline void freeAllDataMemory(davisCommonState state) {
 	dataExchangeDestroy(&state->dataExchange);
 
-	// Since the current event packets aren't necessarily
-	// already assigned to the current packet container, we
-	// free them separately from it.
-	if (state->currentPackets.polarity != NULL) {
-		free(&state->currentPackets.polarity->packetHeader);
-		state->currentPackets.polarity = NULL;
-
-		containerGenerationSetPacket(&state->container, POLARITY_EVENT, NULL);
-	}
-
-	if (state->currentPackets.special != NULL) {
-		free(&state->currentPackets.special->packetHeader);
-		state->currentPackets.special = NULL;
-
-		containerGenerationSetPacket(&state->container, SPECIAL_EVENT, NULL);
-	}
-
-	if (state->currentPackets.frame != NULL) {
-		free(&state->currentPackets.frame->packetHeader);
-		state->currentPackets.frame = NULL;
-
-		containerGenerationSetPacket(&state->container, FRAME_EVENT, NULL);
-	}
-
-	if (state->currentPackets.imu6 != NULL) {
-		free(&state->currentPackets.imu6->packetHeader);
-		state->currentPackets.imu6 = NULL;
-
-		containerGenerationSetPacket(&state->container, IMU6_EVENT, NULL);
-	}
-
 	containerGenerationDestroy(&state->container);
 
 	if (state->aps.frame.currentEvent != NULL) {
@@ -233,6 +215,16 @@ static inline void freeAllDataMemory(davisCommonState state) {
 		state->aps.frame.currentEvent = NULL;
 	}
 
+	if (state->aps.frame.secondSamples != NULL) {
+		free(state->aps.frame.secondSamples);
+		state->aps.frame.secondSamples = NULL;
+	}
+
+	if (state->aps.pixelIndex.offsetsY != NULL) {
+		free(state->aps.pixelIndex.offsetsY);
+		state->aps.pixelIndex.offsetsY = NULL;
+	}
+
 #if APS_DEBUG_FRAME == 1
 	if (state->aps.frame.resetPixels != NULL) {
 		free(state->aps.frame.resetPixels);
@@ -246,24 +238,6 @@ static inline void freeAllDataMemory(davisCommonState state) {
 #endif
 }
 
-static inline bool ensureSpaceForEvents(
-	caerEventPacketHeader *packet, size_t position, size_t numEvents, davisCommonHandle handle) {
-	if ((position + numEvents) <= (size_t) caerEventPacketHeaderGetEventCapacity(*packet)) {
-		return (true);
-	}
-
-	caerEventPacketHeader grownPacket
-		= caerEventPacketGrow(*packet, caerEventPacketHeaderGetEventCapacity(*packet) * 2);
-	if (grownPacket == NULL) {
-		davisLog(CAER_LOG_CRITICAL, handle, "Failed to grow event packet of type %d.",
-			caerEventPacketHeaderGetEventType(*packet));
-		return (false);
-	}
-
-	*packet = grownPacket;
-	return (true);
-}
-
 static inline void apsInitFrame(davisCommonHandle handle) {
 	davisCommonState state = &handle->state;
 
@@ -279,19 +253,34 @@ static inline void apsInitFrame(davisCommonHandle handle) {
 		state->aps.countY[i] = 0;
 	}
 
+	// Deferred CDS, decided per frame. The sample buffer is only allocated on first use.
+	state->aps.frame.deferredCDSActive = atomic_load_explicit(&state->aps.frame.deferredCDS, memory_order_relaxed);
+
+	size_t pixelsNumber = (size_t) state->aps.sizeX * (size_t) state->aps.sizeY;
+
+	if (state->aps.frame.deferredCDSActive && (state->aps.frame.secondSamples == NULL)) {
+		state->aps.frame.secondSamples = malloc(pixelsNumber * sizeof(uint16_t));
+		if (state->aps.frame.secondSamples == NULL) {
+			davisLog(CAER_LOG_ERROR, handle, "Failed to allocate APS deferred CDS memory, doing CDS per pixel.");
+			state->aps.frame.deferredCDSActive = false;
+		}
+	}
+
+	if (state->aps.frame.deferredCDSActive) {
+		// All bytes 0xFF is APS_SAMPLE_MISSING.
+		memset(state->aps.frame.secondSamples, 0xFF, pixelsNumber * sizeof(uint16_t));
+	}
+
 	// Write out start of frame timestamp.
 	caerFrameEventSetTSStartOfFrame(state->aps.frame.currentEvent, state->timestamps.current);
 
 	// Send APS info event out (as special event).
-	if (ensureSpaceForEvents((caerEventPacketHeader *) &state->currentPackets.special,
-			(size_t) state->currentPackets.specialPosition, 1, handle)) {
-		caerSpecialEvent currentSpecialEvent
-			= caerSpecialEventPacketGetEvent(state->currentPackets.special, state->currentPackets.specialPosition);
-		caerSpecialEventSetTimestamp(currentSpecialEvent, state->timestamps.current);
-		caerSpecialEventSetType(currentSpecialEvent, APS_FRAME_START);
-		caerSpecialEventValidate(currentSpecialEvent, state->currentPackets.special);
-		state->currentPackets.specialPosition++;
-	}
+	caerSpecialEvent currentSpecialEvent
+		= caerSpecialEventPacketGetEvent(state->currentPackets.special, state->currentPackets.specialPosition);
+	caerSpecialEventSetTimestamp(currentSpecialEvent, state->timestamps.current);
+	caerSpecialEventSetType(currentSpecialEvent, APS_FRAME_START);
+	caerSpecialEventValidate(currentSpecialEvent, state->currentPackets.special);
+	state->currentPackets.specialPosition++;
 }
 
 static inline void apsROIUpdateSizes(davisCommonHandle handle) {
@@ -341,27 +330,108 @@ static inline void apsROIUpdateSizes(davisCommonHandle handle) {
 		state->aps.expectedCountX = state->aps.roi.sizeX;
 		state->aps.expectedCountY = state->aps.roi.sizeY;
 	}
-}
 
-static inline void apsUpdateFrame(davisCommonHandle handle, uint16_t data) {
-	davisCommonState state = &handle->state;
+	// Resolve flip and invert once here, instead of on every pixel. The readout
+	// X/Y counts move along the frame's rows, or along its columns if inverted.
+	int32_t rowStride = state->aps.roi.sizeX;
+	int32_t strideX   = (state->aps.invertXY) ? (rowStride) : (1);
+	int32_t strideY   = (state->aps.invertXY) ? (1) : (rowStride);
 
-	uint16_t xPos = (state->aps.flipX)
-						? (U16T(state->aps.expectedCountX - 1 - state->aps.countX[state->aps.currentReadoutType]))
-						: (state->aps.countX[state->aps.currentReadoutType]);
-	uint16_t yPos = (state->aps.flipY)
-						? (U16T(state->aps.expectedCountY - 1 - state->aps.countY[state->aps.currentReadoutType]))
-						: (state->aps.countY[state->aps.currentReadoutType]);
+	state->aps.pixelIndex.base = 0;
 
-	if (IS_DAVIS640H(handle->info.chipID)) {
-		yPos = U16T(yPos + state->aps.cDavisSupport.offset);
+	if (state->aps.flipX) {
+		state->aps.pixelIndex.base += (state->aps.expectedCountX - 1) * strideX;
+		strideX = -strideX;
 	}
 
-	if (state->aps.invertXY) {
-		SWAP_VAR(uint16_t, xPos, yPos);
+	if (state->aps.flipY) {
+		state->aps.pixelIndex.base += (state->aps.expectedCountY - 1) * strideY;
+		strideY = -strideY;
+	}
+
+	state->aps.pixelIndex.strideX = strideX;
+
+	// Offsets along Y, from the position in the column, which also resolve the
+	// DAVIS640H readout order: first 320 pixels are even, then odd. This adds
+	// 1, 2, 3 ... to the position up to 320, then 318, 315, 312 ... after flipping.
+	bool cDavis           = IS_DAVIS640H(handle->info.chipID);
+	int32_t cDavisStride  = (state->aps.invertXY) ? (1) : (rowStride);
+	int32_t cDavisOffset  = 1; // First pixel of row always even.
+	bool cDavisDecreasing = false;
+
+	for (int32_t countY = 0; countY < state->aps.expectedCountY; countY++) {
+		state->aps.pixelIndex.offsetsY[countY] = (countY * strideY) + ((cDavis) ? (cDavisOffset * cDavisStride) : (0));
+
+		if (cDavisDecreasing) {
+			cDavisOffset -= 3;
+		}
+		else if (cDavisOffset == 320) {
+			// Switch to decreasing after last even pixel.
+			cDavisDecreasing = true;
+			cDavisOffset     = 318;
+		}
+		else {
+			cDavisOffset++;
+		}
+	}
+}
+
+// Correlated double sampling of one pixel, normalized to 16 bit depth.
+static inline uint16_t apsPixelCDS(uint16_t resetValue, uint16_t signalValue) {
+	// Do CDS.
+	int32_t pixelValue = resetValue - signalValue;
+
+	// Check for underflow.
+	pixelValue = (pixelValue < 0) ? (0) : (pixelValue);
+
+	// Check for overflow.
+	pixelValue = (pixelValue > 1023) ? (1023) : (pixelValue);
+
+	// If the signal value is 0, that is only possible if the camera
+	// has seen tons of light. In that case, the photo-diode current
+	// may be greater than the reset current, and the reset value
+	// never goes back up fully, which results in black spots where
+	// there is too much light. This confuses algorithms, so we filter
+	// this out here by setting the pixel to white in that case.
+	// Another effect of the same thing is the reset value not going
+	// back up to a decent value, so we also filter that out here.
+	pixelValue = ((resetValue < 384) || (signalValue == 0)) ? (1023) : (pixelValue);
+
+	// Normalize the ADC value to 16bit generic depth. This depends on ADC used.
+	return (U16T(pixelValue << (16 - APS_ADC_DEPTH)));
+}
+
+/**
+ * Deferred CDS: the first sample of each pixel is in the frame, as with
+ * per-pixel CDS, the second one in 'secondSamples'. Pixels whose second
+ * sample is missing keep their first one, like with per-pixel CDS.
+ * Written without data-dependent branches, so the loop can be vectorized.
+ */
+static inline void apsDeferredCDS(
+	uint16_t *pixels, const uint16_t *secondSamples, size_t pixelsNumber, bool isCDavisGS) {
+	for (size_t i = 0; i < pixelsNumber; i++) {
+		uint16_t firstSample  = pixels[i];
+		uint16_t secondSample = secondSamples[i];
+
+		// DAVIS640H GS has inverted samples, signal read comes first.
+		uint16_t resetValue  = (isCDavisGS) ? (secondSample) : (firstSample);
+		uint16_t signalValue = (isCDavisGS) ? (firstSample) : (secondSample);
+
+		uint16_t pixelValue = htole16(apsPixelCDS(resetValue, signalValue));
+
+		pixels[i] = (secondSample == APS_SAMPLE_MISSING) ? (firstSample) : (pixelValue);
 	}
+}
+
+static inline void apsUpdateFrame(davisCommonHandle handle, uint16_t data) {
+	davisCommonState state = &handle->state;
+
+	int32_t countX = state->aps.countX[state->aps.currentReadoutType];
+	int32_t countY = state->aps.countY[state->aps.currentReadoutType];
 
-	size_t pixelPosition = (size_t)(yPos * state->aps.roi.sizeX) + xPos;
+	// Flip, invert and DAVIS640H readout order are precomputed, see apsROIUpdateSizes().
+	size_t pixelPosition = (size_t) (state->aps.pixelIndex.base + (countX * state->aps.pixelIndex.strideX)
+									 + state->aps.pixelIndex.offsetsY[countY]);
 
 	// Standard CDS support.
 	bool isCDavisGS = (IS_DAVIS640H(handle->info.chipID) && state->aps.globalShutter);
@@ -370,6 +440,10 @@ static inline void apsUpdateFrame(davisCommonHandle handle, uint16_t data) {
 		|| ((state->aps.currentReadoutType == APS_READOUT_SIGNAL) && isCDavisGS)) {
 		state->aps.frame.currentEvent->pixels[pixelPosition] = data;
 	}
+	else if (state->aps.frame.deferredCDSActive) {
+		// Done for the whole frame in apsEndFrame().
+		state->aps.frame.secondSamples[pixelPosition] = data;
+	}
 	else {
 		uint16_t resetValue  = 0;
 		uint16_t signalValue = 0;
@@ -385,50 +459,7 @@ static inline void apsUpdateFrame(davisCommonHandle handle, uint16_t data) {
 			signalValue = data;
 		}
 
-		int32_t pixelValue = 0;
-
-		if ((resetValue < 384) || (signalValue == 0)) {
-			// If the signal value is 0, that is only possible if the camera
-			// has seen tons of light. In that case, the photo-diode current
-			// may be greater than the reset current, and the reset value
-			// never goes back up fully, which results in black spots where
-			// there is too much light. This confuses algorithms, so we filter
-			// this out here by setting the pixel to white in that case.
-			// Another effect of the same thing is the reset value not going
-			// back up to a decent value, so we also filter that out here.
-			pixelValue = 1023;
-		}
-		else {
-			// Do CDS.
-			pixelValue = resetValue - signalValue;
-
-			// Check for underflow.
-			pixelValue = (pixelValue < 0) ? (0) : (pixelValue);
-
-			// Check for overflow.
-			pixelValue = (pixelValue > 1023) ? (1023) : (pixelValue);
-		}
-
-		// Normalize the ADC value to 16bit generic depth. This depends on ADC used.
-		pixelValue = pixelValue << (16 - APS_ADC_DEPTH);
-
-		state->aps.frame.currentEvent->pixels[pixelPosition] = htole16(U16T(pixelValue));
-	}
-
-	// DAVIS640H support: first 320 pixels are even, then odd.
-	if (IS_DAVIS640H(handle->info.chipID)) {
-		if (state->aps.cDavisSupport.offsetDirection == 0) { // Increasing
-			state->aps.cDavisSupport.offset++;
-
-			if (state->aps.cDavisSupport.offset == 321) {
-				// Switch to decreasing after last even pixel.
-				state->aps.cDavisSupport.offsetDirection = 1;
-				state->aps.cDavisSupport.offset          = 318;
-			}
-		}
-		else { // Decreasing
-			state->aps.cDavisSupport.offset = I16T(state->aps.cDavisSupport.offset - 3);
-		}
+		state->aps.frame.currentEvent->pixels[pixelPosition] = htole16(apsPixelCDS(resetValue, signalValue));
 	}
 
 // Separate debug support.
@@ -471,19 +502,23 @@ static inline bool apsEndFrame(davisCommonHandle handle) {
 		}
 	}
 
+	// Pixels are laid out as the ROI, see apsROIUpdateSizes(), so the rest of the frame is unused.
+	if (state->aps.frame.deferredCDSActive) {
+		apsDeferredCDS(caerFrameEventGetPixelArrayUnsafe(state->aps.frame.currentEvent), state->aps.frame.secondSamples,
+			(size_t) state->aps.roi.sizeX * (size_t) state->aps.roi.sizeY,
+			(IS_DAVIS640H(handle->info.chipID) && state->aps.globalShutter));
+	}
+
 	// Write out end of frame timestamp.
 	caerFrameEventSetTSEndOfFrame(state->aps.frame.currentEvent, state->timestamps.current);
 
 	// Send APS info event out (as special event).
-	if (ensureSpaceForEvents((caerEventPacketHeader *) &state->currentPackets.special,
-			(size_t) state->currentPackets.specialPosition, 1, handle)) {
-		caerSpecialEvent currentSpecialEvent
-			= caerSpecialEventPacketGetEvent(state->currentPackets.special, state->currentPackets.specialPosition);
-		caerSpecialEventSetTimestamp(currentSpecialEvent, state->timestamps.current);
-		caerSpecialEventSetType(currentSpecialEvent, APS_FRAME_END);
-		caerSpecialEventValidate(currentSpecialEvent, state->currentPackets.special);
-		state->currentPackets.specialPosition++;
-	}
+	caerSpecialEvent currentSpecialEvent
+		= caerSpecialEventPacketGetEvent(state->currentPackets.special, state->currentPackets.specialPosition);
+	caerSpecialEventSetTimestamp(currentSpecialEvent, state->timestamps.current);
+	caerSpecialEventSetType(currentSpecialEvent, APS_FRAME_END);
+	caerSpecialEventValidate(currentSpecialEvent, state->currentPackets.special);
+	state->currentPackets.specialPosition++;
 
 	return (validFrame);
 }
@@ -579,10 +614,16 @@ static void davisCommonInit(davisCommonHandle handle) {
 	if (state->dvs.invertXY) {
 		handle->info.dvsSizeX = I16T(state->dvs.sizeY);
 		handle->info.dvsSizeY = I16T(state->dvs.sizeX);
+
+		state->dvs.xAddrShift = POLARITY_Y_ADDR_SHIFT;
+		state->dvs.yAddrShift = POLARITY_X_ADDR_SHIFT;
 	}
 	else {
 		handle->info.dvsSizeX = I16T(state->dvs.sizeX);
 		handle->info.dvsSizeY = I16T(state->dvs.sizeY);
+
+		state->dvs.xAddrShift = POLARITY_X_ADDR_SHIFT;
+		state->dvs.yAddrShift = POLARITY_Y_ADDR_SHIFT;
 	}
 
 	spiConfigReceive(handle->spiConfigPtr, DAVIS_CONFIG_APS, DAVIS_CONFIG_APS_SIZE_COLUMNS, &param32);
@@ -695,6 +736,7 @@ static bool davisCommonSendDefaultFPGAConfig(davisCommonHandle handle) {
 	davisCommonConfigSet(handle, DAVIS_CONFIG_APS, DAVIS_CONFIG_APS_END_ROW_0, U32T(handle->info.apsSizeY - 1));
 	davisCommonConfigSet(handle, DAVIS_CONFIG_APS, DAVIS_CONFIG_APS_AUTOEXPOSURE, false);
 	davisCommonConfigSet(handle, DAVIS_CONFIG_APS, DAVIS_CONFIG_APS_FRAME_MODE, APS_FRAME_DEFAULT);
+	davisCommonConfigSet(handle, DAVIS_CONFIG_APS, DAVIS_CONFIG_APS_DEFERRED_CDS, false);
 	davisCommonConfigSet(
 		handle, DAVIS_CONFIG_APS, DAVIS_CONFIG_APS_EXPOSURE, 4000); // in µs, converted to cycles @ ADCClock later
 	davisCommonConfigSet(handle, DAVIS_CONFIG_APS, DAVIS_CONFIG_APS_FRAME_INTERVAL,
@@ -1063,6 +1105,10 @@ static bool davisCommonConfigSet(davisCommonHandle handle, int8_t modAddr, uint8
 			return (containerGenerationConfigSet(&state->container, paramAddr, param));
 			break;
 
+		case CAER_HOST_CONFIG_STATISTICS:
+			return (statisticsConfigSet(&state->dataExchange.statistics, paramAddr, param));
+			break;
+
 		case CAER_HOST_CONFIG_LOG:
 			switch (paramAddr) {
 				case CAER_HOST_CONFIG_LOG_LEVEL:
@@ -1294,6 +1340,10 @@ static bool davisCommonConfigSet(davisCommonHandle handle, int8_t modAddr, uint8
 					atomic_store(&state->aps.frame.mode, U8T(param));
 					break;
 
+				case DAVIS_CONFIG_APS_DEFERRED_CDS:
+					atomic_store(&state->aps.frame.deferredCDS, param);
+					break;
+
 				default:
 					return (false);
 					break;
@@ -1597,6 +1647,10 @@ static bool davisCommonConfigGet(davisCommonHandle handle, int8_t modAddr, uint8
 			return (containerGenerationConfigGet(&state->container, paramAddr, param));
 			break;
 
+		case CAER_HOST_CONFIG_STATISTICS:
+			return (statisticsConfigGet(&state->dataExchange.statistics, paramAddr, param));
+			break;
+
 		case CAER_HOST_CONFIG_LOG:
 			switch (paramAddr) {
 				case CAER_HOST_CONFIG_LOG_LEVEL:
@@ -1838,6 +1892,10 @@ static bool davisCommonConfigGet(davisCommonHandle handle, int8_t modAddr, uint8
 					*param = atomic_load(&state->aps.frame.mode);
 					break;
 
+				case DAVIS_CONFIG_APS_DEFERRED_CDS:
+					*param = atomic_load(&state->aps.frame.deferredCDS);
+					break;
+
 				default:
 					return (false);
 					break;
@@ -2151,46 +2209,29 @@ static bool davisCommonDataStart(davisCommonHandle handle, void (*dataNotifyIncr
 		return (false);
 	}
 
-	// Allocate packets.
-	if (!containerGenerationAllocate(&state->container, DAVIS_EVENT_TYPES)) {
-		freeAllDataMemory(state);
-
-		davisLog(CAER_LOG_CRITICAL, handle, "Failed to allocate event packet container.");
-		return (false);
-	}
-
-	state->currentPackets.polarity
-		= caerPolarityEventPacketAllocate(DAVIS_POLARITY_DEFAULT_SIZE, I16T(handle->info.deviceID), 0);
-	if (state->currentPackets.polarity == NULL) {
-		freeAllDataMemory(state);
-
-		davisLog(CAER_LOG_CRITICAL, handle, "Failed to allocate polarity event packet.");
-		return (false);
-	}
-
-	state->currentPackets.special
-		= caerSpecialEventPacketAllocate(DAVIS_SPECIAL_DEFAULT_SIZE, I16T(handle->info.deviceID), 0);
-	if (state->currentPackets.special == NULL) {
-		freeAllDataMemory(state);
-
-		davisLog(CAER_LOG_CRITICAL, handle, "Failed to allocate special event packet.");
-		return (false);
-	}
-
-	state->currentPackets.frame = caerFrameEventPacketAllocate(DAVIS_FRAME_DEFAULT_SIZE, I16T(handle->info.deviceID), 0,
-		handle->info.apsSizeX, handle->info.apsSizeY, (handle->info.apsColorFilter == MONO) ? (GRAYSCALE) : (RGB));
-	if (state->currentPackets.frame == NULL) {
+	// Prepare container recycling pool.
+	if (!containerGenerationPoolInit(&state->container)) {
 		freeAllDataMemory(state);
 
-		davisLog(CAER_LOG_CRITICAL, handle, "Failed to allocate frame event packet.");
+		davisLog(CAER_LOG_CRITICAL, handle, "Failed to initialize event packet container pool.");
 		return (false);
 	}
 
-	state->currentPackets.imu6 = caerIMU6EventPacketAllocate(DAVIS_IMU_DEFAULT_SIZE, I16T(handle->info.deviceID), 0);
-	if (state->currentPackets.imu6 == NULL) {
+	// Allocate packets.
+	containerGenerationPacketsInit(&state->container, DAVIS_EVENT_TYPES, I16T(handle->info.deviceID),
+		handle->info.deviceString, &state->deviceLogLevel);
+	containerGenerationPacketsAdd(&state->container, POLARITY_EVENT, POLARITY_EVENT, &state->currentPackets.polarity,
+		&state->currentPackets.polarityPosition, DAVIS_POLARITY_DEFAULT_SIZE, 1);
+	containerGenerationPacketsAdd(&state->container, SPECIAL_EVENT, SPECIAL_EVENT, &state->currentPackets.special,
+		&state->currentPackets.specialPosition, DAVIS_SPECIAL_DEFAULT_SIZE, 1);
+	containerGenerationPacketsAddFrame(&state->container, FRAME_EVENT, &state->currentPackets.frame,
+		&state->currentPackets.framePosition, DAVIS_FRAME_DEFAULT_SIZE, handle->info.apsSizeX * handle->info.apsSizeY,
+		(handle->info.apsColorFilter == MONO) ? (GRAYSCALE) : (RGB));
+	containerGenerationPacketsAdd(&state->container, IMU6_EVENT, IMU6_EVENT, &state->currentPackets.imu6,
+		&state->currentPackets.imu6Position, DAVIS_IMU_DEFAULT_SIZE, 0);
+
+	if (!containerGenerationPacketsAllocate(&state->container, 0, 0)) {
 		freeAllDataMemory(state);
-
-		davisLog(CAER_LOG_CRITICAL, handle, "Failed to allocate IMU6 event packet.");
 		return (false);
 	}
 
@@ -2210,6 +2251,18 @@ static bool davisCommonDataStart(davisCommonHandle handle, void (*dataNotifyIncr
 	caerFrameEventSetColorFilter(state->aps.frame.currentEvent, handle->info.apsColorFilter);
 	caerFrameEventSetROIIdentifier(state->aps.frame.currentEvent, 0);
 
+	// Pixel index offsets along Y, one per pixel of the longest possible column.
+	size_t offsetsYNumber
+		= (state->aps.sizeX > state->aps.sizeY) ? ((size_t) state->aps.sizeX) : ((size_t) state->aps.sizeY);
+
+	state->aps.pixelIndex.offsetsY = calloc(offsetsYNumber, sizeof(int32_t));
+	if (state->aps.pixelIndex.offsetsY == NULL) {
+		freeAllDataMemory(state);
+
+		davisLog(CAER_LOG_CRITICAL, handle, "Failed to allocate APS pixel index memory.");
+		return (false);
+	}
+
 #if APS_DEBUG_FRAME == 1
 	state->aps.frame.resetPixels = calloc((size_t)(state->aps.sizeX * state->aps.sizeY), sizeof(uint16_t));
 	if (state->aps.frame.resetPixels == NULL) {
@@ -2257,60 +2310,136 @@ static void davisCommonDataStop(davisCommonHandle handle) {
 
 #define TS_WRAP_ADD 0x8000
 
-static void davisCommonEventTranslator(
-	davisCommonHandle handle, const uint8_t *buffer, size_t bufferSize, atomic_uint_fast32_t *transfersRunning) {
+// Run pixel filter auto-train on the polarity events about to be committed.
+static void davisCommonPixelFilterAutoTrain(davisCommonHandle handle) {
 	davisCommonState state = &handle->state;
 
-	// Truncate off any extra partial event.
-	if ((bufferSize & 0x01) != 0) {
-		davisLog(CAER_LOG_ALERT, handle, "%zu bytes received, which is not a multiple of two.", bufferSize);
-		bufferSize &= ~((size_t) 0x01);
-	}
+	// Run pixel filter auto-train. Can only be enabled if hw-filter present.
+	if (atomic_load_explicit(&state->dvs.pixelFilterAutoTrain.autoTrainRunning, memory_order_relaxed)) {
+		if (state->dvs.pixelFilterAutoTrain.noiseFilter == NULL) {
+			state->dvs.pixelFilterAutoTrain.noiseFilter
+				= caerFilterDVSNoiseInitialize(U16T(handle->info.dvsSizeX), U16T(handle->info.dvsSizeY));
+			if (state->dvs.pixelFilterAutoTrain.noiseFilter == NULL) {
+				// Failed to initialize, auto-training not possible.
+				atomic_store(&state->dvs.pixelFilterAutoTrain.autoTrainRunning, false);
+				goto out;
+			}
 
-	for (size_t bufferPos = 0; bufferPos < bufferSize; bufferPos += 2) {
-		// Allocate new packets for next iteration as needed.
-		if (!containerGenerationAllocate(&state->container, DAVIS_EVENT_TYPES)) {
-			davisLog(CAER_LOG_CRITICAL, handle, "Failed to allocate event packet container.");
-			return;
+			// Allocate+init success, configure it for hot-pixel learning.
+			caerFilterDVSNoiseConfigSet(
+				state->dvs.pixelFilterAutoTrain.noiseFilter, CAER_FILTER_DVS_HOTPIXEL_COUNT, 1000);
+			caerFilterDVSNoiseConfigSet(
+				state->dvs.pixelFilterAutoTrain.noiseFilter, CAER_FILTER_DVS_HOTPIXEL_TIME, 1000000);
+			caerFilterDVSNoiseConfigSet(
+				state->dvs.pixelFilterAutoTrain.noiseFilter, CAER_FILTER_DVS_HOTPIXEL_LEARN, true);
 		}
 
-		if (state->currentPackets.special == NULL) {
-			state->currentPackets.special = caerSpecialEventPacketAllocate(
-				DAVIS_SPECIAL_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
-			if (state->currentPackets.special == NULL) {
-				davisLog(CAER_LOG_CRITICAL, handle, "Failed to allocate special event packet.");
-				return;
+		// NoiseFilter must be allocated and initialized if we get here.
+		caerFilterDVSNoiseApply(state->dvs.pixelFilterAutoTrain.noiseFilter, state->currentPackets.polarity);
+
+		uint64_t stillLearning = 1;
+		caerFilterDVSNoiseConfigGet(
+			state->dvs.pixelFilterAutoTrain.noiseFilter, CAER_FILTER_DVS_HOTPIXEL_LEARN, &stillLearning);
+
+		if (!stillLearning) {
+			// Learning done, we can grab the list of hot pixels, and hardware-filter them.
+			caerFilterDVSPixel hotPixels;
+			ssize_t hotPixelsSize
+				= caerFilterDVSNoiseGetHotPixels(state->dvs.pixelFilterAutoTrain.noiseFilter, &hotPixels);
+			if (hotPixelsSize < 0) {
+				// Failed to get list.
+				atomic_store(&state->dvs.pixelFilterAutoTrain.autoTrainRunning, false);
+				goto out;
 			}
-		}
 
-		if (state->currentPackets.polarity == NULL) {
-			state->currentPackets.polarity = caerPolarityEventPacketAllocate(
-				DAVIS_POLARITY_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
-			if (state->currentPackets.polarity == NULL) {
-				davisLog(CAER_LOG_CRITICAL, handle, "Failed to allocate polarity event packet.");
-				return;
+			// Limit to maximum hardware size.
+			if (hotPixelsSize > DVS_HOTPIXEL_HW_MAX) {
+				hotPixelsSize = DVS_HOTPIXEL_HW_MAX;
 			}
-		}
 
-		if (state->currentPackets.frame == NULL) {
-			state->currentPackets.frame = caerFrameEventPacketAllocate(DAVIS_FRAME_DEFAULT_SIZE,
-				I16T(handle->info.deviceID), state->timestamps.wrapOverflow, handle->info.apsSizeX,
-				handle->info.apsSizeY, (handle->info.apsColorFilter == MONO) ? (GRAYSCALE) : (RGB));
-			if (state->currentPackets.frame == NULL) {
-				davisLog(CAER_LOG_CRITICAL, handle, "Failed to allocate frame event packet.");
-				return;
+			// Go through the found pixels and filter them. Disable not used slots.
+			size_t i = 0;
+
+			for (; i < (size_t) hotPixelsSize; i++) {
+				spiConfigSendAsync(handle->spiConfigPtr, DAVIS_CONFIG_DVS,
+					U8T(DAVIS_CONFIG_DVS_FILTER_PIXEL_0_COLUMN + 2 * i),
+					(state->dvs.invertXY) ? (hotPixels[i].y) : (hotPixels[i].x), NULL, NULL);
+				spiConfigSendAsync(handle->spiConfigPtr, DAVIS_CONFIG_DVS,
+					U8T(DAVIS_CONFIG_DVS_FILTER_PIXEL_0_ROW + 2 * i),
+					(state->dvs.invertXY) ? (hotPixels[i].x) : (hotPixels[i].y), NULL, NULL);
 			}
-		}
 
-		if (state->currentPackets.imu6 == NULL) {
-			state->currentPackets.imu6 = caerIMU6EventPacketAllocate(
-				DAVIS_IMU_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
-			if (state->currentPackets.imu6 == NULL) {
-				davisLog(CAER_LOG_CRITICAL, handle, "Failed to allocate IMU6 event packet.");
-				return;
+			for (; i < DVS_HOTPIXEL_HW_MAX; i++) {
+				spiConfigSendAsync(handle->spiConfigPtr, DAVIS_CONFIG_DVS,
+					U8T(DAVIS_CONFIG_DVS_FILTER_PIXEL_0_COLUMN + 2 * i), U32T(state->dvs.sizeX), NULL, NULL);
+				spiConfigSendAsync(handle->spiConfigPtr, DAVIS_CONFIG_DVS,
+					U8T(DAVIS_CONFIG_DVS_FILTER_PIXEL_0_ROW + 2 * i), U32T(state->dvs.sizeY), NULL, NULL);
 			}
+
+			// We're done!
+			free(hotPixels);
+
+			atomic_store(&state->dvs.pixelFilterAutoTrain.autoTrainRunning, false);
+			goto out;
 		}
+	}
+	else {
+	out:
+		// Deallocate when turned off, either by user or by having completed.
+		if (state->dvs.pixelFilterAutoTrain.noiseFilter != NULL) {
+			caerFilterDVSNoiseDestroy(state->dvs.pixelFilterAutoTrain.noiseFilter);
+			state->dvs.pixelFilterAutoTrain.noiseFilter = NULL;
+		}
+	}
+}
+
+// Commit all non-empty packets in a container, and then the container itself.
+static void davisCommonContainerCommit(
+	davisCommonHandle handle, bool tsReset, bool tsBigWrap, atomic_uint_fast32_t *transfersRunning) {
+	davisCommonState state = &handle->state;
 
+	if (state->currentPackets.polarityPosition > 0) {
+		davisCommonPixelFilterAutoTrain(handle);
+	}
+
+	if (tsReset || tsBigWrap) {
+		// Ignore all APS and IMU6 (composite) events, until a new APS or IMU6
+		// Start event comes in, for the next packet.
+		// This is to correctly support the forced packet commits that a TS reset,
+		// or a TS big wrap, impose. Continuing to parse events would result
+		// in a corrupted state of the first event in the new packet, as it would
+		// be incomplete, incorrect and miss vital initialization data.
+		// See APS and IMU6 END states for more details on a related issue.
+		state->aps.ignoreEvents = true;
+		state->imu.ignoreEvents = true;
+	}
+
+	containerGenerationPacketsCommit(&state->container, tsReset, state->timestamps.wrapOverflow,
+		state->timestamps.current, &state->dataExchange, transfersRunning);
+}
+
+static void davisCommonEventTranslator(
+	davisCommonHandle handle, const uint8_t *buffer, size_t bufferSize, atomic_uint_fast32_t *transfersRunning) {
+	davisCommonState state = &handle->state;
+
+	statisticsAddBytes(&state->dataExchange.statistics, bufferSize);
+
+	// Truncate off any extra partial event.
+	if ((bufferSize & 0x01) != 0) {
+		davisLog(CAER_LOG_ALERT, handle, "%zu bytes received, which is not a multiple of two.", bufferSize);
+		bufferSize &= ~((size_t) 0x01);
+	}
+
+	// Packets only go away on commit, so they're allocated once here, and
+	// then again only after commits, instead of being checked every event.
+	// Every 2 byte word generates at most one polarity or special event.
+	// Frames and IMU samples are checked on completion.
+	if ((bufferSize > 0)
+		&& !containerGenerationPacketsAllocate(&state->container, bufferSize / 2, state->timestamps.wrapOverflow)) {
+		return;
+	}
+
+	for (size_t bufferPos = 0; bufferPos < bufferSize; bufferPos += 2) {
 		bool tsReset   = false;
 		bool tsBigWrap = false;
 
@@ -2357,15 +2486,12 @@ static void davisCommonEventTranslator(
 						case 2: { // External input (falling edge)
 							davisLog(CAER_LOG_DEBUG, handle, "External input (falling edge) event received.");
 
-							if (ensureSpaceForEvents((caerEventPacketHeader *) &state->currentPackets.special,
-									(size_t) state->currentPackets.specialPosition, 1, handle)) {
-								caerSpecialEvent currentSpecialEvent = caerSpecialEventPacketGetEvent(
-									state->currentPackets.special, state->currentPackets.specialPosition);
-								caerSpecialEventSetTimestamp(currentSpecialEvent, state->timestamps.current);
-								caerSpecialEventSetType(currentSpecialEvent, EXTERNAL_INPUT_FALLING_EDGE);
-								caerSpecialEventValidate(currentSpecialEvent, state->currentPackets.special);
-								state->currentPackets.specialPosition++;
-							}
+							caerSpecialEvent currentSpecialEvent = caerSpecialEventPacketGetEvent(
+								state->currentPackets.special, state->currentPackets.specialPosition);
+							caerSpecialEventSetTimestamp(currentSpecialEvent, state->timestamps.current);
+							caerSpecialEventSetType(currentSpecialEvent, EXTERNAL_INPUT_FALLING_EDGE);
+							caerSpecialEventValidate(currentSpecialEvent, state->currentPackets.special);
+							state->currentPackets.specialPosition++;
 
 							break;
 						}
@@ -2373,15 +2499,12 @@ static void davisCommonEventTranslator(
 						case 3: { // External input (rising edge)
 							davisLog(CAER_LOG_DEBUG, handle, "External input (rising edge) event received.");
 
-							if (ensureSpaceForEvents((caerEventPacketHeader *) &state->currentPackets.special,
-									(size_t) state->currentPackets.specialPosition, 1, handle)) {
-								caerSpecialEvent currentSpecialEvent = caerSpecialEventPacketGetEvent(
-									state->currentPackets.special, state->currentPackets.specialPosition);
-								caerSpecialEventSetTimestamp(currentSpecialEvent, state->timestamps.current);
-								caerSpecialEventSetType(currentSpecialEvent, EXTERNAL_INPUT_RISING_EDGE);
-								caerSpecialEventValidate(currentSpecialEvent, state->currentPackets.special);
-								state->currentPackets.specialPosition++;
-							}
+							caerSpecialEvent currentSpecialEvent = caerSpecialEventPacketGetEvent(
+								state->currentPackets.special, state->currentPackets.specialPosition);
+							caerSpecialEventSetTimestamp(currentSpecialEvent, state->timestamps.current);
+							caerSpecialEventSetType(currentSpecialEvent, EXTERNAL_INPUT_RISING_EDGE);
+							caerSpecialEventValidate(currentSpecialEvent, state->currentPackets.special);
+							state->currentPackets.specialPosition++;
 
 							break;
 						}
@@ -2389,15 +2512,12 @@ static void davisCommonEventTranslator(
 						case 4: { // External input (pulse)
 							davisLog(CAER_LOG_DEBUG, handle, "External input (pulse) event received.");
 
-							if (ensureSpaceForEvents((caerEventPacketHeader *) &state->currentPackets.special,
-									(size_t) state->currentPackets.specialPosition, 1, handle)) {
-								caerSpecialEvent currentSpecialEvent = caerSpecialEventPacketGetEvent(
-									state->currentPackets.special, state->currentPackets.specialPosition);
-								caerSpecialEventSetTimestamp(currentSpecialEvent, state->timestamps.current);
-								caerSpecialEventSetType(currentSpecialEvent, EXTERNAL_INPUT_PULSE);
-								caerSpecialEventValidate(currentSpecialEvent, state->currentPackets.special);
-								state->currentPackets.specialPosition++;
-							}
+							caerSpecialEvent currentSpecialEvent = caerSpecialEventPacketGetEvent(
+								state->currentPackets.special, state->currentPackets.specialPosition);
+							caerSpecialEventSetTimestamp(currentSpecialEvent, state->timestamps.current);
+							caerSpecialEventSetType(currentSpecialEvent, EXTERNAL_INPUT_PULSE);
+							caerSpecialEventValidate(currentSpecialEvent, state->currentPackets.special);
+							state->currentPackets.specialPosition++;
 
 							break;
 						}
@@ -2436,8 +2556,7 @@ static void davisCommonEventTranslator(
 								// possible data loss would be too significant. So instead we keep a private event,
 								// fill it, and then only copy it into the packet here in the END state, at which point
 								// the whole event is ready and cannot be broken/corrupted in any way anymore.
-								if (ensureSpaceForEvents((caerEventPacketHeader *) &state->currentPackets.imu6,
-										(size_t) state->currentPackets.imu6Position, 1, handle)) {
+								if (containerGenerationPacketReserve(&state->container, IMU6_EVENT, 1)) {
 									caerIMU6Event imuCurrentEvent = caerIMU6EventPacketGetEvent(
 										state->currentPackets.imu6, state->currentPackets.imu6Position);
 									memcpy(imuCurrentEvent, &state->imu.currentEvent, sizeof(struct caer_imu6_event));
@@ -2491,8 +2610,7 @@ static void davisCommonEventTranslator(
 							// Validate event and advance frame packet position.
 							if (validFrame) {
 								// Get next frame.
-								if (ensureSpaceForEvents((caerEventPacketHeader *) &state->currentPackets.frame,
-										(size_t) state->currentPackets.framePosition, 1, handle)) {
+								if (containerGenerationPacketReserve(&state->container, FRAME_EVENT, 1)) {
 									caerFrameEvent frameEvent = caerFrameEventPacketGetEvent(
 										state->currentPackets.frame, state->currentPackets.framePosition);
 									state->currentPackets.framePosition++;
@@ -2589,8 +2707,7 @@ static void davisCommonEventTranslator(
 // Separate debug support.
 #if APS_DEBUG_FRAME == 1
 								// Get debug frames.
-								if (ensureSpaceForEvents((caerEventPacketHeader *) &state->currentPackets.frame,
-										(size_t) state->currentPackets.framePosition, 2, handle)) {
+								if (containerGenerationPacketReserve(&state->container, FRAME_EVENT, 2)) {
 									// Reset frame.
 									caerFrameEvent resetFrameEvent = caerFrameEventPacketGetEvent(
 										state->currentPackets.frame, state->currentPackets.framePosition);
@@ -2658,9 +2775,6 @@ static void davisCommonEventTranslator(
 							state->aps.currentReadoutType        = APS_READOUT_RESET;
 							state->aps.countY[APS_READOUT_RESET] = 0;
 
-							state->aps.cDavisSupport.offsetDirection = 0;
-							state->aps.cDavisSupport.offset          = 1; // First pixel of row always even.
-
 							break;
 						}
 
@@ -2673,9 +2787,6 @@ static void davisCommonEventTranslator(
 							state->aps.currentReadoutType         = APS_READOUT_SIGNAL;
 							state->aps.countY[APS_READOUT_SIGNAL] = 0;
 
-							state->aps.cDavisSupport.offsetDirection = 0;
-							state->aps.cDavisSupport.offset          = 1; // First pixel of row always even.
-
 							break;
 						}
 
@@ -2712,15 +2823,12 @@ static void davisCommonEventTranslator(
 								state->aps.frame.currentEvent, state->timestamps.current);
 
 							// Send APS info event out (as special event).
-							if (ensureSpaceForEvents((caerEventPacketHeader *) &state->currentPackets.special,
-									(size_t) state->currentPackets.specialPosition, 1, handle)) {
-								caerSpecialEvent currentSpecialEvent = caerSpecialEventPacketGetEvent(
-									state->currentPackets.special, state->currentPackets.specialPosition);
-								caerSpecialEventSetTimestamp(currentSpecialEvent, state->timestamps.current);
-								caerSpecialEventSetType(currentSpecialEvent, APS_EXPOSURE_START);
-								caerSpecialEventValidate(currentSpecialEvent, state->currentPackets.special);
-								state->currentPackets.specialPosition++;
-							}
+							caerSpecialEvent currentSpecialEvent = caerSpecialEventPacketGetEvent(
+								state->currentPackets.special, state->currentPackets.specialPosition);
+							caerSpecialEventSetTimestamp(currentSpecialEvent, state->timestamps.current);
+							caerSpecialEventSetType(currentSpecialEvent, APS_EXPOSURE_START);
+							caerSpecialEventValidate(currentSpecialEvent, state->currentPackets.special);
+							state->currentPackets.specialPosition++;
 
 							break;
 						}
@@ -2734,15 +2842,12 @@ static void davisCommonEventTranslator(
 							caerFrameEventSetTSEndOfExposure(state->aps.frame.currentEvent, state->timestamps.current);
 
 							// Send APS info event out (as special event).
-							if (ensureSpaceForEvents((caerEventPacketHeader *) &state->currentPackets.special,
-									(size_t) state->currentPackets.specialPosition, 1, handle)) {
-								caerSpecialEvent currentSpecialEvent = caerSpecialEventPacketGetEvent(
-									state->currentPackets.special, state->currentPackets.specialPosition);
-								caerSpecialEventSetTimestamp(currentSpecialEvent, state->timestamps.current);
-								caerSpecialEventSetType(currentSpecialEvent, APS_EXPOSURE_END);
-								caerSpecialEventValidate(currentSpecialEvent, state->currentPackets.special);
-								state->currentPackets.specialPosition++;
-							}
+							caerSpecialEvent currentSpecialEvent = caerSpecialEventPacketGetEvent(
+								state->currentPackets.special, state->currentPackets.specialPosition);
+							caerSpecialEventSetTimestamp(currentSpecialEvent, state->timestamps.current);
+							caerSpecialEventSetType(currentSpecialEvent, APS_EXPOSURE_END);
+							caerSpecialEventValidate(currentSpecialEvent, state->currentPackets.special);
+							state->currentPackets.specialPosition++;
 
 							break;
 						}
@@ -2750,15 +2855,12 @@ static void davisCommonEventTranslator(
 						case 16: { // External generator (falling edge)
 							davisLog(CAER_LOG_DEBUG, handle, "External generator (falling edge) event received.");
 
-							if (ensureSpaceForEvents((caerEventPacketHeader *) &state->currentPackets.special,
-									(size_t) state->currentPackets.specialPosition, 1, handle)) {
-								caerSpecialEvent currentSpecialEvent = caerSpecialEventPacketGetEvent(
-									state->currentPackets.special, state->currentPackets.specialPosition);
-								caerSpecialEventSetTimestamp(currentSpecialEvent, state->timestamps.current);
-								caerSpecialEventSetType(currentSpecialEvent, EXTERNAL_GENERATOR_FALLING_EDGE);
-								caerSpecialEventValidate(currentSpecialEvent, state->currentPackets.special);
-								state->currentPackets.specialPosition++;
-							}
+							caerSpecialEvent currentSpecialEvent = caerSpecialEventPacketGetEvent(
+								state->currentPackets.special, state->currentPackets.specialPosition);
+							caerSpecialEventSetTimestamp(currentSpecialEvent, state->timestamps.current);
+							caerSpecialEventSetType(currentSpecialEvent, EXTERNAL_GENERATOR_FALLING_EDGE);
+							caerSpecialEventValidate(currentSpecialEvent, state->currentPackets.special);
+							state->currentPackets.specialPosition++;
 
 							break;
 						}
@@ -2766,15 +2868,12 @@ static void davisCommonEventTranslator(
 						case 17: { // External generator (rising edge)
 							davisLog(CAER_LOG_DEBUG, handle, "External generator (rising edge) event received.");
 
-							if (ensureSpaceForEvents((caerEventPacketHeader *) &state->currentPackets.special,
-									(size_t) state->currentPackets.specialPosition, 1, handle)) {
-								caerSpecialEvent currentSpecialEvent = caerSpecialEventPacketGetEvent(
-									state->currentPackets.special, state->currentPackets.specialPosition);
-								caerSpecialEventSetTimestamp(currentSpecialEvent, state->timestamps.current);
-								caerSpecialEventSetType(currentSpecialEvent, EXTERNAL_GENERATOR_RISING_EDGE);
-								caerSpecialEventValidate(currentSpecialEvent, state->currentPackets.special);
-								state->currentPackets.specialPosition++;
-							}
+							caerSpecialEvent currentSpecialEvent = caerSpecialEventPacketGetEvent(
+								state->currentPackets.special, state->currentPackets.specialPosition);
+							caerSpecialEventSetTimestamp(currentSpecialEvent, state->timestamps.current);
+							caerSpecialEventSetType(currentSpecialEvent, EXTERNAL_GENERATOR_RISING_EDGE);
+							caerSpecialEventValidate(currentSpecialEvent, state->currentPackets.special);
+							state->currentPackets.specialPosition++;
 
 							break;
 						}
@@ -2810,25 +2909,17 @@ static void davisCommonEventTranslator(
 					// pre-amplifier. uint8_t polarity = ((IS_DAVIS208(handle->info.chipID)) && (data < 192)) ?
 					// U8T(~code) : (code);
 
-					if (ensureSpaceForEvents((caerEventPacketHeader *) &state->currentPackets.polarity,
-							(size_t) state->currentPackets.polarityPosition, 1, handle)) {
-						caerPolarityEvent currentPolarityEvent = caerPolarityEventPacketGetEvent(
-							state->currentPackets.polarity, state->currentPackets.polarityPosition);
-
-						// Timestamp at event-stream insertion point.
-						caerPolarityEventSetTimestamp(currentPolarityEvent, state->timestamps.current);
-						caerPolarityEventSetPolarity(currentPolarityEvent, (code & 0x01));
-						if (state->dvs.invertXY) {
-							caerPolarityEventSetY(currentPolarityEvent, data);
-							caerPolarityEventSetX(currentPolarityEvent, state->dvs.lastY);
-						}
-						else {
-							caerPolarityEventSetY(currentPolarityEvent, state->dvs.lastY);
-							caerPolarityEventSetX(currentPolarityEvent, data);
-						}
-						caerPolarityEventValidate(currentPolarityEvent, state->currentPackets.polarity);
-						state->currentPackets.polarityPosition++;
-					}
+					caerPolarityEvent currentPolarityEvent = caerPolarityEventPacketGetEvent(
+						state->currentPackets.polarity, state->currentPackets.polarityPosition);
+
+					// Timestamp at event-stream insertion point. Addresses and polarity
+					// are written in one go, with invertXY already in the shifts.
+					caerPolarityEventSetTimestamp(currentPolarityEvent, state->timestamps.current);
+					currentPolarityEvent->data = htole32((U32T(data) << state->dvs.xAddrShift)
+														 | (U32T(state->dvs.lastY) << state->dvs.yAddrShift)
+														 | (U32T(code & 0x01) << POLARITY_SHIFT));
+					caerPolarityEventValidate(currentPolarityEvent, state->currentPackets.polarity);
+					state->currentPackets.polarityPosition++;
 
 					break;
 				}
@@ -3098,15 +3189,12 @@ static void davisCommonEventTranslator(
 						&state->timestamps, data, TS_WRAP_ADD, handle->info.deviceString, &state->deviceLogLevel);
 
 					if (tsBigWrap) {
-						if (ensureSpaceForEvents((caerEventPacketHeader *) &state->currentPackets.special,
-								(size_t) state->currentPackets.specialPosition, 1, handle)) {
-							caerSpecialEvent currentSpecialEvent = caerSpecialEventPacketGetEvent(
-								state->currentPackets.special, state->currentPackets.specialPosition);
-							caerSpecialEventSetTimestamp(currentSpecialEvent, INT32_MAX);
-							caerSpecialEventSetType(currentSpecialEvent, TIMESTAMP_WRAP);
-							caerSpecialEventValidate(currentSpecialEvent, state->currentPackets.special);
-							state->currentPackets.specialPosition++;
-						}
+						caerSpecialEvent currentSpecialEvent = caerSpecialEventPacketGetEvent(
+							state->currentPackets.special, state->currentPackets.specialPosition);
+						caerSpecialEventSetTimestamp(currentSpecialEvent, INT32_MAX);
+						caerSpecialEventSetType(currentSpecialEvent, TIMESTAMP_WRAP);
+						caerSpecialEventValidate(currentSpecialEvent, state->currentPackets.special);
+						state->currentPackets.specialPosition++;
 					}
 					else {
 						containerGenerationCommitTimestampInit(&state->container, state->timestamps.current);
@@ -3137,143 +3225,21 @@ static void davisCommonEventTranslator(
 		// Commit packet containers to the ring-buffer, so they can be processed by the
 		// main-loop, when any of the required conditions are met.
 		if (tsReset || tsBigWrap || containerSizeCommit || containerTimeCommit) {
-			// One or more of the commit triggers are hit. Set the packet container up to contain
-			// any non-empty packets. Empty packets are not forwarded to save memory.
-			bool emptyContainerCommit = true;
-
-			if (state->currentPackets.polarityPosition > 0) {
-				containerGenerationSetPacket(
-					&state->container, POLARITY_EVENT, (caerEventPacketHeader) state->currentPackets.polarity);
-
-				// Run pixel filter auto-train. Can only be enabled if hw-filter present.
-				if (atomic_load_explicit(&state->dvs.pixelFilterAutoTrain.autoTrainRunning, memory_order_relaxed)) {
-					if (state->dvs.pixelFilterAutoTrain.noiseFilter == NULL) {
-						state->dvs.pixelFilterAutoTrain.noiseFilter
-							= caerFilterDVSNoiseInitialize(U16T(handle->info.dvsSizeX), U16T(handle->info.dvsSizeY));
-						if (state->dvs.pixelFilterAutoTrain.noiseFilter == NULL) {
-							// Failed to initialize, auto-training not possible.
-							atomic_store(&state->dvs.pixelFilterAutoTrain.autoTrainRunning, false);
-							goto out;
-						}
+			davisCommonContainerCommit(handle, tsReset, tsBigWrap, transfersRunning);
 
-						// Allocate+init success, configure it for hot-pixel learning.
-						caerFilterDVSNoiseConfigSet(
-							state->dvs.pixelFilterAutoTrain.noiseFilter, CAER_FILTER_DVS_HOTPIXEL_COUNT, 1000);
-						caerFilterDVSNoiseConfigSet(
-							state->dvs.pixelFilterAutoTrain.noiseFilter, CAER_FILTER_DVS_HOTPIXEL_TIME, 1000000);
-						caerFilterDVSNoiseConfigSet(
-							state->dvs.pixelFilterAutoTrain.noiseFilter, CAER_FILTER_DVS_HOTPIXEL_LEARN, true);
-					}
-
-					// NoiseFilter must be allocated and initialized if we get here.
-					caerFilterDVSNoiseApply(
-						state->dvs.pixelFilterAutoTrain.noiseFilter, state->currentPackets.polarity);
-
-					uint64_t stillLearning = 1;
-					caerFilterDVSNoiseConfigGet(
-						state->dvs.pixelFilterAutoTrain.noiseFilter, CAER_FILTER_DVS_HOTPIXEL_LEARN, &stillLearning);
-
-					if (!stillLearning) {
-						// Learning done, we can grab the list of hot pixels, and hardware-filter them.
-						caerFilterDVSPixel hotPixels;
-						ssize_t hotPixelsSize
-							= caerFilterDVSNoiseGetHotPixels(state->dvs.pixelFilterAutoTrain.noiseFilter, &hotPixels);
-						if (hotPixelsSize < 0) {
-							// Failed to get list.
-							atomic_store(&state->dvs.pixelFilterAutoTrain.autoTrainRunning, false);
-							goto out;
-						}
-
-						// Limit to maximum hardware size.
-						if (hotPixelsSize > DVS_HOTPIXEL_HW_MAX) {
-							hotPixelsSize = DVS_HOTPIXEL_HW_MAX;
-						}
-
-						// Go through the found pixels and filter them. Disable not used slots.
-						size_t i = 0;
-
-						for (; i < (size_t) hotPixelsSize; i++) {
-							spiConfigSendAsync(handle->spiConfigPtr, DAVIS_CONFIG_DVS,
-								U8T(DAVIS_CONFIG_DVS_FILTER_PIXEL_0_COLUMN + 2 * i),
-								(state->dvs.invertXY) ? (hotPixels[i].y) : (hotPixels[i].x), NULL, NULL);
-							spiConfigSendAsync(handle->spiConfigPtr, DAVIS_CONFIG_DVS,
-								U8T(DAVIS_CONFIG_DVS_FILTER_PIXEL_0_ROW + 2 * i),
-								(state->dvs.invertXY) ? (hotPixels[i].x) : (hotPixels[i].y), NULL, NULL);
-						}
-
-						for (; i < DVS_HOTPIXEL_HW_MAX; i++) {
-							spiConfigSendAsync(handle->spiConfigPtr, DAVIS_CONFIG_DVS,
-								U8T(DAVIS_CONFIG_DVS_FILTER_PIXEL_0_COLUMN + 2 * i), U32T(state->dvs.sizeX), NULL,
-								NULL);
-							spiConfigSendAsync(handle->spiConfigPtr, DAVIS_CONFIG_DVS,
-								U8T(DAVIS_CONFIG_DVS_FILTER_PIXEL_0_ROW + 2 * i), U32T(state->dvs.sizeY), NULL, NULL);
-						}
-
-						// We're done!
-						free(hotPixels);
-
-						atomic_store(&state->dvs.pixelFilterAutoTrain.autoTrainRunning, false);
-						goto out;
-					}
-				}
-				else {
-				out:
-					// Deallocate when turned off, either by user or by having completed.
-					if (state->dvs.pixelFilterAutoTrain.noiseFilter != NULL) {
-						caerFilterDVSNoiseDestroy(state->dvs.pixelFilterAutoTrain.noiseFilter);
-						state->dvs.pixelFilterAutoTrain.noiseFilter = NULL;
-					}
-				}
-
-				state->currentPackets.polarity         = NULL;
-				state->currentPackets.polarityPosition = 0;
-				emptyContainerCommit                   = false;
-			}
-
-			if (state->currentPackets.specialPosition > 0) {
-				containerGenerationSetPacket(
-					&state->container, SPECIAL_EVENT, (caerEventPacketHeader) state->currentPackets.special);
-
-				state->currentPackets.special         = NULL;
-				state->currentPackets.specialPosition = 0;
-				emptyContainerCommit                  = false;
-			}
-
-			if (state->currentPackets.framePosition > 0) {
-				containerGenerationSetPacket(
-					&state->container, FRAME_EVENT, (caerEventPacketHeader) state->currentPackets.frame);
-
-				state->currentPackets.frame         = NULL;
-				state->currentPackets.framePosition = 0;
-				emptyContainerCommit                = false;
-			}
-
-			if (state->currentPackets.imu6Position > 0) {
-				containerGenerationSetPacket(
-					&state->container, IMU6_EVENT, (caerEventPacketHeader) state->currentPackets.imu6);
-
-				state->currentPackets.imu6         = NULL;
-				state->currentPackets.imu6Position = 0;
-				emptyContainerCommit               = false;
-			}
-
-			if (tsReset || tsBigWrap) {
-				// Ignore all APS and IMU6 (composite) events, until a new APS or IMU6
-				// Start event comes in, for the next packet.
-				// This is to correctly support the forced packet commits that a TS reset,
-				// or a TS big wrap, impose. Continuing to parse events would result
-				// in a corrupted state of the first event in the new packet, as it would
-				// be incomplete, incorrect and miss vital initialization data.
-				// See APS and IMU6 END states for more details on a related issue.
-				state->aps.ignoreEvents = true;
-				state->imu.ignoreEvents = true;
+			// Allocate new packets for the rest of the buffer.
+			if (((bufferPos + 2) < bufferSize)
+				&& !containerGenerationPacketsAllocate(
+					&state->container, (bufferSize - (bufferPos + 2)) / 2, state->timestamps.wrapOverflow)) {
+				return;
 			}
-
-			containerGenerationExecute(&state->container, emptyContainerCommit, tsReset, state->timestamps.wrapOverflow,
-				state->timestamps.current, &state->dataExchange, transfersRunning, handle->info.deviceID,
-				handle->info.deviceString, &state->deviceLogLevel);
 		}
 	}
+
+	// Commit a container pending for too long, also when called without data (device idle).
+	if (containerGenerationIsLatencyElapsed(&state->container)) {
+		davisCommonContainerCommit(handle, false, false, transfersRunning);
+	}
 }
 
 static void davisCommonTSMasterStatusUpdater(void *userDataPtr, int status, uint32_t param) {
@@ -446,6 +446,12 @@ static int gpioThreadRun(void *handlePtr) {
 			davisRPiBenchmarkDataTranslator(handle, data, dataSize);
 #endif
 		}
+#if DAVIS_RPI_BENCHMARK == 0
+		else {
+			// No data: commit pending events on time, see CAER_HOST_CONFIG_PACKETS_MAX_CONTAINER_LATENCY.
+			davisRPiDataTranslator(handle, NULL, 0);
+		}
+#endif
 
 #if DAVIS_RPI_BENCHMARK == 1
 		if (handle->benchmark.dataCount >= DAVIS_RPI_BENCHMARK_LIMIT_BYTES) {
@@ -561,6 +567,25 @@ caerEventPacketContainer davisRPiDataGet(caerDeviceHandle cdh) {
 	return (dataExchangeGet(&handle->cHandle.state.dataExchange, &handle->gpio.threadState));
 }
 
+size_t davisRPiDataGetMany(caerDeviceHandle cdh, caerEventPacketContainer *containers, size_t containersNumber) {
+	davisRPiHandle handle = (davisRPiHandle) cdh;
+
+	return (dataExchangeGetMany(
+		&handle->cHandle.state.dataExchange, &handle->gpio.threadState, containers, containersNumber));
+}
+
+int davisRPiDataGetFD(caerDeviceHandle cdh) {
+	davisRPiHandle handle = (davisRPiHandle) cdh;
+
+	return (dataExchangeGetFD(&handle->cHandle.state.dataExchange));
+}
+
+void davisRPiDataRecycle(caerDeviceHandle cdh, caerEventPacketContainer container) {
+	davisRPiHandle handle = (davisRPiHandle) cdh;
+
+	containerGenerationRecycle(&handle->cHandle.state.container, container);
+}
+
 #if DAVIS_RPI_BENCHMARK == 1
 static void davisRPiBenchmarkDataTranslator(davisRPiHandle handle, const uint8_t *buffer, size_t bufferSize) {
 	// Return right away if not running anymore. This prevents useless work if many
@@ -83,5 +83,8 @@ bool davisRPiDataStart(caerDeviceHandle handle, void (*dataNotifyIncrease)(void
 	void *dataShutdownUserPtr);
 bool davisRPiDataStop(caerDeviceHandle handle);
 caerEventPacketContainer davisRPiDataGet(caerDeviceHandle handle);
+size_t davisRPiDataGetMany(caerDeviceHandle handle, caerEventPacketContainer *containers, size_t containersNumber);
+int davisRPiDataGetFD(caerDeviceHandle handle);
+void davisRPiDataRecycle(caerDeviceHandle handle, caerEventPacketContainer container);
 
 #endif /* LIBCAER_SRC_DAVIS_RPI_H_ */
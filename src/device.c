@@ -207,6 +207,73 @@ static caerEventPacketContainer (*dataGetters[CAER_SUPPORTED_DEVICES_NUMBER])(ca
 	[CAER_DEVICE_SAMSUNG_EVK] = &samsungEVKDataGet,
 };
 
+static size_t (*dataGettersMany[CAER_SUPPORTED_DEVICES_NUMBER])(
+	caerDeviceHandle handle, caerEventPacketContainer *containers, size_t containersNumber)
+	= {
+		[CAER_DEVICE_DVS128]    = &dvs128DataGetMany,
+		[CAER_DEVICE_DAVIS_FX2] = &davisDataGetMany,
+		[CAER_DEVICE_DAVIS_FX3] = &davisDataGetMany,
+		[CAER_DEVICE_DYNAPSE]   = &dynapseDataGetMany,
+		[CAER_DEVICE_DAVIS]     = &davisDataGetMany,
+#if defined(LIBCAER_HAVE_SERIALDEV) && LIBCAER_HAVE_SERIALDEV == 1
+		[CAER_DEVICE_EDVS] = &edvsDataGetMany,
+#else
+		[CAER_DEVICE_EDVS]      = NULL,
+#endif
+#if defined(OS_LINUX)
+		[CAER_DEVICE_DAVIS_RPI] = &davisRPiDataGetMany,
+#else
+		[CAER_DEVICE_DAVIS_RPI] = NULL,
+#endif
+		[CAER_DEVICE_DVS132S]     = &dvs132sDataGetMany,
+		[CAER_DEVICE_DVXPLORER]   = &dvXplorerDataGetMany,
+		[CAER_DEVICE_SAMSUNG_EVK] = &samsungEVKDataGetMany,
+};
+
+static int (*dataGetFDs[CAER_SUPPORTED_DEVICES_NUMBER])(caerDeviceHandle handle) = {
+	[CAER_DEVICE_DVS128]    = &dvs128DataGetFD,
+	[CAER_DEVICE_DAVIS_FX2] = &davisDataGetFD,
+	[CAER_DEVICE_DAVIS_FX3] = &davisDataGetFD,
+	[CAER_DEVICE_DYNAPSE]   = &dynapseDataGetFD,
+	[CAER_DEVICE_DAVIS]     = &davisDataGetFD,
+#if defined(LIBCAER_HAVE_SERIALDEV) && LIBCAER_HAVE_SERIALDEV == 1
+	[CAER_DEVICE_EDVS] = &edvsDataGetFD,
+#else
+	[CAER_DEVICE_EDVS]      = NULL,
+#endif
+#if defined(OS_LINUX)
+	[CAER_DEVICE_DAVIS_RPI] = &davisRPiDataGetFD,
+#else
+	[CAER_DEVICE_DAVIS_RPI] = NULL,
+#endif
+	[CAER_DEVICE_DVS132S]     = &dvs132sDataGetFD,
+	[CAER_DEVICE_DVXPLORER]   = &dvXplorerDataGetFD,
+	[CAER_DEVICE_SAMSUNG_EVK] = &samsungEVKDataGetFD,
+};
+
+static void (*dataRecyclers[CAER_SUPPORTED_DEVICES_NUMBER])(
+	caerDeviceHandle handle, caerEventPacketContainer container)
+	= {
+		[CAER_DEVICE_DVS128]    = &dvs128DataRecycle,
+		[CAER_DEVICE_DAVIS_FX2] = &davisDataRecycle,
+		[CAER_DEVICE_DAVIS_FX3] = &davisDataRecycle,
+		[CAER_DEVICE_DYNAPSE]   = &dynapseDataRecycle,
+		[CAER_DEVICE_DAVIS]     = &davisDataRecycle,
+#if defined(LIBCAER_HAVE_SERIALDEV) && LIBCAER_HAVE_SERIALDEV == 1
+		[CAER_DEVICE_EDVS] = &edvsDataRecycle,
+#else
+		[CAER_DEVICE_EDVS]      = NULL,
+#endif
+#if defined(OS_LINUX)
+		[CAER_DEVICE_DAVIS_RPI] = &davisRPiDataRecycle,
+#else
+		[CAER_DEVICE_DAVIS_RPI] = NULL,
+#endif
+		[CAER_DEVICE_DVS132S]     = &dvs132sDataRecycle,
+		[CAER_DEVICE_DVXPLORER]   = &dvXplorerDataRecycle,
+		[CAER_DEVICE_SAMSUNG_EVK] = &samsungEVKDataRecycle,
+};
+
 // Add empty InfoGet for optional devices, such as serial ones.
 #if defined(LIBCAER_HAVE_SERIALDEV) && LIBCAER_HAVE_SERIALDEV == 0
 struct caer_edvs_info caerEDVSInfoGet(caerDeviceHandle handle) {
@@ -404,6 +471,55 @@ caerEventPacketContainer caerDeviceDataGet(caerDeviceHandle handle) {
 	return (dataGetters[handle->deviceType](handle));
 }
 
+size_t caerDeviceDataGetMany(caerDeviceHandle handle, caerEventPacketContainer *containers, size_t containersNumber) {
+	// Check if the pointer is valid.
+	if ((handle == NULL) || (containers == NULL)) {
+		return (0);
+	}
+
+	// Check if device type is supported.
+	if (handle->deviceType >= CAER_SUPPORTED_DEVICES_NUMBER) {
+		return (0);
+	}
+
+	// Call appropriate function.
+	if (dataGettersMany[handle->deviceType] == NULL) {
+		return (0);
+	}
+
+	return (dataGettersMany[handle->deviceType](handle, containers, containersNumber));
+}
+
+int caerDeviceDataGetFD(caerDeviceHandle handle) {
+	// Check if the pointer is valid.
+	if (handle == NULL) {
+		return (-1);
+	}
+
+	// Check if device type is supported.
+	if (handle->deviceType >= CAER_SUPPORTED_DEVICES_NUMBER) {
+		return (-1);
+	}
+
+	// Call appropriate function.
+	if (dataGetFDs[handle->deviceType] == NULL) {
+		return (-1);
+	}
+
+	return (dataGetFDs[handle->deviceType](handle));
+}
+
+void caerDeviceDataRecycle(caerDeviceHandle handle, caerEventPacketContainer container) {
+	// Without a valid device, there is no pool to return to.
+	if ((handle == NULL) || (handle->deviceType >= CAER_SUPPORTED_DEVICES_NUMBER)
+		|| (dataRecyclers[handle->deviceType] == NULL)) {
+		caerEventPacketContainerFree(container);
+		return;
+	}
+
+	dataRecyclers[handle->deviceType](handle, container);
+}
+
 bool caerDeviceConfigGet64(caerDeviceHandle handle, int8_t modAddr, uint8_t paramAddr, uint64_t *param) {
 	// Ensure param is zeroed out.
 	*param = 0;
@@ -78,23 +78,6 @@ ssize_t dvs128Find(caerDeviceDiscoveryResult *discoveredDevices) {
 static inline void freeAllDataMemory(dvs128State state) {
 	dataExchangeDestroy(&state->dataExchange);
 
-	// Since the current event packets aren't necessarily
-	// already assigned to the current packet container, we
-	// free them separately from it.
-	if (state->currentPackets.polarity != NULL) {
-		free(&state->currentPackets.polarity->packetHeader);
-		state->currentPackets.polarity = NULL;
-
-		containerGenerationSetPacket(&state->container, POLARITY_EVENT, NULL);
-	}
-
-	if (state->currentPackets.special != NULL) {
-		free(&state->currentPackets.special->packetHeader);
-		state->currentPackets.special = NULL;
-
-		containerGenerationSetPacket(&state->container, SPECIAL_EVENT, NULL);
-	}
-
 	containerGenerationDestroy(&state->container);
 }
 
@@ -278,9 +261,18 @@ bool dvs128ConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr, ui
 			break;
 
 		case CAER_HOST_CONFIG_PACKETS:
+			if (paramAddr == CAER_HOST_CONFIG_PACKETS_MAX_CONTAINER_LATENCY) {
+				// Wake up often enough to commit on time, even without new data.
+				usbSetDataIdleInterval(&state->usbState, param);
+			}
+
 			return (containerGenerationConfigSet(&state->container, paramAddr, param));
 			break;
 
+		case CAER_HOST_CONFIG_STATISTICS:
+			return (statisticsConfigSet(&state->dataExchange.statistics, paramAddr, param));
+			break;
+
 		case CAER_HOST_CONFIG_LOG:
 			switch (paramAddr) {
 				case CAER_HOST_CONFIG_LOG_LEVEL:
@@ -399,6 +391,10 @@ bool dvs128ConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr, ui
 			return (containerGenerationConfigGet(&state->container, paramAddr, param));
 			break;
 
+		case CAER_HOST_CONFIG_STATISTICS:
+			return (statisticsConfigGet(&state->dataExchange.statistics, paramAddr, param));
+			break;
+
 		case CAER_HOST_CONFIG_LOG:
 			switch (paramAddr) {
 				case CAER_HOST_CONFIG_LOG_LEVEL:
@@ -481,29 +477,24 @@ bool dvs128DataStart(caerDeviceHandle cdh, void (*dataNotifyIncrease)(void *ptr)
 		return (false);
 	}
 
-	// Allocate packets.
-	if (!containerGenerationAllocate(&state->container, DVS_EVENT_TYPES)) {
-		freeAllDataMemory(state);
-
-		dvs128Log(CAER_LOG_CRITICAL, handle, "Failed to allocate event packet container.");
-		return (false);
-	}
-
-	state->currentPackets.polarity
-		= caerPolarityEventPacketAllocate(DVS_POLARITY_DEFAULT_SIZE, I16T(handle->info.deviceID), 0);
-	if (state->currentPackets.polarity == NULL) {
+	// Prepare container recycling pool.
+	if (!containerGenerationPoolInit(&state->container)) {
 		freeAllDataMemory(state);
 
-		dvs128Log(CAER_LOG_CRITICAL, handle, "Failed to allocate polarity event packet.");
+		dvs128Log(CAER_LOG_CRITICAL, handle, "Failed to initialize event packet container pool.");
 		return (false);
 	}
 
-	state->currentPackets.special
-		= caerSpecialEventPacketAllocate(DVS_SPECIAL_DEFAULT_SIZE, I16T(handle->info.deviceID), 0);
-	if (state->currentPackets.special == NULL) {
+	// Allocate packets.
+	containerGenerationPacketsInit(&state->container, DVS_EVENT_TYPES, I16T(handle->info.deviceID),
+		handle->info.deviceString, &state->deviceLogLevel);
+	containerGenerationPacketsAdd(&state->container, POLARITY_EVENT, POLARITY_EVENT, &state->currentPackets.polarity,
+		&state->currentPackets.polarityPosition, DVS_POLARITY_DEFAULT_SIZE, 1);
+	containerGenerationPacketsAdd(&state->container, SPECIAL_EVENT, SPECIAL_EVENT, &state->currentPackets.special,
+		&state->currentPackets.specialPosition, DVS_SPECIAL_DEFAULT_SIZE, 1);
+
+	if (!containerGenerationPacketsAllocate(&state->container, 0, 0)) {
 		freeAllDataMemory(state);
-
-		dvs128Log(CAER_LOG_CRITICAL, handle, "Failed to allocate special event packet.");
 		return (false);
 	}
 
@@ -553,6 +544,27 @@ caerEventPacketContainer dvs128DataGet(caerDeviceHandle cdh) {
 	return (dataExchangeGet(&state->dataExchange, &state->usbState.dataTransfersRun));
 }
 
+size_t dvs128DataGetMany(caerDeviceHandle cdh, caerEventPacketContainer *containers, size_t containersNumber) {
+	dvs128Handle handle = (dvs128Handle) cdh;
+	dvs128State state   = &handle->state;
+
+	return (dataExchangeGetMany(&state->dataExchange, &state->usbState.dataTransfersRun, containers, containersNumber));
+}
+
+int dvs128DataGetFD(caerDeviceHandle cdh) {
+	dvs128Handle handle = (dvs128Handle) cdh;
+	dvs128State state   = &handle->state;
+
+	return (dataExchangeGetFD(&state->dataExchange));
+}
+
+void dvs128DataRecycle(caerDeviceHandle cdh, caerEventPacketContainer container) {
+	dvs128Handle handle = (dvs128Handle) cdh;
+	dvs128State state   = &handle->state;
+
+	containerGenerationRecycle(&state->container, container);
+}
+
 #define DVS128_TIMESTAMP_WRAP_MASK  0x80
 #define DVS128_TIMESTAMP_RESET_MASK 0x40
 #define DVS128_POLARITY_SHIFT       0
@@ -564,6 +576,14 @@ caerEventPacketContainer dvs128DataGet(caerDeviceHandle cdh) {
 #define DVS128_SYNC_EVENT_MASK      0x8000
 #define TS_WRAP_ADD                 0x4000
 
+// Commit all non-empty packets in a container, and then the container itself.
+static void dvs128ContainerCommit(dvs128Handle handle, bool tsReset) {
+	dvs128State state = &handle->state;
+
+	containerGenerationPacketsCommit(&state->container, tsReset, state->timestamps.wrapOverflow,
+		state->timestamps.current, &state->dataExchange, &state->usbState.dataTransfersRun);
+}
+
 static void dvs128EventTranslator(void *vhd, const uint8_t *buffer, size_t bytesSent) {
 	dvs128Handle handle = vhd;
 	dvs128State state   = &handle->state;
@@ -576,63 +596,23 @@ static void dvs128EventTranslator(void *vhd, const uint8_t *buffer, size_t bytes
 		return;
 	}
 
+	statisticsAddBytes(&state->dataExchange.statistics, bytesSent);
+
 	// Truncate off any extra partial event.
 	if ((bytesSent & 0x03) != 0) {
 		dvs128Log(CAER_LOG_ALERT, handle, "%zu bytes received via USB, which is not a multiple of four.", bytesSent);
 		bytesSent &= ~((size_t) 0x03);
 	}
 
-	for (size_t i = 0; i < bytesSent; i += 4) {
-		// Allocate new packets for next iteration as needed.
-		if (!containerGenerationAllocate(&state->container, DVS_EVENT_TYPES)) {
-			dvs128Log(CAER_LOG_CRITICAL, handle, "Failed to allocate event packet container.");
-			return;
-		}
-
-		if (state->currentPackets.polarity == NULL) {
-			state->currentPackets.polarity = caerPolarityEventPacketAllocate(
-				DVS_POLARITY_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
-			if (state->currentPackets.polarity == NULL) {
-				dvs128Log(CAER_LOG_CRITICAL, handle, "Failed to allocate polarity event packet.");
-				return;
-			}
-		}
-		else if (state->currentPackets.polarityPosition
-				 >= caerEventPacketHeaderGetEventCapacity((caerEventPacketHeader) state->currentPackets.polarity)) {
-			// If not committed, let's check if any of the packets has reached its maximum
-			// capacity limit. If yes, we grow them to accomodate new events.
-			caerPolarityEventPacket grownPacket = (caerPolarityEventPacket) caerEventPacketGrow(
-				(caerEventPacketHeader) state->currentPackets.polarity, state->currentPackets.polarityPosition * 2);
-			if (grownPacket == NULL) {
-				dvs128Log(CAER_LOG_CRITICAL, handle, "Failed to grow polarity event packet.");
-				return;
-			}
-
-			state->currentPackets.polarity = grownPacket;
-		}
-
-		if (state->currentPackets.special == NULL) {
-			state->currentPackets.special = caerSpecialEventPacketAllocate(
-				DVS_SPECIAL_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
-			if (state->currentPackets.special == NULL) {
-				dvs128Log(CAER_LOG_CRITICAL, handle, "Failed to allocate special event packet.");
-				return;
-			}
-		}
-		else if (state->currentPackets.specialPosition
-				 >= caerEventPacketHeaderGetEventCapacity((caerEventPacketHeader) state->currentPackets.special)) {
-			// If not committed, let's check if any of the packets has reached its maximum
-			// capacity limit. If yes, we grow them to accomodate new events.
-			caerSpecialEventPacket grownPacket = (caerSpecialEventPacket) caerEventPacketGrow(
-				(caerEventPacketHeader) state->currentPackets.special, state->currentPackets.specialPosition * 2);
-			if (grownPacket == NULL) {
-				dvs128Log(CAER_LOG_CRITICAL, handle, "Failed to grow special event packet.");
-				return;
-			}
-
-			state->currentPackets.special = grownPacket;
-		}
+	// Packets only go away on commit, so they're allocated once here, and
+	// then again only after commits, instead of being checked every event.
+	// Every 4 byte word generates at most one polarity or special event.
+	if ((bytesSent > 0)
+		&& !containerGenerationPacketsAllocate(&state->container, bytesSent / 4, state->timestamps.wrapOverflow)) {
+		return;
+	}
 
+	for (size_t i = 0; i < bytesSent; i += 4) {
 		bool tsReset   = false;
 		bool tsBigWrap = false;
 
@@ -768,33 +748,21 @@ static void dvs128EventTranslator(void *vhd, const uint8_t *buffer, size_t bytes
 		// Commit packet containers to the ring-buffer, so they can be processed by the
 		// main-loop, when any of the required conditions are met.
 		if (tsReset || tsBigWrap || containerSizeCommit || containerTimeCommit) {
-			// One or more of the commit triggers are hit. Set the packet container up to contain
-			// any non-empty packets. Empty packets are not forwarded to save memory.
-			bool emptyContainerCommit = true;
+			dvs128ContainerCommit(handle, tsReset);
 
-			if (state->currentPackets.polarityPosition > 0) {
-				containerGenerationSetPacket(
-					&state->container, POLARITY_EVENT, (caerEventPacketHeader) state->currentPackets.polarity);
-
-				state->currentPackets.polarity         = NULL;
-				state->currentPackets.polarityPosition = 0;
-				emptyContainerCommit                   = false;
-			}
-
-			if (state->currentPackets.specialPosition > 0) {
-				containerGenerationSetPacket(
-					&state->container, SPECIAL_EVENT, (caerEventPacketHeader) state->currentPackets.special);
-
-				state->currentPackets.special         = NULL;
-				state->currentPackets.specialPosition = 0;
-				emptyContainerCommit                  = false;
+			// Allocate new packets for the rest of the buffer.
+			if (((i + 4) < bytesSent)
+				&& !containerGenerationPacketsAllocate(
+					&state->container, (bytesSent - (i + 4)) / 4, state->timestamps.wrapOverflow)) {
+				return;
 			}
-
-			containerGenerationExecute(&state->container, emptyContainerCommit, tsReset, state->timestamps.wrapOverflow,
-				state->timestamps.current, &state->dataExchange, &state->usbState.dataTransfersRun,
-				handle->info.deviceID, handle->info.deviceString, &handle->state.deviceLogLevel);
 		}
 	}
+
+	// Commit a container pending for too long, also when called without data (device idle).
+	if (containerGenerationIsLatencyElapsed(&state->container)) {
+		dvs128ContainerCommit(handle, false);
+	}
 }
 
 static bool dvs128SendBiases(dvs128State state) {
@@ -96,5 +96,8 @@ bool dvs128DataStart(caerDeviceHandle handle, void (*dataNotifyIncrease)(void *p
 	void *dataShutdownUserPtr);
 bool dvs128DataStop(caerDeviceHandle handle);
 caerEventPacketContainer dvs128DataGet(caerDeviceHandle handle);
+size_t dvs128DataGetMany(caerDeviceHandle handle, caerEventPacketContainer *containers, size_t containersNumber);
+int dvs128DataGetFD(caerDeviceHandle handle);
+void dvs128DataRecycle(caerDeviceHandle handle, caerEventPacketContainer container);
 
 #endif /* LIBCAER_SRC_DVS128_H_ */
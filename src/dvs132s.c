@@ -109,30 +109,6 @@ static inline float calculateIMUGyroScale(uint8_t imuGyroScale) {
 static inline void freeAllDataMemory(dvs132sState state) {
 	dataExchangeDestroy(&state->dataExchange);
 
-	// Since the current event packets aren't necessarily
-	// already assigned to the current packet container, we
-	// free them separately from it.
-	if (state->currentPackets.polarity != NULL) {
-		free(&state->currentPackets.polarity->packetHeader);
-		state->currentPackets.polarity = NULL;
-
-		containerGenerationSetPacket(&state->container, POLARITY_EVENT, NULL);
-	}
-
-	if (state->currentPackets.special != NULL) {
-		free(&state->currentPackets.special->packetHeader);
-		state->currentPackets.special = NULL;
-
-		containerGenerationSetPacket(&state->container, SPECIAL_EVENT, NULL);
-	}
-
-	if (state->currentPackets.imu6 != NULL) {
-		free(&state->currentPackets.imu6->packetHeader);
-		state->currentPackets.imu6 = NULL;
-
-		containerGenerationSetPacket(&state->container, IMU6_EVENT_PKT_POS, NULL);
-	}
-
 	containerGenerationDestroy(&state->container);
 }
 
@@ -455,9 +431,18 @@ bool dvs132sConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr, u
 			break;
 
 		case CAER_HOST_CONFIG_PACKETS:
+			if (paramAddr == CAER_HOST_CONFIG_PACKETS_MAX_CONTAINER_LATENCY) {
+				// Wake up often enough to commit on time, even without new data.
+				usbSetDataIdleInterval(&state->usbState, param);
+			}
+
 			return (containerGenerationConfigSet(&state->container, paramAddr, param));
 			break;
 
+		case CAER_HOST_CONFIG_STATISTICS:
+			return (statisticsConfigSet(&state->dataExchange.statistics, paramAddr, param));
+			break;
+
 		case CAER_HOST_CONFIG_LOG:
 			switch (paramAddr) {
 				case CAER_HOST_CONFIG_LOG_LEVEL:
@@ -681,6 +666,10 @@ bool dvs132sConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr, u
 			return (containerGenerationConfigGet(&state->container, paramAddr, param));
 			break;
 
+		case CAER_HOST_CONFIG_STATISTICS:
+			return (statisticsConfigGet(&state->dataExchange.statistics, paramAddr, param));
+			break;
+
 		case CAER_HOST_CONFIG_LOG:
 			switch (paramAddr) {
 				case CAER_HOST_CONFIG_LOG_LEVEL:
@@ -941,37 +930,26 @@ bool dvs132sDataStart(caerDeviceHandle cdh, void (*dataNotifyIncrease)(void *ptr
 		return (false);
 	}
 
-	// Allocate packets.
-	if (!containerGenerationAllocate(&state->container, DVS132S_EVENT_TYPES)) {
+	// Prepare container recycling pool.
+	if (!containerGenerationPoolInit(&state->container)) {
 		freeAllDataMemory(state);
 
-		dvs132sLog(CAER_LOG_CRITICAL, handle, "Failed to allocate event packet container.");
+		dvs132sLog(CAER_LOG_CRITICAL, handle, "Failed to initialize event packet container pool.");
 		return (false);
 	}
 
-	state->currentPackets.polarity
-		= caerPolarityEventPacketAllocate(DVS132S_POLARITY_DEFAULT_SIZE, I16T(handle->info.deviceID), 0);
-	if (state->currentPackets.polarity == NULL) {
-		freeAllDataMemory(state);
-
-		dvs132sLog(CAER_LOG_CRITICAL, handle, "Failed to allocate polarity event packet.");
-		return (false);
-	}
-
-	state->currentPackets.special
-		= caerSpecialEventPacketAllocate(DVS132S_SPECIAL_DEFAULT_SIZE, I16T(handle->info.deviceID), 0);
-	if (state->currentPackets.special == NULL) {
-		freeAllDataMemory(state);
-
-		dvs132sLog(CAER_LOG_CRITICAL, handle, "Failed to allocate special event packet.");
-		return (false);
-	}
-
-	state->currentPackets.imu6 = caerIMU6EventPacketAllocate(DVS132S_IMU_DEFAULT_SIZE, I16T(handle->info.deviceID), 0);
-	if (state->currentPackets.imu6 == NULL) {
+	// Allocate packets.
+	containerGenerationPacketsInit(&state->container, DVS132S_EVENT_TYPES, I16T(handle->info.deviceID),
+		handle->info.deviceString, &state->deviceLogLevel);
+	containerGenerationPacketsAdd(&state->container, POLARITY_EVENT, POLARITY_EVENT, &state->currentPackets.polarity,
+		&state->currentPackets.polarityPosition, DVS132S_POLARITY_DEFAULT_SIZE, 4);
+	containerGenerationPacketsAdd(&state->container, SPECIAL_EVENT, SPECIAL_EVENT, &state->currentPackets.special,
+		&state->currentPackets.specialPosition, DVS132S_SPECIAL_DEFAULT_SIZE, 1);
+	containerGenerationPacketsAdd(&state->container, IMU6_EVENT_PKT_POS, IMU6_EVENT, &state->currentPackets.imu6,
+		&state->currentPackets.imu6Position, DVS132S_IMU_DEFAULT_SIZE, 0);
+
+	if (!containerGenerationPacketsAllocate(&state->container, 0, 0)) {
 		freeAllDataMemory(state);
-
-		dvs132sLog(CAER_LOG_CRITICAL, handle, "Failed to allocate IMU6 event packet.");
 		return (false);
 	}
 
@@ -1078,24 +1056,46 @@ caerEventPacketContainer dvs132sDataGet(caerDeviceHandle cdh) {
 	return (dataExchangeGet(&state->dataExchange, &state->usbState.dataTransfersRun));
 }
 
+size_t dvs132sDataGetMany(caerDeviceHandle cdh, caerEventPacketContainer *containers, size_t containersNumber) {
+	dvs132sHandle handle = (dvs132sHandle) cdh;
+	dvs132sState state   = &handle->state;
+
+	return (dataExchangeGetMany(&state->dataExchange, &state->usbState.dataTransfersRun, containers, containersNumber));
+}
+
+int dvs132sDataGetFD(caerDeviceHandle cdh) {
+	dvs132sHandle handle = (dvs132sHandle) cdh;
+	dvs132sState state   = &handle->state;
+
+	return (dataExchangeGetFD(&state->dataExchange));
+}
+
+void dvs132sDataRecycle(caerDeviceHandle cdh, caerEventPacketContainer container) {
+	dvs132sHandle handle = (dvs132sHandle) cdh;
+	dvs132sState state   = &handle->state;
+
+	containerGenerationRecycle(&state->container, container);
+}
+
 #define TS_WRAP_ADD 0x8000
 
-static inline bool ensureSpaceForEvents(
-	caerEventPacketHeader *packet, size_t position, size_t numEvents, dvs132sHandle handle) {
-	if ((position + numEvents) <= (size_t) caerEventPacketHeaderGetEventCapacity(*packet)) {
-		return (true);
-	}
+// Commit all non-empty packets in a container, and then the container itself.
+static void dvs132sContainerCommit(dvs132sHandle handle, bool tsReset, bool tsBigWrap) {
+	dvs132sState state = &handle->state;
 
-	caerEventPacketHeader grownPacket
-		= caerEventPacketGrow(*packet, caerEventPacketHeaderGetEventCapacity(*packet) * 2);
-	if (grownPacket == NULL) {
-		dvs132sLog(CAER_LOG_CRITICAL, handle, "Failed to grow event packet of type %d.",
-			caerEventPacketHeaderGetEventType(*packet));
-		return (false);
+	if (tsReset || tsBigWrap) {
+		// Ignore all IMU6 (composite) events, until a new IMU6
+		// Start event comes in, for the next packet.
+		// This is to correctly support the forced packet commits that a TS reset,
+		// or a TS big wrap, impose. Continuing to parse events would result
+		// in a corrupted state of the first event in the new packet, as it would
+		// be incomplete, incorrect and miss vital initialization data.
+		// See IMU6 END states for more details on a related issue.
+		state->imu.ignoreEvents = true;
 	}
 
-	*packet = grownPacket;
-	return (true);
+	containerGenerationPacketsCommit(&state->container, tsReset, state->timestamps.wrapOverflow,
+		state->timestamps.current, &state->dataExchange, &state->usbState.dataTransfersRun);
 }
 
 static void dvs132sEventTranslator(void *vhd, const uint8_t *buffer, size_t bufferSize) {
@@ -1110,46 +1110,24 @@ static void dvs132sEventTranslator(void *vhd, const uint8_t *buffer, size_t buff
 		return;
 	}
 
+	statisticsAddBytes(&state->dataExchange.statistics, bufferSize);
+
 	// Truncate off any extra partial event.
 	if ((bufferSize & 0x01) != 0) {
 		dvs132sLog(CAER_LOG_ALERT, handle, "%zu bytes received via USB, which is not a multiple of two.", bufferSize);
 		bufferSize &= ~((size_t) 0x01);
 	}
 
-	for (size_t bufferPos = 0; bufferPos < bufferSize; bufferPos += 2) {
-		// Allocate new packets for next iteration as needed.
-		if (!containerGenerationAllocate(&state->container, DVS132S_EVENT_TYPES)) {
-			dvs132sLog(CAER_LOG_CRITICAL, handle, "Failed to allocate event packet container.");
-			return;
-		}
-
-		if (state->currentPackets.special == NULL) {
-			state->currentPackets.special = caerSpecialEventPacketAllocate(
-				DVS132S_SPECIAL_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
-			if (state->currentPackets.special == NULL) {
-				dvs132sLog(CAER_LOG_CRITICAL, handle, "Failed to allocate special event packet.");
-				return;
-			}
-		}
-
-		if (state->currentPackets.polarity == NULL) {
-			state->currentPackets.polarity = caerPolarityEventPacketAllocate(
-				DVS132S_POLARITY_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
-			if (state->currentPackets.polarity == NULL) {
-				dvs132sLog(CAER_LOG_CRITICAL, handle, "Failed to allocate polarity event packet.");
-				return;
-			}
-		}
-
-		if (state->currentPackets.imu6 == NULL) {
-			state->currentPackets.imu6 = caerIMU6EventPacketAllocate(
-				DVS132S_IMU_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
-			if (state->currentPackets.imu6 == NULL) {
-				dvs132sLog(CAER_LOG_CRITICAL, handle, "Failed to allocate IMU6 event packet.");
-				return;
-			}
-		}
+	// Packets only go away on commit, so they're allocated once here, and
+	// then again only after commits, instead of being checked every event.
+	// Every 2 byte word generates at most four polarity events (one pixel
+	// group) or one special event. IMU samples are checked on completion.
+	if ((bufferSize > 0)
+		&& !containerGenerationPacketsAllocate(&state->container, bufferSize / 2, state->timestamps.wrapOverflow)) {
+		return;
+	}
 
+	for (size_t bufferPos = 0; bufferPos < bufferSize; bufferPos += 2) {
 		bool tsReset   = false;
 		bool tsBigWrap = false;
 
@@ -1196,15 +1174,12 @@ static void dvs132sEventTranslator(void *vhd, const uint8_t *buffer, size_t buff
 						case 2: { // External input (falling edge)
 							dvs132sLog(CAER_LOG_DEBUG, handle, "External input (falling edge) event received.");
 
-							if (ensureSpaceForEvents((caerEventPacketHeader *) &state->currentPackets.special,
-									(size_t) state->currentPackets.specialPosition, 1, handle)) {
-								caerSpecialEvent currentSpecialEvent = caerSpecialEventPacketGetEvent(
-									state->currentPackets.special, state->currentPackets.specialPosition);
-								caerSpecialEventSetTimestamp(currentSpecialEvent, state->timestamps.current);
-								caerSpecialEventSetType(currentSpecialEvent, EXTERNAL_INPUT_FALLING_EDGE);
-								caerSpecialEventValidate(currentSpecialEvent, state->currentPackets.special);
-								state->currentPackets.specialPosition++;
-							}
+							caerSpecialEvent currentSpecialEvent = caerSpecialEventPacketGetEvent(
+								state->currentPackets.special, state->currentPackets.specialPosition);
+							caerSpecialEventSetTimestamp(currentSpecialEvent, state->timestamps.current);
+							caerSpecialEventSetType(currentSpecialEvent, EXTERNAL_INPUT_FALLING_EDGE);
+							caerSpecialEventValidate(currentSpecialEvent, state->currentPackets.special);
+							state->currentPackets.specialPosition++;
 
 							break;
 						}
@@ -1212,15 +1187,12 @@ static void dvs132sEventTranslator(void *vhd, const uint8_t *buffer, size_t buff
 						case 3: { // External input (rising edge)
 							dvs132sLog(CAER_LOG_DEBUG, handle, "External input (rising edge) event received.");
 
-							if (ensureSpaceForEvents((caerEventPacketHeader *) &state->currentPackets.special,
-									(size_t) state->currentPackets.specialPosition, 1, handle)) {
-								caerSpecialEvent currentSpecialEvent = caerSpecialEventPacketGetEvent(
-									state->currentPackets.special, state->currentPackets.specialPosition);
-								caerSpecialEventSetTimestamp(currentSpecialEvent, state->timestamps.current);
-								caerSpecialEventSetType(currentSpecialEvent, EXTERNAL_INPUT_RISING_EDGE);
-								caerSpecialEventValidate(currentSpecialEvent, state->currentPackets.special);
-								state->currentPackets.specialPosition++;
-							}
+							caerSpecialEvent currentSpecialEvent = caerSpecialEventPacketGetEvent(
+								state->currentPackets.special, state->currentPackets.specialPosition);
+							caerSpecialEventSetTimestamp(currentSpecialEvent, state->timestamps.current);
+							caerSpecialEventSetType(currentSpecialEvent, EXTERNAL_INPUT_RISING_EDGE);
+							caerSpecialEventValidate(currentSpecialEvent, state->currentPackets.special);
+							state->currentPackets.specialPosition++;
 
 							break;
 						}
@@ -1228,15 +1200,12 @@ static void dvs132sEventTranslator(void *vhd, const uint8_t *buffer, size_t buff
 						case 4: { // External input (pulse)
 							dvs132sLog(CAER_LOG_DEBUG, handle, "External input (pulse) event received.");
 
-							if (ensureSpaceForEvents((caerEventPacketHeader *) &state->currentPackets.special,
-									(size_t) state->currentPackets.specialPosition, 1, handle)) {
-								caerSpecialEvent currentSpecialEvent = caerSpecialEventPacketGetEvent(
-									state->currentPackets.special, state->currentPackets.specialPosition);
-								caerSpecialEventSetTimestamp(currentSpecialEvent, state->timestamps.current);
-								caerSpecialEventSetType(currentSpecialEvent, EXTERNAL_INPUT_PULSE);
-								caerSpecialEventValidate(currentSpecialEvent, state->currentPackets.special);
-								state->currentPackets.specialPosition++;
-							}
+							caerSpecialEvent currentSpecialEvent = caerSpecialEventPacketGetEvent(
+								state->currentPackets.special, state->currentPackets.specialPosition);
+							caerSpecialEventSetTimestamp(currentSpecialEvent, state->timestamps.current);
+							caerSpecialEventSetType(currentSpecialEvent, EXTERNAL_INPUT_PULSE);
+							caerSpecialEventValidate(currentSpecialEvent, state->currentPackets.special);
+							state->currentPackets.specialPosition++;
 
 							break;
 						}
@@ -1275,8 +1244,7 @@ static void dvs132sEventTranslator(void *vhd, const uint8_t *buffer, size_t buff
 								// possible data loss would be too significant. So instead we keep a private event,
 								// fill it, and then only copy it into the packet here in the END state, at which point
 								// the whole event is ready and cannot be broken/corrupted in any way anymore.
-								if (ensureSpaceForEvents((caerEventPacketHeader *) &state->currentPackets.imu6,
-										(size_t) state->currentPackets.imu6Position, 1, handle)) {
+								if (containerGenerationPacketReserve(&state->container, IMU6_EVENT_PKT_POS, 1)) {
 									caerIMU6Event imuCurrentEvent = caerIMU6EventPacketGetEvent(
 										state->currentPackets.imu6, state->currentPackets.imu6Position);
 									memcpy(imuCurrentEvent, &state->imu.currentEvent, sizeof(struct caer_imu6_event));
@@ -1295,15 +1263,12 @@ static void dvs132sEventTranslator(void *vhd, const uint8_t *buffer, size_t buff
 						case 16: { // External generator (falling edge)
 							dvs132sLog(CAER_LOG_DEBUG, handle, "External generator (falling edge) event received.");
 
-							if (ensureSpaceForEvents((caerEventPacketHeader *) &state->currentPackets.special,
-									(size_t) state->currentPackets.specialPosition, 1, handle)) {
-								caerSpecialEvent currentSpecialEvent = caerSpecialEventPacketGetEvent(
-									state->currentPackets.special, state->currentPackets.specialPosition);
-								caerSpecialEventSetTimestamp(currentSpecialEvent, state->timestamps.current);
-								caerSpecialEventSetType(currentSpecialEvent, EXTERNAL_GENERATOR_FALLING_EDGE);
-								caerSpecialEventValidate(currentSpecialEvent, state->currentPackets.special);
-								state->currentPackets.specialPosition++;
-							}
+							caerSpecialEvent currentSpecialEvent = caerSpecialEventPacketGetEvent(
+								state->currentPackets.special, state->currentPackets.specialPosition);
+							caerSpecialEventSetTimestamp(currentSpecialEvent, state->timestamps.current);
+							caerSpecialEventSetType(currentSpecialEvent, EXTERNAL_GENERATOR_FALLING_EDGE);
+							caerSpecialEventValidate(currentSpecialEvent, state->currentPackets.special);
+							state->currentPackets.specialPosition++;
 
 							break;
 						}
@@ -1311,15 +1276,12 @@ static void dvs132sEventTranslator(void *vhd, const uint8_t *buffer, size_t buff
 						case 17: { // External generator (rising edge)
 							dvs132sLog(CAER_LOG_DEBUG, handle, "External generator (rising edge) event received.");
 
-							if (ensureSpaceForEvents((caerEventPacketHeader *) &state->currentPackets.special,
-									(size_t) state->currentPackets.specialPosition, 1, handle)) {
-								caerSpecialEvent currentSpecialEvent = caerSpecialEventPacketGetEvent(
-									state->currentPackets.special, state->currentPackets.specialPosition);
-								caerSpecialEventSetTimestamp(currentSpecialEvent, state->timestamps.current);
-								caerSpecialEventSetType(currentSpecialEvent, EXTERNAL_GENERATOR_RISING_EDGE);
-								caerSpecialEventValidate(currentSpecialEvent, state->currentPackets.special);
-								state->currentPackets.specialPosition++;
-							}
+							caerSpecialEvent currentSpecialEvent = caerSpecialEventPacketGetEvent(
+								state->currentPackets.special, state->currentPackets.specialPosition);
+							caerSpecialEventSetTimestamp(currentSpecialEvent, state->timestamps.current);
+							caerSpecialEventSetType(currentSpecialEvent, EXTERNAL_GENERATOR_RISING_EDGE);
+							caerSpecialEventValidate(currentSpecialEvent, state->currentPackets.special);
+							state->currentPackets.specialPosition++;
 
 							break;
 						}
@@ -1355,98 +1317,95 @@ static void dvs132sEventTranslator(void *vhd, const uint8_t *buffer, size_t buff
 					break;
 
 				case 3: { // 4-pixel group event presence and polarity.
-					if (ensureSpaceForEvents((caerEventPacketHeader *) &state->currentPackets.polarity,
-							(size_t) state->currentPackets.polarityPosition, 4, handle)) {
-						bool pres0 = data & 0x0010;
-						bool pres1 = data & 0x0020;
-						bool pres2 = data & 0x0040;
-						bool pres3 = data & 0x0080;
-						bool pol0  = data & 0x0001;
-						bool pol1  = data & 0x0002;
-						bool pol2  = data & 0x0004;
-						bool pol3  = data & 0x0008;
-
-						// Pixel 0: Top Left for host-packet-order.
-						if (pres0) {
-							// Received event!
-							caerPolarityEvent currentPolarityEvent = caerPolarityEventPacketGetEvent(
-								state->currentPackets.polarity, state->currentPackets.polarityPosition);
-
-							// Timestamp at event-stream insertion point.
-							caerPolarityEventSetTimestamp(currentPolarityEvent, state->timestamps.current);
-							caerPolarityEventSetPolarity(currentPolarityEvent, pol0);
-							if (state->dvs.invertXY) {
-								caerPolarityEventSetY(currentPolarityEvent, state->dvs.lastX);
-								caerPolarityEventSetX(currentPolarityEvent, state->dvs.lastY);
-							}
-							else {
-								caerPolarityEventSetY(currentPolarityEvent, state->dvs.lastY);
-								caerPolarityEventSetX(currentPolarityEvent, state->dvs.lastX);
-							}
-							caerPolarityEventValidate(currentPolarityEvent, state->currentPackets.polarity);
-							state->currentPackets.polarityPosition++;
+					bool pres0 = data & 0x0010;
+					bool pres1 = data & 0x0020;
+					bool pres2 = data & 0x0040;
+					bool pres3 = data & 0x0080;
+					bool pol0  = data & 0x0001;
+					bool pol1  = data & 0x0002;
+					bool pol2  = data & 0x0004;
+					bool pol3  = data & 0x0008;
+
+					// Pixel 0: Top Left for host-packet-order.
+					if (pres0) {
+						// Received event!
+						caerPolarityEvent currentPolarityEvent = caerPolarityEventPacketGetEvent(
+							state->currentPackets.polarity, state->currentPackets.polarityPosition);
+
+						// Timestamp at event-stream insertion point.
+						caerPolarityEventSetTimestamp(currentPolarityEvent, state->timestamps.current);
+						caerPolarityEventSetPolarity(currentPolarityEvent, pol0);
+						if (state->dvs.invertXY) {
+							caerPolarityEventSetY(currentPolarityEvent, state->dvs.lastX);
+							caerPolarityEventSetX(currentPolarityEvent, state->dvs.lastY);
+						}
+						else {
+							caerPolarityEventSetY(currentPolarityEvent, state->dvs.lastY);
+							caerPolarityEventSetX(currentPolarityEvent, state->dvs.lastX);
 						}
+						caerPolarityEventValidate(currentPolarityEvent, state->currentPackets.polarity);
+						state->currentPackets.polarityPosition++;
+					}
 
-						// Pixel 1: Top Right for host-packet-order.
-						if (pres1) {
-							// Received event!
-							caerPolarityEvent currentPolarityEvent = caerPolarityEventPacketGetEvent(
-								state->currentPackets.polarity, state->currentPackets.polarityPosition);
-
-							// Timestamp at event-stream insertion point.
-							caerPolarityEventSetTimestamp(currentPolarityEvent, state->timestamps.current);
-							caerPolarityEventSetPolarity(currentPolarityEvent, pol1);
-							if (state->dvs.invertXY) {
-								caerPolarityEventSetY(currentPolarityEvent, U16T(state->dvs.lastX + 1));
-								caerPolarityEventSetX(currentPolarityEvent, state->dvs.lastY);
-							}
-							else {
-								caerPolarityEventSetY(currentPolarityEvent, state->dvs.lastY);
-								caerPolarityEventSetX(currentPolarityEvent, U16T(state->dvs.lastX + 1));
-							}
-							caerPolarityEventValidate(currentPolarityEvent, state->currentPackets.polarity);
-							state->currentPackets.polarityPosition++;
+					// Pixel 1: Top Right for host-packet-order.
+					if (pres1) {
+						// Received event!
+						caerPolarityEvent currentPolarityEvent = caerPolarityEventPacketGetEvent(
+							state->currentPackets.polarity, state->currentPackets.polarityPosition);
+
+						// Timestamp at event-stream insertion point.
+						caerPolarityEventSetTimestamp(currentPolarityEvent, state->timestamps.current);
+						caerPolarityEventSetPolarity(currentPolarityEvent, pol1);
+						if (state->dvs.invertXY) {
+							caerPolarityEventSetY(currentPolarityEvent, U16T(state->dvs.lastX + 1));
+							caerPolarityEventSetX(currentPolarityEvent, state->dvs.lastY);
 						}
+						else {
+							caerPolarityEventSetY(currentPolarityEvent, state->dvs.lastY);
+							caerPolarityEventSetX(currentPolarityEvent, U16T(state->dvs.lastX + 1));
+						}
+						caerPolarityEventValidate(currentPolarityEvent, state->currentPackets.polarity);
+						state->currentPackets.polarityPosition++;
+					}
 
-						if (pres2) {
-							// Received event!
-							caerPolarityEvent currentPolarityEvent = caerPolarityEventPacketGetEvent(
-								state->currentPackets.polarity, state->currentPackets.polarityPosition);
-
-							// Timestamp at event-stream insertion point.
-							caerPolarityEventSetTimestamp(currentPolarityEvent, state->timestamps.current);
-							caerPolarityEventSetPolarity(currentPolarityEvent, pol2);
-							if (state->dvs.invertXY) {
-								caerPolarityEventSetY(currentPolarityEvent, state->dvs.lastX);
-								caerPolarityEventSetX(currentPolarityEvent, U16T(state->dvs.lastY + 1));
-							}
-							else {
-								caerPolarityEventSetY(currentPolarityEvent, U16T(state->dvs.lastY + 1));
-								caerPolarityEventSetX(currentPolarityEvent, state->dvs.lastX);
-							}
-							caerPolarityEventValidate(currentPolarityEvent, state->currentPackets.polarity);
-							state->currentPackets.polarityPosition++;
+					if (pres2) {
+						// Received event!
+						caerPolarityEvent currentPolarityEvent = caerPolarityEventPacketGetEvent(
+							state->currentPackets.polarity, state->currentPackets.polarityPosition);
+
+						// Timestamp at event-stream insertion point.
+						caerPolarityEventSetTimestamp(currentPolarityEvent, state->timestamps.current);
+						caerPolarityEventSetPolarity(currentPolarityEvent, pol2);
+						if (state->dvs.invertXY) {
+							caerPolarityEventSetY(currentPolarityEvent, state->dvs.lastX);
+							caerPolarityEventSetX(currentPolarityEvent, U16T(state->dvs.lastY + 1));
+						}
+						else {
+							caerPolarityEventSetY(currentPolarityEvent, U16T(state->dvs.lastY + 1));
+							caerPolarityEventSetX(currentPolarityEvent, state->dvs.lastX);
 						}
+						caerPolarityEventValidate(currentPolarityEvent, state->currentPackets.polarity);
+						state->currentPackets.polarityPosition++;
+					}
 
-						if (pres3) {
-							// Received event!
-							caerPolarityEvent currentPolarityEvent = caerPolarityEventPacketGetEvent(
-								state->currentPackets.polarity, state->currentPackets.polarityPosition);
-
-							// Timestamp at event-stream insertion point.
-							caerPolarityEventSetTimestamp(currentPolarityEvent, state->timestamps.current);
-							caerPolarityEventSetPolarity(currentPolarityEvent, pol3);
-							if (state->dvs.invertXY) {
-								caerPolarityEventSetY(currentPolarityEvent, U16T(state->dvs.lastX + 1));
-								caerPolarityEventSetX(currentPolarityEvent, U16T(state->dvs.lastY + 1));
-							}
-							else {
-								caerPolarityEventSetY(currentPolarityEvent, U16T(state->dvs.lastY + 1));
-								caerPolarityEventSetX(currentPolarityEvent, U16T(state->dvs.lastX + 1));
-							}
-							caerPolarityEventValidate(currentPolarityEvent, state->currentPackets.polarity);
-							state->currentPackets.polarityPosition++;
+					if (pres3) {
+						// Received event!
+						caerPolarityEvent currentPolarityEvent = caerPolarityEventPacketGetEvent(
+							state->currentPackets.polarity, state->currentPackets.polarityPosition);
+
+						// Timestamp at event-stream insertion point.
+						caerPolarityEventSetTimestamp(currentPolarityEvent, state->timestamps.current);
+						caerPolarityEventSetPolarity(currentPolarityEvent, pol3);
+						if (state->dvs.invertXY) {
+							caerPolarityEventSetY(currentPolarityEvent, U16T(state->dvs.lastX + 1));
+							caerPolarityEventSetX(currentPolarityEvent, U16T(state->dvs.lastY + 1));
 						}
+						else {
+							caerPolarityEventSetY(currentPolarityEvent, U16T(state->dvs.lastY + 1));
+							caerPolarityEventSetX(currentPolarityEvent, U16T(state->dvs.lastX + 1));
+						}
+						caerPolarityEventValidate(currentPolarityEvent, state->currentPackets.polarity);
+						state->currentPackets.polarityPosition++;
 					}
 
 					break;
@@ -1615,15 +1574,12 @@ static void dvs132sEventTranslator(void *vhd, const uint8_t *buffer, size_t buff
 						&state->timestamps, data, TS_WRAP_ADD, handle->info.deviceString, &state->deviceLogLevel);
 
 					if (tsBigWrap) {
-						if (ensureSpaceForEvents((caerEventPacketHeader *) &state->currentPackets.special,
-								(size_t) state->currentPackets.specialPosition, 1, handle)) {
-							caerSpecialEvent currentSpecialEvent = caerSpecialEventPacketGetEvent(
-								state->currentPackets.special, state->currentPackets.specialPosition);
-							caerSpecialEventSetTimestamp(currentSpecialEvent, INT32_MAX);
-							caerSpecialEventSetType(currentSpecialEvent, TIMESTAMP_WRAP);
-							caerSpecialEventValidate(currentSpecialEvent, state->currentPackets.special);
-							state->currentPackets.specialPosition++;
-						}
+						caerSpecialEvent currentSpecialEvent = caerSpecialEventPacketGetEvent(
+							state->currentPackets.special, state->currentPackets.specialPosition);
+						caerSpecialEventSetTimestamp(currentSpecialEvent, INT32_MAX);
+						caerSpecialEventSetType(currentSpecialEvent, TIMESTAMP_WRAP);
+						caerSpecialEventValidate(currentSpecialEvent, state->currentPackets.special);
+						state->currentPackets.specialPosition++;
 					}
 					else {
 						containerGenerationCommitTimestampInit(&state->container, state->timestamps.current);
@@ -1653,53 +1609,21 @@ static void dvs132sEventTranslator(void *vhd, const uint8_t *buffer, size_t buff
 		// Commit packet containers to the ring-buffer, so they can be processed by the
 		// main-loop, when any of the required conditions are met.
 		if (tsReset || tsBigWrap || containerSizeCommit || containerTimeCommit) {
-			// One or more of the commit triggers are hit. Set the packet container up to contain
-			// any non-empty packets. Empty packets are not forwarded to save memory.
-			bool emptyContainerCommit = true;
+			dvs132sContainerCommit(handle, tsReset, tsBigWrap);
 
-			if (state->currentPackets.polarityPosition > 0) {
-				containerGenerationSetPacket(
-					&state->container, POLARITY_EVENT, (caerEventPacketHeader) state->currentPackets.polarity);
-
-				state->currentPackets.polarity         = NULL;
-				state->currentPackets.polarityPosition = 0;
-				emptyContainerCommit                   = false;
-			}
-
-			if (state->currentPackets.specialPosition > 0) {
-				containerGenerationSetPacket(
-					&state->container, SPECIAL_EVENT, (caerEventPacketHeader) state->currentPackets.special);
-
-				state->currentPackets.special         = NULL;
-				state->currentPackets.specialPosition = 0;
-				emptyContainerCommit                  = false;
-			}
-
-			if (state->currentPackets.imu6Position > 0) {
-				containerGenerationSetPacket(
-					&state->container, IMU6_EVENT_PKT_POS, (caerEventPacketHeader) state->currentPackets.imu6);
-
-				state->currentPackets.imu6         = NULL;
-				state->currentPackets.imu6Position = 0;
-				emptyContainerCommit               = false;
-			}
-
-			if (tsReset || tsBigWrap) {
-				// Ignore all IMU6 (composite) events, until a new IMU6
-				// Start event comes in, for the next packet.
-				// This is to correctly support the forced packet commits that a TS reset,
-				// or a TS big wrap, impose. Continuing to parse events would result
-				// in a corrupted state of the first event in the new packet, as it would
-				// be incomplete, incorrect and miss vital initialization data.
-				// See IMU6 END states for more details on a related issue.
-				state->imu.ignoreEvents = true;
+			// Allocate new packets for the rest of the buffer.
+			if (((bufferPos + 2) < bufferSize)
+				&& !containerGenerationPacketsAllocate(
+					&state->container, (bufferSize - (bufferPos + 2)) / 2, state->timestamps.wrapOverflow)) {
+				return;
 			}
-
-			containerGenerationExecute(&state->container, emptyContainerCommit, tsReset, state->timestamps.wrapOverflow,
-				state->timestamps.current, &state->dataExchange, &state->usbState.dataTransfersRun,
-				handle->info.deviceID, handle->info.deviceString, &state->deviceLogLevel);
 		}
 	}
+
+	// Commit a container pending for too long, also when called without data (device idle).
+	if (containerGenerationIsLatencyElapsed(&state->container)) {
+		dvs132sContainerCommit(handle, false, false);
+	}
 }
 
 static void dvs132sTSMasterStatusUpdater(void *userDataPtr, int status, uint32_t param) {
@@ -1828,6 +1752,11 @@ uint32_t caerBiasCoarseFine1024ToCurrent(struct caer_bias_coarsefine1024 coarseF
 /// FX3 Debug Transfer Support ///
 //////////////////////////////////
 static void allocateDebugTransfers(dvs132sHandle handle) {
+	// No debug channel when replaying a capture file.
+	if (usbReplayActive(&handle->state.usbState)) {
+		return;
+	}
+
 	// Allocate transfers and set them up.
 	for (size_t i = 0; i < DEBUG_TRANSFER_NUM; i++) {
 		handle->state.fx3Support.debugTransfers[i] = libusb_alloc_transfer(0);
@@ -119,5 +119,8 @@ bool dvs132sDataStart(caerDeviceHandle handle, void (*dataNotifyIncrease)(void *
 	void *dataShutdownUserPtr);
 bool dvs132sDataStop(caerDeviceHandle handle);
 caerEventPacketContainer dvs132sDataGet(caerDeviceHandle handle);
+size_t dvs132sDataGetMany(caerDeviceHandle handle, caerEventPacketContainer *containers, size_t containersNumber);
+int dvs132sDataGetFD(caerDeviceHandle handle);
+void dvs132sDataRecycle(caerDeviceHandle handle, caerEventPacketContainer container);
 
 #endif /* LIBCAER_SRC_DVS132S_H_ */
@@ -108,30 +108,6 @@ static inline float calculateIMUGyroScale(uint8_t imuGyroScale) {
 static inline void freeAllDataMemory(dvXplorerState state) {
 	dataExchangeDestroy(&state->dataExchange);
 
-	// Since the current event packets aren't necessarily
-	// already assigned to the current packet container, we
-	// free them separately from it.
-	if (state->currentPackets.polarity != NULL) {
-		free(&state->currentPackets.polarity->packetHeader);
-		state->currentPackets.polarity = NULL;
-
-		containerGenerationSetPacket(&state->container, POLARITY_EVENT, NULL);
-	}
-
-	if (state->currentPackets.special != NULL) {
-		free(&state->currentPackets.special->packetHeader);
-		state->currentPackets.special = NULL;
-
-		containerGenerationSetPacket(&state->container, SPECIAL_EVENT, NULL);
-	}
-
-	if (state->currentPackets.imu6 != NULL) {
-		free(&state->currentPackets.imu6->packetHeader);
-		state->currentPackets.imu6 = NULL;
-
-		containerGenerationSetPacket(&state->container, IMU6_EVENT_PKT_POS, NULL);
-	}
-
 	containerGenerationDestroy(&state->container);
 }
 
@@ -519,9 +495,18 @@ bool dvXplorerConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr,
 			break;
 
 		case CAER_HOST_CONFIG_PACKETS:
+			if (paramAddr == CAER_HOST_CONFIG_PACKETS_MAX_CONTAINER_LATENCY) {
+				// Wake up often enough to commit on time, even without new data.
+				usbSetDataIdleInterval(&state->usbState, param);
+			}
+
 			return (containerGenerationConfigSet(&state->container, paramAddr, param));
 			break;
 
+		case CAER_HOST_CONFIG_STATISTICS:
+			return (statisticsConfigSet(&state->dataExchange.statistics, paramAddr, param));
+			break;
+
 		case CAER_HOST_CONFIG_LOG:
 			switch (paramAddr) {
 				case CAER_HOST_CONFIG_LOG_LEVEL:
@@ -1423,6 +1408,10 @@ bool dvXplorerConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr,
 			return (containerGenerationConfigGet(&state->container, paramAddr, param));
 			break;
 
+		case CAER_HOST_CONFIG_STATISTICS:
+			return (statisticsConfigGet(&state->dataExchange.statistics, paramAddr, param));
+			break;
+
 		case CAER_HOST_CONFIG_LOG:
 			switch (paramAddr) {
 				case CAER_HOST_CONFIG_LOG_LEVEL:
@@ -2338,38 +2327,26 @@ bool dvXplorerDataStart(caerDeviceHandle cdh, void (*dataNotifyIncrease)(void *p
 		return (false);
 	}
 
-	// Allocate packets.
-	if (!containerGenerationAllocate(&state->container, DVXPLORER_EVENT_TYPES)) {
+	// Prepare container recycling pool.
+	if (!containerGenerationPoolInit(&state->container)) {
 		freeAllDataMemory(state);
 
-		dvXplorerLog(CAER_LOG_CRITICAL, handle, "Failed to allocate event packet container.");
+		dvXplorerLog(CAER_LOG_CRITICAL, handle, "Failed to initialize event packet container pool.");
 		return (false);
 	}
 
-	state->currentPackets.polarity
-		= caerPolarityEventPacketAllocate(DVXPLORER_POLARITY_DEFAULT_SIZE, I16T(handle->info.deviceID), 0);
-	if (state->currentPackets.polarity == NULL) {
-		freeAllDataMemory(state);
-
-		dvXplorerLog(CAER_LOG_CRITICAL, handle, "Failed to allocate polarity event packet.");
-		return (false);
-	}
-
-	state->currentPackets.special
-		= caerSpecialEventPacketAllocate(SAMSUNG_EVKPECIAL_DEFAULT_SIZE, I16T(handle->info.deviceID), 0);
-	if (state->currentPackets.special == NULL) {
-		freeAllDataMemory(state);
-
-		dvXplorerLog(CAER_LOG_CRITICAL, handle, "Failed to allocate special event packet.");
-		return (false);
-	}
-
-	state->currentPackets.imu6
-		= caerIMU6EventPacketAllocate(DVXPLORER_IMU_DEFAULT_SIZE, I16T(handle->info.deviceID), 0);
-	if (state->currentPackets.imu6 == NULL) {
+	// Allocate packets.
+	containerGenerationPacketsInit(&state->container, DVXPLORER_EVENT_TYPES, I16T(handle->info.deviceID),
+		handle->info.deviceString, &state->deviceLogLevel);
+	containerGenerationPacketsAdd(&state->container, POLARITY_EVENT, POLARITY_EVENT, &state->currentPackets.polarity,
+		&state->currentPackets.polarityPosition, DVXPLORER_POLARITY_DEFAULT_SIZE, 8);
+	containerGenerationPacketsAdd(&state->container, SPECIAL_EVENT, SPECIAL_EVENT, &state->currentPackets.special,
+		&state->currentPackets.specialPosition, SAMSUNG_EVKPECIAL_DEFAULT_SIZE, 1);
+	containerGenerationPacketsAdd(&state->container, IMU6_EVENT_PKT_POS, IMU6_EVENT, &state->currentPackets.imu6,
+		&state->currentPackets.imu6Position, DVXPLORER_IMU_DEFAULT_SIZE, 0);
+
+	if (!containerGenerationPacketsAllocate(&state->container, 0, 0)) {
 		freeAllDataMemory(state);
-
-		dvXplorerLog(CAER_LOG_CRITICAL, handle, "Failed to allocate IMU6 event packet.");
 		return (false);
 	}
 
@@ -2472,24 +2449,46 @@ caerEventPacketContainer dvXplorerDataGet(caerDeviceHandle cdh) {
 	return (dataExchangeGet(&state->dataExchange, &state->usbState.dataTransfersRun));
 }
 
+size_t dvXplorerDataGetMany(caerDeviceHandle cdh, caerEventPacketContainer *containers, size_t containersNumber) {
+	dvXplorerHandle handle = (dvXplorerHandle) cdh;
+	dvXplorerState state   = &handle->state;
+
+	return (dataExchangeGetMany(&state->dataExchange, &state->usbState.dataTransfersRun, containers, containersNumber));
+}
+
+int dvXplorerDataGetFD(caerDeviceHandle cdh) {
+	dvXplorerHandle handle = (dvXplorerHandle) cdh;
+	dvXplorerState state   = &handle->state;
+
+	return (dataExchangeGetFD(&state->dataExchange));
+}
+
+void dvXplorerDataRecycle(caerDeviceHandle cdh, caerEventPacketContainer container) {
+	dvXplorerHandle handle = (dvXplorerHandle) cdh;
+	dvXplorerState state   = &handle->state;
+
+	containerGenerationRecycle(&state->container, container);
+}
+
 #define TS_WRAP_ADD 0x8000
 
-static inline bool ensureSpaceForEvents(
-	caerEventPacketHeader *packet, size_t position, size_t numEvents, dvXplorerHandle handle) {
-	if ((position + numEvents) <= (size_t) caerEventPacketHeaderGetEventCapacity(*packet)) {
-		return (true);
-	}
+// Commit all non-empty packets in a container, and then the container itself.
+static void dvXplorerContainerCommit(dvXplorerHandle handle, bool tsReset, bool tsBigWrap) {
+	dvXplorerState state = &handle->state;
 
-	caerEventPacketHeader grownPacket
-		= caerEventPacketGrow(*packet, caerEventPacketHeaderGetEventCapacity(*packet) * 2);
-	if (grownPacket == NULL) {
-		dvXplorerLog(CAER_LOG_CRITICAL, handle, "Failed to grow event packet of type %d.",
-			caerEventPacketHeaderGetEventType(*packet));
-		return (false);
+	if (tsReset || tsBigWrap) {
+		// Ignore all IMU6 (composite) events, until a new IMU6
+		// Start event comes in, for the next packet.
+		// This is to correctly support the forced packet commits that a TS reset,
+		// or a TS big wrap, impose. Continuing to parse events would result
+		// in a corrupted state of the first event in the new packet, as it would
+		// be incomplete, incorrect and miss vital initialization data.
+		// See IMU6 END states for more details on a related issue.
+		state->imu.ignoreEvents = true;
 	}
 
-	*packet = grownPacket;
-	return (true);
+	containerGenerationPacketsCommit(&state->container, tsReset, state->timestamps.wrapOverflow,
+		state->timestamps.current, &state->dataExchange, &state->usbState.dataTransfersRun);
 }
 
 static void dvXplorerEventTranslator(void *vhd, const uint8_t *buffer, size_t bufferSize) {
@@ -2504,46 +2503,24 @@ static void dvXplorerEventTranslator(void *vhd, const uint8_t *buffer, size_t bu
 		return;
 	}
 
+	statisticsAddBytes(&state->dataExchange.statistics, bufferSize);
+
 	// Truncate off any extra partial event.
 	if ((bufferSize & 0x01) != 0) {
 		dvXplorerLog(CAER_LOG_ALERT, handle, "%zu bytes received via USB, which is not a multiple of two.", bufferSize);
 		bufferSize &= ~((size_t) 0x01);
 	}
 
-	for (size_t bufferPos = 0; bufferPos < bufferSize; bufferPos += 2) {
-		// Allocate new packets for next iteration as needed.
-		if (!containerGenerationAllocate(&state->container, DVXPLORER_EVENT_TYPES)) {
-			dvXplorerLog(CAER_LOG_CRITICAL, handle, "Failed to allocate event packet container.");
-			return;
-		}
-
-		if (state->currentPackets.special == NULL) {
-			state->currentPackets.special = caerSpecialEventPacketAllocate(
-				SAMSUNG_EVKPECIAL_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
-			if (state->currentPackets.special == NULL) {
-				dvXplorerLog(CAER_LOG_CRITICAL, handle, "Failed to allocate special event packet.");
-				return;
-			}
-		}
-
-		if (state->currentPackets.polarity == NULL) {
-			state->currentPackets.polarity = caerPolarityEventPacketAllocate(
-				DVXPLORER_POLARITY_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
-			if (state->currentPackets.polarity == NULL) {
-				dvXplorerLog(CAER_LOG_CRITICAL, handle, "Failed to allocate polarity event packet.");
-				return;
-			}
-		}
-
-		if (state->currentPackets.imu6 == NULL) {
-			state->currentPackets.imu6 = caerIMU6EventPacketAllocate(
-				DVXPLORER_IMU_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
-			if (state->currentPackets.imu6 == NULL) {
-				dvXplorerLog(CAER_LOG_CRITICAL, handle, "Failed to allocate IMU6 event packet.");
-				return;
-			}
-		}
+	// Packets only go away on commit, so they're allocated once here, and
+	// then again only after commits, instead of being checked every event.
+	// Every 2 byte word generates at most eight polarity events (one pixel
+	// group) or one special event. IMU samples are checked on completion.
+	if ((bufferSize > 0)
+		&& !containerGenerationPacketsAllocate(&state->container, bufferSize / 2, state->timestamps.wrapOverflow)) {
+		return;
+	}
 
+	for (size_t bufferPos = 0; bufferPos < bufferSize; bufferPos += 2) {
 		bool tsReset   = false;
 		bool tsBigWrap = false;
 
@@ -2590,15 +2567,12 @@ static void dvXplorerEventTranslator(void *vhd, const uint8_t *buffer, size_t bu
 						case 2: { // External input (falling edge)
 							dvXplorerLog(CAER_LOG_DEBUG, handle, "External input (falling edge) event received.");
 
-							if (ensureSpaceForEvents((caerEventPacketHeader *) &state->currentPackets.special,
-									(size_t) state->currentPackets.specialPosition, 1, handle)) {
-								caerSpecialEvent currentSpecialEvent = caerSpecialEventPacketGetEvent(
-									state->currentPackets.special, state->currentPackets.specialPosition);
-								caerSpecialEventSetTimestamp(currentSpecialEvent, state->timestamps.current);
-								caerSpecialEventSetType(currentSpecialEvent, EXTERNAL_INPUT_FALLING_EDGE);
-								caerSpecialEventValidate(currentSpecialEvent, state->currentPackets.special);
-								state->currentPackets.specialPosition++;
-							}
+							caerSpecialEvent currentSpecialEvent = caerSpecialEventPacketGetEvent(
+								state->currentPackets.special, state->currentPackets.specialPosition);
+							caerSpecialEventSetTimestamp(currentSpecialEvent, state->timestamps.current);
+							caerSpecialEventSetType(currentSpecialEvent, EXTERNAL_INPUT_FALLING_EDGE);
+							caerSpecialEventValidate(currentSpecialEvent, state->currentPackets.special);
+							state->currentPackets.specialPosition++;
 
 							break;
 						}
@@ -2606,15 +2580,12 @@ static void dvXplorerEventTranslator(void *vhd, const uint8_t *buffer, size_t bu
 						case 3: { // External input (rising edge)
 							dvXplorerLog(CAER_LOG_DEBUG, handle, "External input (rising edge) event received.");
 
-							if (ensureSpaceForEvents((caerEventPacketHeader *) &state->currentPackets.special,
-									(size_t) state->currentPackets.specialPosition, 1, handle)) {
-								caerSpecialEvent currentSpecialEvent = caerSpecialEventPacketGetEvent(
-									state->currentPackets.special, state->currentPackets.specialPosition);
-								caerSpecialEventSetTimestamp(currentSpecialEvent, state->timestamps.current);
-								caerSpecialEventSetType(currentSpecialEvent, EXTERNAL_INPUT_RISING_EDGE);
-								caerSpecialEventValidate(currentSpecialEvent, state->currentPackets.special);
-								state->currentPackets.specialPosition++;
-							}
+							caerSpecialEvent currentSpecialEvent = caerSpecialEventPacketGetEvent(
+								state->currentPackets.special, state->currentPackets.specialPosition);
+							caerSpecialEventSetTimestamp(currentSpecialEvent, state->timestamps.current);
+							caerSpecialEventSetType(currentSpecialEvent, EXTERNAL_INPUT_RISING_EDGE);
+							caerSpecialEventValidate(currentSpecialEvent, state->currentPackets.special);
+							state->currentPackets.specialPosition++;
 
 							break;
 						}
@@ -2622,15 +2593,12 @@ static void dvXplorerEventTranslator(void *vhd, const uint8_t *buffer, size_t bu
 						case 4: { // External input (pulse)
 							dvXplorerLog(CAER_LOG_DEBUG, handle, "External input (pulse) event received.");
 
-							if (ensureSpaceForEvents((caerEventPacketHeader *) &state->currentPackets.special,
-									(size_t) state->currentPackets.specialPosition, 1, handle)) {
-								caerSpecialEvent currentSpecialEvent = caerSpecialEventPacketGetEvent(
-									state->currentPackets.special, state->currentPackets.specialPosition);
-								caerSpecialEventSetTimestamp(currentSpecialEvent, state->timestamps.current);
-								caerSpecialEventSetType(currentSpecialEvent, EXTERNAL_INPUT_PULSE);
-								caerSpecialEventValidate(currentSpecialEvent, state->currentPackets.special);
-								state->currentPackets.specialPosition++;
-							}
+							caerSpecialEvent currentSpecialEvent = caerSpecialEventPacketGetEvent(
+								state->currentPackets.special, state->currentPackets.specialPosition);
+							caerSpecialEventSetTimestamp(currentSpecialEvent, state->timestamps.current);
+							caerSpecialEventSetType(currentSpecialEvent, EXTERNAL_INPUT_PULSE);
+							caerSpecialEventValidate(currentSpecialEvent, state->currentPackets.special);
+							state->currentPackets.specialPosition++;
 
 							break;
 						}
@@ -2669,8 +2637,7 @@ static void dvXplorerEventTranslator(void *vhd, const uint8_t *buffer, size_t bu
 								// possible data loss would be too significant. So instead we keep a private event,
 								// fill it, and then only copy it into the packet here in the END state, at which point
 								// the whole event is ready and cannot be broken/corrupted in any way anymore.
-								if (ensureSpaceForEvents((caerEventPacketHeader *) &state->currentPackets.imu6,
-										(size_t) state->currentPackets.imu6Position, 1, handle)) {
+								if (containerGenerationPacketReserve(&state->container, IMU6_EVENT_PKT_POS, 1)) {
 									caerIMU6Event imuCurrentEvent = caerIMU6EventPacketGetEvent(
 										state->currentPackets.imu6, state->currentPackets.imu6Position);
 									memcpy(imuCurrentEvent, &state->imu.currentEvent, sizeof(struct caer_imu6_event));
@@ -2689,15 +2656,12 @@ static void dvXplorerEventTranslator(void *vhd, const uint8_t *buffer, size_t bu
 						case 16: { // External generator (falling edge)
 							dvXplorerLog(CAER_LOG_DEBUG, handle, "External generator (falling edge) event received.");
 
-							if (ensureSpaceForEvents((caerEventPacketHeader *) &state->currentPackets.special,
-									(size_t) state->currentPackets.specialPosition, 1, handle)) {
-								caerSpecialEvent currentSpecialEvent = caerSpecialEventPacketGetEvent(
-									state->currentPackets.special, state->currentPackets.specialPosition);
-								caerSpecialEventSetTimestamp(currentSpecialEvent, state->timestamps.current);
-								caerSpecialEventSetType(currentSpecialEvent, EXTERNAL_GENERATOR_FALLING_EDGE);
-								caerSpecialEventValidate(currentSpecialEvent, state->currentPackets.special);
-								state->currentPackets.specialPosition++;
-							}
+							caerSpecialEvent currentSpecialEvent = caerSpecialEventPacketGetEvent(
+								state->currentPackets.special, state->currentPackets.specialPosition);
+							caerSpecialEventSetTimestamp(currentSpecialEvent, state->timestamps.current);
+							caerSpecialEventSetType(currentSpecialEvent, EXTERNAL_GENERATOR_FALLING_EDGE);
+							caerSpecialEventValidate(currentSpecialEvent, state->currentPackets.special);
+							state->currentPackets.specialPosition++;
 
 							break;
 						}
@@ -2705,15 +2669,12 @@ static void dvXplorerEventTranslator(void *vhd, const uint8_t *buffer, size_t bu
 						case 17: { // External generator (rising edge)
 							dvXplorerLog(CAER_LOG_DEBUG, handle, "External generator (rising edge) event received.");
 
-							if (ensureSpaceForEvents((caerEventPacketHeader *) &state->currentPackets.special,
-									(size_t) state->currentPackets.specialPosition, 1, handle)) {
-								caerSpecialEvent currentSpecialEvent = caerSpecialEventPacketGetEvent(
-									state->currentPackets.special, state->currentPackets.specialPosition);
-								caerSpecialEventSetTimestamp(currentSpecialEvent, state->timestamps.current);
-								caerSpecialEventSetType(currentSpecialEvent, EXTERNAL_GENERATOR_RISING_EDGE);
-								caerSpecialEventValidate(currentSpecialEvent, state->currentPackets.special);
-								state->currentPackets.specialPosition++;
-							}
+							caerSpecialEvent currentSpecialEvent = caerSpecialEventPacketGetEvent(
+								state->currentPackets.special, state->currentPackets.specialPosition);
+							caerSpecialEventSetTimestamp(currentSpecialEvent, state->timestamps.current);
+							caerSpecialEventSetType(currentSpecialEvent, EXTERNAL_GENERATOR_RISING_EDGE);
+							caerSpecialEventValidate(currentSpecialEvent, state->currentPackets.special);
+							state->currentPackets.specialPosition++;
 
 							break;
 						}
@@ -2732,15 +2693,12 @@ static void dvXplorerEventTranslator(void *vhd, const uint8_t *buffer, size_t bu
 					if (startOfFrame) {
 						dvXplorerLog(CAER_LOG_DEBUG, handle, "Start of Frame column marker detected.");
 
-						if (ensureSpaceForEvents((caerEventPacketHeader *) &state->currentPackets.special,
-								(size_t) state->currentPackets.specialPosition, 1, handle)) {
-							caerSpecialEvent currentSpecialEvent = caerSpecialEventPacketGetEvent(
-								state->currentPackets.special, state->currentPackets.specialPosition);
-							caerSpecialEventSetTimestamp(currentSpecialEvent, state->timestamps.current);
-							caerSpecialEventSetType(currentSpecialEvent, EVENT_READOUT_START);
-							caerSpecialEventValidate(currentSpecialEvent, state->currentPackets.special);
-							state->currentPackets.specialPosition++;
-						}
+						caerSpecialEvent currentSpecialEvent = caerSpecialEventPacketGetEvent(
+							state->currentPackets.special, state->currentPackets.specialPosition);
+						caerSpecialEventSetTimestamp(currentSpecialEvent, state->timestamps.current);
+						caerSpecialEventSetType(currentSpecialEvent, EVENT_READOUT_START);
+						caerSpecialEventValidate(currentSpecialEvent, state->currentPackets.special);
+						state->currentPackets.specialPosition++;
 					}
 
 					// Check range conformity.
@@ -2758,37 +2716,25 @@ static void dvXplorerEventTranslator(void *vhd, const uint8_t *buffer, size_t bu
 				case 2:
 				case 3: { // 8-pixel group event presence and polarity.
 						  // Code 2 is MGROUP Group 2 (SGROUP OFF), Code 3 is MGROUP Group 1 (SGROUP ON).
-					if (!ensureSpaceForEvents((caerEventPacketHeader *) &state->currentPackets.polarity,
-							(size_t) state->currentPackets.polarityPosition, 8, handle)) {
-						break;
-					}
+					uint32_t polarity = (data & 0x0100) ? (0) : (U32T(1) << POLARITY_SHIFT);
+					uint32_t lastY    = (code == 3) ? (state->dvs.lastYG1) : (state->dvs.lastYG2);
+					uint32_t lastX    = state->dvs.lastX;
 
-					bool polarity  = !(data & 0x0100);
-					uint16_t lastY = (code == 3) ? (state->dvs.lastYG1) : (state->dvs.lastYG2);
+					// Event data of the group's first pixel, the others follow along Y.
+					// Timestamp at event-stream insertion point.
+					if (state->dvs.invertXY) {
+						uint32_t eventData = (lastY << POLARITY_X_ADDR_SHIFT) | (lastX << POLARITY_Y_ADDR_SHIFT)
+										   | polarity | (U32T(1) << VALID_MARK_SHIFT);
 
-					for (uint16_t i = 0, mask = 0x0001; i < 8; i++, mask <<= 1) {
-						// Check if event present first.
-						if ((data & mask) == 0) {
-							continue;
-						}
-
-						// Received event!
-						caerPolarityEvent currentPolarityEvent = caerPolarityEventPacketGetEvent(
-							state->currentPackets.polarity, state->currentPackets.polarityPosition);
+						state->currentPackets.polarityPosition += polarityGroupExpand(state->currentPackets.polarity,
+							U8T(data), eventData, POLARITY_X_ADDR_SHIFT, state->timestamps.current, false);
+					}
+					else {
+						uint32_t eventData = (lastX << POLARITY_X_ADDR_SHIFT) | (lastY << POLARITY_Y_ADDR_SHIFT)
+										   | polarity | (U32T(1) << VALID_MARK_SHIFT);
 
-						// Timestamp at event-stream insertion point.
-						caerPolarityEventSetTimestamp(currentPolarityEvent, state->timestamps.current);
-						caerPolarityEventSetPolarity(currentPolarityEvent, polarity);
-						if (state->dvs.invertXY) {
-							caerPolarityEventSetX(currentPolarityEvent, lastY + i);
-							caerPolarityEventSetY(currentPolarityEvent, state->dvs.lastX);
-						}
-						else {
-							caerPolarityEventSetX(currentPolarityEvent, state->dvs.lastX);
-							caerPolarityEventSetY(currentPolarityEvent, lastY + i);
-						}
-						caerPolarityEventValidate(currentPolarityEvent, state->currentPackets.polarity);
-						state->currentPackets.polarityPosition++;
+						state->currentPackets.polarityPosition += polarityGroupExpand(state->currentPackets.polarity,
+							U8T(data), eventData, POLARITY_Y_ADDR_SHIFT, state->timestamps.current, false);
 					}
 
 					break;
@@ -2994,15 +2940,12 @@ static void dvXplorerEventTranslator(void *vhd, const uint8_t *buffer, size_t bu
 						&state->timestamps, data, TS_WRAP_ADD, handle->info.deviceString, &state->deviceLogLevel);
 
 					if (tsBigWrap) {
-						if (ensureSpaceForEvents((caerEventPacketHeader *) &state->currentPackets.special,
-								(size_t) state->currentPackets.specialPosition, 1, handle)) {
-							caerSpecialEvent currentSpecialEvent = caerSpecialEventPacketGetEvent(
-								state->currentPackets.special, state->currentPackets.specialPosition);
-							caerSpecialEventSetTimestamp(currentSpecialEvent, INT32_MAX);
-							caerSpecialEventSetType(currentSpecialEvent, TIMESTAMP_WRAP);
-							caerSpecialEventValidate(currentSpecialEvent, state->currentPackets.special);
-							state->currentPackets.specialPosition++;
-						}
+						caerSpecialEvent currentSpecialEvent = caerSpecialEventPacketGetEvent(
+							state->currentPackets.special, state->currentPackets.specialPosition);
+						caerSpecialEventSetTimestamp(currentSpecialEvent, INT32_MAX);
+						caerSpecialEventSetType(currentSpecialEvent, TIMESTAMP_WRAP);
+						caerSpecialEventValidate(currentSpecialEvent, state->currentPackets.special);
+						state->currentPackets.specialPosition++;
 					}
 					else {
 						containerGenerationCommitTimestampInit(&state->container, state->timestamps.current);
@@ -3032,53 +2975,21 @@ static void dvXplorerEventTranslator(void *vhd, const uint8_t *buffer, size_t bu
 		// Commit packet containers to the ring-buffer, so they can be processed by the
 		// main-loop, when any of the required conditions are met.
 		if (tsReset || tsBigWrap || containerSizeCommit || containerTimeCommit) {
-			// One or more of the commit triggers are hit. Set the packet container up to contain
-			// any non-empty packets. Empty packets are not forwarded to save memory.
-			bool emptyContainerCommit = true;
+			dvXplorerContainerCommit(handle, tsReset, tsBigWrap);
 
-			if (state->currentPackets.polarityPosition > 0) {
-				containerGenerationSetPacket(
-					&state->container, POLARITY_EVENT, (caerEventPacketHeader) state->currentPackets.polarity);
-
-				state->currentPackets.polarity         = NULL;
-				state->currentPackets.polarityPosition = 0;
-				emptyContainerCommit                   = false;
-			}
-
-			if (state->currentPackets.specialPosition > 0) {
-				containerGenerationSetPacket(
-					&state->container, SPECIAL_EVENT, (caerEventPacketHeader) state->currentPackets.special);
-
-				state->currentPackets.special         = NULL;
-				state->currentPackets.specialPosition = 0;
-				emptyContainerCommit                  = false;
-			}
-
-			if (state->currentPackets.imu6Position > 0) {
-				containerGenerationSetPacket(
-					&state->container, IMU6_EVENT_PKT_POS, (caerEventPacketHeader) state->currentPackets.imu6);
-
-				state->currentPackets.imu6         = NULL;
-				state->currentPackets.imu6Position = 0;
-				emptyContainerCommit               = false;
-			}
-
-			if (tsReset || tsBigWrap) {
-				// Ignore all IMU6 (composite) events, until a new IMU6
-				// Start event comes in, for the next packet.
-				// This is to correctly support the forced packet commits that a TS reset,
-				// or a TS big wrap, impose. Continuing to parse events would result
-				// in a corrupted state of the first event in the new packet, as it would
-				// be incomplete, incorrect and miss vital initialization data.
-				// See IMU6 END states for more details on a related issue.
-				state->imu.ignoreEvents = true;
+			// Allocate new packets for the rest of the buffer.
+			if (((bufferPos + 2) < bufferSize)
+				&& !containerGenerationPacketsAllocate(
+					&state->container, (bufferSize - (bufferPos + 2)) / 2, state->timestamps.wrapOverflow)) {
+				return;
 			}
-
-			containerGenerationExecute(&state->container, emptyContainerCommit, tsReset, state->timestamps.wrapOverflow,
-				state->timestamps.current, &state->dataExchange, &state->usbState.dataTransfersRun,
-				handle->info.deviceID, handle->info.deviceString, &state->deviceLogLevel);
 		}
 	}
+
+	// Commit a container pending for too long, also when called without data (device idle).
+	if (containerGenerationIsLatencyElapsed(&state->container)) {
+		dvXplorerContainerCommit(handle, false, false);
+	}
 }
 
 static void dvXplorerTSMasterStatusUpdater(void *userDataPtr, int status, uint32_t param) {
@@ -3099,6 +3010,11 @@ static void dvXplorerTSMasterStatusUpdater(void *userDataPtr, int status, uint32
 /// FX3 Debug Transfer Support ///
 //////////////////////////////////
 static void allocateDebugTransfers(dvXplorerHandle handle) {
+	// No debug channel when replaying a capture file.
+	if (usbReplayActive(&handle->state.usbState)) {
+		return;
+	}
+
 	// Allocate transfers and set them up.
 	for (size_t i = 0; i < DEBUG_TRANSFER_NUM; i++) {
 		handle->state.fx3Support.debugTransfers[i] = libusb_alloc_transfer(0);
@@ -6,6 +6,7 @@
 
 #include "container_generation.h"
 #include "data_exchange.h"
+#include "polarity_group.h"
 #include "usb_utils.h"
 
 #define IMU_TYPE_TEMP   0x01
@@ -201,5 +202,8 @@ bool dvXplorerDataStart(caerDeviceHandle handle, void (*dataNotifyIncrease)(void
 	void *dataShutdownUserPtr);
 bool dvXplorerDataStop(caerDeviceHandle handle);
 caerEventPacketContainer dvXplorerDataGet(caerDeviceHandle handle);
+size_t dvXplorerDataGetMany(caerDeviceHandle handle, caerEventPacketContainer *containers, size_t containersNumber);
+int dvXplorerDataGetFD(caerDeviceHandle handle);
+void dvXplorerDataRecycle(caerDeviceHandle handle, caerEventPacketContainer container);
 
 #endif /* LIBCAER_SRC_DVXPLORER_H_ */
@@ -263,23 +263,6 @@ static bool sendUSBCommandVerifyMultiple(dynapseHandle handle, uint8_t *config,
 static inline void freeAllDataMemory(dynapseState state) {
 	dataExchangeDestroy(&state->dataExchange);
 
-	// Since the current event packets aren't necessarily
-	// already assigned to the current packet container, we
-	// free them separately from it.
-	if (state->currentPackets.spike != NULL) {
-		free(&state->currentPackets.spike->packetHeader);
-		state->currentPackets.spike = NULL;
-
-		containerGenerationSetPacket(&state->container, DYNAPSE_SPIKE_EVENT_POS, NULL);
-	}
-
-	if (state->currentPackets.special != NULL) {
-		free(&state->currentPackets.special->packetHeader);
-		state->currentPackets.special = NULL;
-
-		containerGenerationSetPacket(&state->container, SPECIAL_EVENT, NULL);
-	}
-
 	containerGenerationDestroy(&state->container);
 }
 
@@ -783,9 +766,18 @@ bool dynapseConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr, u
 			break;
 
 		case CAER_HOST_CONFIG_PACKETS:
+			if (paramAddr == CAER_HOST_CONFIG_PACKETS_MAX_CONTAINER_LATENCY) {
+				// Wake up often enough to commit on time, even without new data.
+				usbSetDataIdleInterval(&state->usbState, param);
+			}
+
 			return (containerGenerationConfigSet(&state->container, paramAddr, param));
 			break;
 
+		case CAER_HOST_CONFIG_STATISTICS:
+			return (statisticsConfigSet(&state->dataExchange.statistics, paramAddr, param));
+			break;
+
 		case CAER_HOST_CONFIG_LOG:
 			switch (paramAddr) {
 				case CAER_HOST_CONFIG_LOG_LEVEL:
@@ -1131,6 +1123,10 @@ bool dynapseConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr, u
 			return (containerGenerationConfigGet(&state->container, paramAddr, param));
 			break;
 
+		case CAER_HOST_CONFIG_STATISTICS:
+			return (statisticsConfigGet(&state->dataExchange.statistics, paramAddr, param));
+			break;
+
 		case CAER_HOST_CONFIG_LOG:
 			switch (paramAddr) {
 				case CAER_HOST_CONFIG_LOG_LEVEL:
@@ -1335,29 +1331,24 @@ bool dynapseDataStart(caerDeviceHandle cdh, void (*dataNotifyIncrease)(void *ptr
 		return (false);
 	}
 
-	// Allocate packets.
-	if (!containerGenerationAllocate(&state->container, DYNAPSE_EVENT_TYPES)) {
-		freeAllDataMemory(state);
-
-		dynapseLog(CAER_LOG_CRITICAL, handle, "Failed to allocate event packet container.");
-		return (false);
-	}
-
-	state->currentPackets.spike
-		= caerSpikeEventPacketAllocate(DYNAPSE_SPIKE_DEFAULT_SIZE, I16T(handle->info.deviceID), 0);
-	if (state->currentPackets.spike == NULL) {
+	// Prepare container recycling pool.
+	if (!containerGenerationPoolInit(&state->container)) {
 		freeAllDataMemory(state);
 
-		dynapseLog(CAER_LOG_CRITICAL, handle, "Failed to allocate spike event packet.");
+		dynapseLog(CAER_LOG_CRITICAL, handle, "Failed to initialize event packet container pool.");
 		return (false);
 	}
 
-	state->currentPackets.special
-		= caerSpecialEventPacketAllocate(DYNAPSE_SPECIAL_DEFAULT_SIZE, I16T(handle->info.deviceID), 0);
-	if (state->currentPackets.special == NULL) {
+	// Allocate packets.
+	containerGenerationPacketsInit(&state->container, DYNAPSE_EVENT_TYPES, I16T(handle->info.deviceID),
+		handle->info.deviceString, &state->deviceLogLevel);
+	containerGenerationPacketsAdd(&state->container, DYNAPSE_SPIKE_EVENT_POS, SPIKE_EVENT, &state->currentPackets.spike,
+		&state->currentPackets.spikePosition, DYNAPSE_SPIKE_DEFAULT_SIZE, 1);
+	containerGenerationPacketsAdd(&state->container, SPECIAL_EVENT, SPECIAL_EVENT, &state->currentPackets.special,
+		&state->currentPackets.specialPosition, DYNAPSE_SPECIAL_DEFAULT_SIZE, 1);
+
+	if (!containerGenerationPacketsAllocate(&state->container, 0, 0)) {
 		freeAllDataMemory(state);
-
-		dynapseLog(CAER_LOG_CRITICAL, handle, "Failed to allocate special event packet.");
 		return (false);
 	}
 
@@ -1417,8 +1408,37 @@ caerEventPacketContainer dynapseDataGet(caerDeviceHandle cdh) {
 	return (dataExchangeGet(&state->dataExchange, &state->usbState.dataTransfersRun));
 }
 
+size_t dynapseDataGetMany(caerDeviceHandle cdh, caerEventPacketContainer *containers, size_t containersNumber) {
+	dynapseHandle handle = (dynapseHandle) cdh;
+	dynapseState state   = &handle->state;
+
+	return (dataExchangeGetMany(&state->dataExchange, &state->usbState.dataTransfersRun, containers, containersNumber));
+}
+
+int dynapseDataGetFD(caerDeviceHandle cdh) {
+	dynapseHandle handle = (dynapseHandle) cdh;
+	dynapseState state   = &handle->state;
+
+	return (dataExchangeGetFD(&state->dataExchange));
+}
+
+void dynapseDataRecycle(caerDeviceHandle cdh, caerEventPacketContainer container) {
+	dynapseHandle handle = (dynapseHandle) cdh;
+	dynapseState state   = &handle->state;
+
+	containerGenerationRecycle(&state->container, container);
+}
+
 #define TS_WRAP_ADD 0x8000
 
+// Commit all non-empty packets in a container, and then the container itself.
+static void dynapseContainerCommit(dynapseHandle handle, bool tsReset) {
+	dynapseState state = &handle->state;
+
+	containerGenerationPacketsCommit(&state->container, tsReset, state->timestamps.wrapOverflow,
+		state->timestamps.current, &state->dataExchange, &state->usbState.dataTransfersRun);
+}
+
 static void dynapseEventTranslator(void *vhd, const uint8_t *buffer, size_t bytesSent) {
 	dynapseHandle handle = vhd;
 	dynapseState state   = &handle->state;
@@ -1431,63 +1451,23 @@ static void dynapseEventTranslator(void *vhd, const uint8_t *buffer, size_t byte
 		return;
 	}
 
+	statisticsAddBytes(&state->dataExchange.statistics, bytesSent);
+
 	// Truncate off any extra partial event.
 	if ((bytesSent & 0x01) != 0) {
 		dynapseLog(CAER_LOG_ALERT, handle, "%zu bytes received via USB, which is not a multiple of two.", bytesSent);
 		bytesSent &= ~((size_t) 0x01);
 	}
 
-	for (size_t i = 0; i < bytesSent; i += 2) {
-		// Allocate new packets for next iteration as needed.
-		if (!containerGenerationAllocate(&state->container, DYNAPSE_EVENT_TYPES)) {
-			dynapseLog(CAER_LOG_CRITICAL, handle, "Failed to allocate event packet container.");
-			return;
-		}
-
-		if (state->currentPackets.spike == NULL) {
-			state->currentPackets.spike = caerSpikeEventPacketAllocate(
-				DYNAPSE_SPIKE_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
-			if (state->currentPackets.spike == NULL) {
-				dynapseLog(CAER_LOG_CRITICAL, handle, "Failed to allocate spike event packet.");
-				return;
-			}
-		}
-		else if (state->currentPackets.spikePosition
-				 >= caerEventPacketHeaderGetEventCapacity((caerEventPacketHeader) state->currentPackets.spike)) {
-			// If not committed, let's check if any of the packets has reached its maximum
-			// capacity limit. If yes, we grow them to accomodate new events.
-			caerSpikeEventPacket grownPacket = (caerSpikeEventPacket) caerEventPacketGrow(
-				(caerEventPacketHeader) state->currentPackets.spike, state->currentPackets.spikePosition * 2);
-			if (grownPacket == NULL) {
-				dynapseLog(CAER_LOG_CRITICAL, handle, "Failed to grow spike event packet.");
-				return;
-			}
-
-			state->currentPackets.spike = grownPacket;
-		}
-
-		if (state->currentPackets.special == NULL) {
-			state->currentPackets.special = caerSpecialEventPacketAllocate(
-				DYNAPSE_SPECIAL_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
-			if (state->currentPackets.special == NULL) {
-				dynapseLog(CAER_LOG_CRITICAL, handle, "Failed to allocate special event packet.");
-				return;
-			}
-		}
-		else if (state->currentPackets.specialPosition
-				 >= caerEventPacketHeaderGetEventCapacity((caerEventPacketHeader) state->currentPackets.special)) {
-			// If not committed, let's check if any of the packets has reached its maximum
-			// capacity limit. If yes, we grow them to accomodate new events.
-			caerSpecialEventPacket grownPacket = (caerSpecialEventPacket) caerEventPacketGrow(
-				(caerEventPacketHeader) state->currentPackets.special, state->currentPackets.specialPosition * 2);
-			if (grownPacket == NULL) {
-				dynapseLog(CAER_LOG_CRITICAL, handle, "Failed to grow special event packet.");
-				return;
-			}
-
-			state->currentPackets.special = grownPacket;
-		}
+	// Packets only go away on commit, so they're allocated once here, and
+	// then again only after commits, instead of being checked every event.
+	// Every 2 byte word generates at most one spike or special event.
+	if ((bytesSent > 0)
+		&& !containerGenerationPacketsAllocate(&state->container, bytesSent / 2, state->timestamps.wrapOverflow)) {
+		return;
+	}
 
+	for (size_t i = 0; i < bytesSent; i += 2) {
 		bool tsReset   = false;
 		bool tsBigWrap = false;
 
@@ -1611,33 +1591,21 @@ static void dynapseEventTranslator(void *vhd, const uint8_t *buffer, size_t byte
 		// Commit packet containers to the ring-buffer, so they can be processed by the
 		// main-loop, when any of the required conditions are met.
 		if (tsReset || tsBigWrap || containerSizeCommit || containerTimeCommit) {
-			// One or more of the commit triggers are hit. Set the packet container up to contain
-			// any non-empty packets. Empty packets are not forwarded to save memory.
-			bool emptyContainerCommit = true;
+			dynapseContainerCommit(handle, tsReset);
 
-			if (state->currentPackets.spikePosition > 0) {
-				containerGenerationSetPacket(
-					&state->container, DYNAPSE_SPIKE_EVENT_POS, (caerEventPacketHeader) state->currentPackets.spike);
-
-				state->currentPackets.spike         = NULL;
-				state->currentPackets.spikePosition = 0;
-				emptyContainerCommit                = false;
-			}
-
-			if (state->currentPackets.specialPosition > 0) {
-				containerGenerationSetPacket(
-					&state->container, SPECIAL_EVENT, (caerEventPacketHeader) state->currentPackets.special);
-
-				state->currentPackets.special         = NULL;
-				state->currentPackets.specialPosition = 0;
-				emptyContainerCommit                  = false;
+			// Allocate new packets for the rest of the buffer.
+			if (((i + 2) < bytesSent)
+				&& !containerGenerationPacketsAllocate(
+					&state->container, (bytesSent - (i + 2)) / 2, state->timestamps.wrapOverflow)) {
+				return;
 			}
-
-			containerGenerationExecute(&state->container, emptyContainerCommit, tsReset, state->timestamps.wrapOverflow,
-				state->timestamps.current, &state->dataExchange, &state->usbState.dataTransfersRun,
-				handle->info.deviceID, handle->info.deviceString, &state->deviceLogLevel);
 		}
 	}
+
+	// Commit a container pending for too long, also when called without data (device idle).
+	if (containerGenerationIsLatencyElapsed(&state->container)) {
+		dynapseContainerCommit(handle, false);
+	}
 }
 
 bool caerDynapseSendDataToUSB(caerDeviceHandle cdh, const uint32_t *pointer, size_t numConfig) {
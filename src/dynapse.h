@@ -83,5 +83,8 @@ bool dynapseDataStart(caerDeviceHandle handle, void (*dataNotifyIncrease)(void *
 	void *dataShutdownUserPtr);
 bool dynapseDataStop(caerDeviceHandle handle);
 caerEventPacketContainer dynapseDataGet(caerDeviceHandle handle);
+size_t dynapseDataGetMany(caerDeviceHandle handle, caerEventPacketContainer *containers, size_t containersNumber);
+int dynapseDataGetFD(caerDeviceHandle handle);
+void dynapseDataRecycle(caerDeviceHandle handle, caerEventPacketContainer container);
 
 #endif /* LIBCAER_SRC_DYNAPSE_H_ */
@@ -141,23 +141,6 @@ static inline bool serialPortWrite(edvsState state, const char *cmd) {
 static inline void freeAllDataMemory(edvsState state) {
 	dataExchangeDestroy(&state->dataExchange);
 
-	// Since the current event packets aren't necessarily
-	// already assigned to the current packet container, we
-	// free them separately from it.
-	if (state->currentPackets.polarity != NULL) {
-		free(&state->currentPackets.polarity->packetHeader);
-		state->currentPackets.polarity = NULL;
-
-		containerGenerationSetPacket(&state->container, POLARITY_EVENT, NULL);
-	}
-
-	if (state->currentPackets.special != NULL) {
-		free(&state->currentPackets.special->packetHeader);
-		state->currentPackets.special = NULL;
-
-		containerGenerationSetPacket(&state->container, SPECIAL_EVENT, NULL);
-	}
-
 	containerGenerationDestroy(&state->container);
 }
 
@@ -467,6 +450,10 @@ bool edvsConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr, uint
 			return (containerGenerationConfigSet(&state->container, paramAddr, param));
 			break;
 
+		case CAER_HOST_CONFIG_STATISTICS:
+			return (statisticsConfigSet(&state->dataExchange.statistics, paramAddr, param));
+			break;
+
 		case CAER_HOST_CONFIG_LOG:
 			switch (paramAddr) {
 				case CAER_HOST_CONFIG_LOG_LEVEL:
@@ -569,6 +556,10 @@ bool edvsConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr, uint
 			return (containerGenerationConfigGet(&state->container, paramAddr, param));
 			break;
 
+		case CAER_HOST_CONFIG_STATISTICS:
+			return (statisticsConfigGet(&state->dataExchange.statistics, paramAddr, param));
+			break;
+
 		case CAER_HOST_CONFIG_LOG:
 			switch (paramAddr) {
 				case CAER_HOST_CONFIG_LOG_LEVEL:
@@ -682,6 +673,11 @@ static int serialThreadRun(void *handlePtr) {
 		while ((bytesAvailable < (16 * EDVS_EVENT_SIZE))
 			   && atomic_load_explicit(&state->serialState.serialThreadState, memory_order_relaxed) == THR_RUNNING) {
 			bytesAvailable = sp_input_waiting(state->serialState.serialPort);
+
+			// No data yet: commit pending events on time, see CAER_HOST_CONFIG_PACKETS_MAX_CONTAINER_LATENCY.
+			if (bytesAvailable < (16 * EDVS_EVENT_SIZE)) {
+				edvsEventTranslator(handle, NULL, 0);
+			}
 		}
 
 		if ((size_t) bytesAvailable < readSize) {
@@ -733,29 +729,24 @@ bool edvsDataStart(caerDeviceHandle cdh, void (*dataNotifyIncrease)(void *ptr),
 		return (false);
 	}
 
-	// Allocate packets.
-	if (!containerGenerationAllocate(&state->container, EDVS_EVENT_TYPES)) {
+	// Prepare container recycling pool.
+	if (!containerGenerationPoolInit(&state->container)) {
 		freeAllDataMemory(state);
 
-		edvsLog(CAER_LOG_CRITICAL, handle, "Failed to allocate event packet container.");
+		edvsLog(CAER_LOG_CRITICAL, handle, "Failed to initialize event packet container pool.");
 		return (false);
 	}
 
-	state->currentPackets.polarity
-		= caerPolarityEventPacketAllocate(EDVS_POLARITY_DEFAULT_SIZE, I16T(handle->info.deviceID), 0);
-	if (state->currentPackets.polarity == NULL) {
+	// Allocate packets.
+	containerGenerationPacketsInit(&state->container, EDVS_EVENT_TYPES, I16T(handle->info.deviceID),
+		handle->info.deviceString, &state->deviceLogLevel);
+	containerGenerationPacketsAdd(&state->container, POLARITY_EVENT, POLARITY_EVENT, &state->currentPackets.polarity,
+		&state->currentPackets.polarityPosition, EDVS_POLARITY_DEFAULT_SIZE, 1);
+	containerGenerationPacketsAdd(&state->container, SPECIAL_EVENT, SPECIAL_EVENT, &state->currentPackets.special,
+		&state->currentPackets.specialPosition, EDVS_SPECIAL_DEFAULT_SIZE, 1);
+
+	if (!containerGenerationPacketsAllocate(&state->container, 0, 0)) {
 		freeAllDataMemory(state);
-
-		edvsLog(CAER_LOG_CRITICAL, handle, "Failed to allocate polarity event packet.");
-		return (false);
-	}
-
-	state->currentPackets.special
-		= caerSpecialEventPacketAllocate(EDVS_SPECIAL_DEFAULT_SIZE, I16T(handle->info.deviceID), 0);
-	if (state->currentPackets.special == NULL) {
-		freeAllDataMemory(state);
-
-		edvsLog(CAER_LOG_CRITICAL, handle, "Failed to allocate special event packet.");
 		return (false);
 	}
 
@@ -805,10 +796,40 @@ caerEventPacketContainer edvsDataGet(caerDeviceHandle cdh) {
 	return (dataExchangeGet(&state->dataExchange, &state->serialState.serialThreadState));
 }
 
+size_t edvsDataGetMany(caerDeviceHandle cdh, caerEventPacketContainer *containers, size_t containersNumber) {
+	edvsHandle handle = (edvsHandle) cdh;
+	edvsState state   = &handle->state;
+
+	return (dataExchangeGetMany(
+		&state->dataExchange, &state->serialState.serialThreadState, containers, containersNumber));
+}
+
+int edvsDataGetFD(caerDeviceHandle cdh) {
+	edvsHandle handle = (edvsHandle) cdh;
+	edvsState state   = &handle->state;
+
+	return (dataExchangeGetFD(&state->dataExchange));
+}
+
+void edvsDataRecycle(caerDeviceHandle cdh, caerEventPacketContainer container) {
+	edvsHandle handle = (edvsHandle) cdh;
+	edvsState state   = &handle->state;
+
+	containerGenerationRecycle(&state->container, container);
+}
+
 #define TS_WRAP_ADD   0x10000
 #define HIGH_BIT_MASK 0x80
 #define LOW_BITS_MASK 0x7F
 
+// Commit all non-empty packets in a container, and then the container itself.
+static void edvsContainerCommit(edvsHandle handle, bool tsReset) {
+	edvsState state = &handle->state;
+
+	containerGenerationPacketsCommit(&state->container, tsReset, state->timestamps.wrapOverflow,
+		state->timestamps.current, &state->dataExchange, &state->serialState.serialThreadState);
+}
+
 static void edvsEventTranslator(void *vhd, const uint8_t *buffer, size_t bytesSent) {
 	edvsHandle handle = vhd;
 	edvsState state   = &handle->state;
@@ -821,6 +842,16 @@ static void edvsEventTranslator(void *vhd, const uint8_t *buffer, size_t bytesSe
 		return;
 	}
 
+	statisticsAddBytes(&state->dataExchange.statistics, bytesSent);
+
+	// Packets only go away on commit, so they're allocated once here, and
+	// then again only after commits, instead of being checked every event.
+	// Every event takes 4 bytes, and generates at most one polarity or special event.
+	if ((bytesSent > 0)
+		&& !containerGenerationPacketsAllocate(&state->container, bytesSent / 4, state->timestamps.wrapOverflow)) {
+		return;
+	}
+
 	size_t i = 0;
 	while (i < bytesSent) {
 		uint8_t yByte = buffer[i];
@@ -834,57 +865,7 @@ static void edvsEventTranslator(void *vhd, const uint8_t *buffer, size_t bytesSe
 
 		if ((i + 3) >= bytesSent) {
 			// Cannot fetch next event data, we're done with this buffer.
-			return;
-		}
-
-		// Allocate new packets for next iteration as needed.
-		if (!containerGenerationAllocate(&state->container, EDVS_EVENT_TYPES)) {
-			edvsLog(CAER_LOG_CRITICAL, handle, "Failed to allocate event packet container.");
-			return;
-		}
-
-		if (state->currentPackets.polarity == NULL) {
-			state->currentPackets.polarity = caerPolarityEventPacketAllocate(
-				EDVS_POLARITY_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
-			if (state->currentPackets.polarity == NULL) {
-				edvsLog(CAER_LOG_CRITICAL, handle, "Failed to allocate polarity event packet.");
-				return;
-			}
-		}
-		else if (state->currentPackets.polarityPosition
-				 >= caerEventPacketHeaderGetEventCapacity((caerEventPacketHeader) state->currentPackets.polarity)) {
-			// If not committed, let's check if any of the packets has reached its maximum
-			// capacity limit. If yes, we grow them to accomodate new events.
-			caerPolarityEventPacket grownPacket = (caerPolarityEventPacket) caerEventPacketGrow(
-				(caerEventPacketHeader) state->currentPackets.polarity, state->currentPackets.polarityPosition * 2);
-			if (grownPacket == NULL) {
-				edvsLog(CAER_LOG_CRITICAL, handle, "Failed to grow polarity event packet.");
-				return;
-			}
-
-			state->currentPackets.polarity = grownPacket;
-		}
-
-		if (state->currentPackets.special == NULL) {
-			state->currentPackets.special = caerSpecialEventPacketAllocate(
-				EDVS_SPECIAL_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
-			if (state->currentPackets.special == NULL) {
-				edvsLog(CAER_LOG_CRITICAL, handle, "Failed to allocate special event packet.");
-				return;
-			}
-		}
-		else if (state->currentPackets.specialPosition
-				 >= caerEventPacketHeaderGetEventCapacity((caerEventPacketHeader) state->currentPackets.special)) {
-			// If not committed, let's check if any of the packets has reached its maximum
-			// capacity limit. If yes, we grow them to accomodate new events.
-			caerSpecialEventPacket grownPacket = (caerSpecialEventPacket) caerEventPacketGrow(
-				(caerEventPacketHeader) state->currentPackets.special, state->currentPackets.specialPosition * 2);
-			if (grownPacket == NULL) {
-				edvsLog(CAER_LOG_CRITICAL, handle, "Failed to grow special event packet.");
-				return;
-			}
-
-			state->currentPackets.special = grownPacket;
+			break;
 		}
 
 		bool tsReset   = false;
@@ -1009,35 +990,23 @@ static void edvsEventTranslator(void *vhd, const uint8_t *buffer, size_t bytesSe
 		// Commit packet containers to the ring-buffer, so they can be processed by the
 		// main-loop, when any of the required conditions are met.
 		if (tsReset || tsBigWrap || containerSizeCommit || containerTimeCommit) {
-			// One or more of the commit triggers are hit. Set the packet container up to contain
-			// any non-empty packets. Empty packets are not forwarded to save memory.
-			bool emptyContainerCommit = true;
+			edvsContainerCommit(handle, tsReset);
 
-			if (state->currentPackets.polarityPosition > 0) {
-				containerGenerationSetPacket(
-					&state->container, POLARITY_EVENT, (caerEventPacketHeader) state->currentPackets.polarity);
-
-				state->currentPackets.polarity         = NULL;
-				state->currentPackets.polarityPosition = 0;
-				emptyContainerCommit                   = false;
-			}
-
-			if (state->currentPackets.specialPosition > 0) {
-				containerGenerationSetPacket(
-					&state->container, SPECIAL_EVENT, (caerEventPacketHeader) state->currentPackets.special);
-
-				state->currentPackets.special         = NULL;
-				state->currentPackets.specialPosition = 0;
-				emptyContainerCommit                  = false;
+			// Allocate new packets for the rest of the buffer.
+			if (((i + 4) < bytesSent)
+				&& !containerGenerationPacketsAllocate(
+					&state->container, (bytesSent - (i + 4)) / 4, state->timestamps.wrapOverflow)) {
+				return;
 			}
-
-			containerGenerationExecute(&state->container, emptyContainerCommit, tsReset, state->timestamps.wrapOverflow,
-				state->timestamps.current, &state->dataExchange, &state->serialState.serialThreadState,
-				handle->info.deviceID, handle->info.deviceString, &handle->state.deviceLogLevel);
 		}
 
 		i += 4;
 	}
+
+	// Commit a container pending for too long, also when called without data (device idle).
+	if (containerGenerationIsLatencyElapsed(&state->container)) {
+		edvsContainerCommit(handle, false);
+	}
 }
 
 static bool edvsSendBiases(edvsState state, int biasID) {
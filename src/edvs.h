@@ -104,5 +104,8 @@ bool edvsDataStart(caerDeviceHandle handle, void (*dataNotifyIncrease)(void *ptr
 	void *dataShutdownUserPtr);
 bool edvsDataStop(caerDeviceHandle handle);
 caerEventPacketContainer edvsDataGet(caerDeviceHandle handle);
+size_t edvsDataGetMany(caerDeviceHandle handle, caerEventPacketContainer *containers, size_t containersNumber);
+int edvsDataGetFD(caerDeviceHandle handle);
+void edvsDataRecycle(caerDeviceHandle handle, caerEventPacketContainer container);
 
 #endif /* LIBCAER_SRC_EDVS_H_ */
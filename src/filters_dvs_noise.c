@@ -1,5 +1,74 @@
 #include "libcaer/filters/dvs_noise.h"
 
+#if defined(HAVE_PTHREADS)
+#	include "c11threads_posix.h"
+#endif
+
+// Background Activity support kernels: AVX2 is picked at runtime on x86,
+// NEON is always there on AArch64, the scalar kernels work everywhere.
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#	include <immintrin.h>
+#	define DVS_NOISE_KERNELS_AVX2 1
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#	include <arm_neon.h>
+#	define DVS_NOISE_KERNELS_NEON 1
+#endif
+
+// Which filter, if any, filtered out an event.
+enum dvs_noise_filtered {
+	DVS_NOISE_PASSED              = 0,
+	DVS_NOISE_HOTPIXEL            = 1,
+	DVS_NOISE_REFRACTORY_PERIOD   = 2,
+	DVS_NOISE_BACKGROUND_ACTIVITY = 3,
+};
+
+#define DVS_NOISE_FILTERED_NUM 4
+
+// Parallel filtering: the array is split into horizontal bands, each one
+// filtered by its own worker thread. A band owns its rows of the timestamps
+// map, and keeps private copies of the rows around it that its neighbor
+// lookups can reach (the halo). All events on halo rows are also given to
+// the band, in order, to keep those copies up-to-date, so that every lookup
+// sees exactly what it would see when filtering serially.
+struct dvs_noise_band {
+	caerFilterDVSNoise noiseFilter;
+	thrd_t thread;
+	uint64_t generation;
+	// Owned rows.
+	size_t rowStart;
+	size_t rowEnd;
+	// Halo rows, right above and below the owned rows, same layout as the map.
+	int64_t *haloAbove;
+	int64_t *haloBelow;
+	// Timestamps map rows as seen from the band, from the map itself or the
+	// halo copies, starting with the row two above the first owned one.
+	void **rows;
+	// Indexes of the events to process in the current packet, in order.
+	uint32_t *events;
+	size_t eventsNumber;
+	// Results, merged back by the calling thread. The events to invalidate
+	// are moved to the front of 'events', as the packet is shared.
+	uint64_t filtered[DVS_NOISE_FILTERED_NUM][2];
+	size_t invalidateNumber;
+};
+
+// Two-levels lookups reach two rows away, so bands are at least twice that
+// high: an event is then in the halo of at most one other band.
+#define BAND_HALO_ROWS_MAX 2
+#define BAND_ROWS_MIN      (2 * BAND_HALO_ROWS_MAX)
+#define BAND_EVENT_HALO    (UINT32_C(1) << 31)
+// Rows lookups from a band can reach: the owned ones, and two more on each
+// side, from the halo or the map's padding.
+#define BAND_ROWS_SPAN(BAND) ((BAND)->rowEnd - (BAND)->rowStart + (2 * BAND_HALO_ROWS_MAX))
+
+// Background Activity support kernel: which entries of the 3x3 block of the
+// timestamps map around a pixel are newer than 'threshold', and have the
+// same polarity where 'polarityMask' is set. The rows are the ones above,
+// at and below the pixel, 'x' is the block's first entry. Bit (row * 3) +
+// column is set for each supporting entry, bit 4 being the pixel itself.
+typedef uint32_t (*dvsNoiseSupportKernel)(const void *rowAbove, const void *row, const void *rowBelow, size_t x,
+	int64_t threshold, int64_t polarity, int64_t polarityMask);
+
 struct caer_filter_dvs_noise {
 	// Logging support.
 	uint8_t logLevel;
@@ -14,8 +83,14 @@ struct caer_filter_dvs_noise {
 	bool hotPixelEnabled;
 	size_t hotPixelArraySize;
 	struct caer_filter_dvs_pixel *hotPixelArray;
+	uint64_t *hotPixelMap; // One bit per pixel, set if hot. Same as hotPixelArray, unless learning continuously.
 	uint64_t hotPixelStatOn;
 	uint64_t hotPixelStatOff;
+	// Hot Pixel filter (continuous learning).
+	bool hotPixelContinuousStarted;
+	size_t hotPixelSweepRow;
+	int64_t *hotPixelSweepTimes; // Last evaluation time of each row.
+	struct dvs_pixel_rate *hotPixelRates;
 	// Background Activity filter.
 	bool backgroundActivityEnabled;
 	bool backgroundActivityTwoLevels;
@@ -25,11 +100,30 @@ struct caer_filter_dvs_noise {
 	uint32_t backgroundActivityTime;
 	uint64_t backgroundActivityStatOn;
 	uint64_t backgroundActivityStatOff;
+	dvsNoiseSupportKernel backgroundActivitySupport;
+	dvsNoiseSupportKernel backgroundActivitySupportCompact;
 	// Refractory Period filter.
 	bool refractoryPeriodEnabled;
 	uint32_t refractoryPeriodTime;
 	uint64_t refractoryPeriodStatOn;
 	uint64_t refractoryPeriodStatOff;
+	// Parallel filtering.
+	uint32_t parallelThreads;
+	size_t bandsNumber;
+	size_t bandsThreads;
+	size_t bandsEventsCapacity;
+	struct dvs_noise_band *bands;
+	mtx_t bandsLock;
+	cnd_t bandsStartCond;
+	cnd_t bandsDoneCond;
+	bool bandsRun;
+	uint64_t bandsGeneration;
+	size_t bandsPending;
+	caerPolarityEventPacket bandsPacket;
+	bool bandsStatisticsOnly;
+	// Compact timestamps map: 32 bit, relative to an epoch.
+	bool timestampsCompact;
+	int64_t timestampsEpoch;
 	// Maps and their sizes.
 	uint16_t sizeX;
 	uint16_t sizeY;
@@ -41,16 +135,68 @@ struct dvs_pixel_with_count {
 	uint32_t count;
 };
 
+// Continuous hot pixel learning: events in the current evaluation window,
+// and decayed rate estimate, in events per hotPixelTime.
+struct dvs_pixel_rate {
+	uint32_t count;
+	uint32_t rate;
+};
+
 #define GET_TS(X)          ((X) >> 1)
 #define GET_POL(X)         ((X) &0x01)
 #define SET_TSPOL(TS, POL) (((TS) << 1) | ((POL) &0x01))
 
+// Compact timestamps map: maximum relative timestamp that fits in 31 bits
+// next to the polarity, and how much history to keep when rebasing.
+#define TS_COMPACT_MAX    ((INT64_C(1) << 31) - 1)
+#define TS_COMPACT_WINDOW (INT64_C(1) << 30)
+
+// Timestamps map layout: rows are padded with one entry on the left and two
+// on the right, and there is a padding row above and below the array, so the
+// support kernels can load whole blocks around any pixel. Padding entries
+// are never written by events, and always masked out.
+#define TS_MAP_STRIDE(SIZE_X)          ((size_t) (SIZE_X) + 3)
+#define TS_MAP_ENTRIES(SIZE_X, SIZE_Y) (TS_MAP_STRIDE(SIZE_X) * ((size_t) (SIZE_Y) + 2))
+#define TS_MAP_INDEX(SIZE_X, X, Y)     ((((size_t) (Y) + 1) * TS_MAP_STRIDE(SIZE_X)) + (size_t) (X) + 1)
+#define TS_MAP_ENTRY_SIZE(COMPACT)     ((COMPACT) ? (sizeof(uint32_t)) : (sizeof(int64_t)))
+
+// Background Activity support masks, see dvsNoiseSupportKernel: all eight
+// neighbors, and the ones to drop at each border of the array.
+#define BA_SUPPORT_NEIGHBORS 0x1EF
+#define BA_SUPPORT_LEFT      0x049
+#define BA_SUPPORT_RIGHT     0x124
+#define BA_SUPPORT_ABOVE     0x007
+#define BA_SUPPORT_BELOW     0x1C0
+
+#define HOTPIXEL_MAP_SIZE(PIXELS)  (((PIXELS) + 63) / 64)
+#define HOTPIXEL_MAP_GET(MAP, IDX) (((MAP)[(IDX) >> 6] >> ((IDX) &0x3F)) & 0x01)
+#define HOTPIXEL_MAP_SET(MAP, IDX) ((MAP)[(IDX) >> 6] |= (UINT64_C(1) << ((IDX) &0x3F)))
+#define HOTPIXEL_MAP_CLR(MAP, IDX) ((MAP)[(IDX) >> 6] &= ~(UINT64_C(1) << ((IDX) &0x3F)))
+
+// Continuous hot pixel learning: maximum rows evaluated per packet, so the
+// work done per packet stays bounded, whatever the resolution.
+#define HOTPIXEL_SWEEP_ROWS_MAX 16
+
 static void filterDVSNoiseLog(enum caer_log_level logLevel, caerFilterDVSNoise handle, const char *format, ...)
 	ATTRIBUTE_FORMAT(3);
 static int hotPixelArrayCountCompare(const void *a, const void *b);
+static void timestampsMapRebase(caerFilterDVSNoise noiseFilter, int64_t newEpoch);
+static void timestampsMapCompact(caerFilterDVSNoise noiseFilter);
+static void timestampsMapExpand(caerFilterDVSNoise noiseFilter);
 static void hotPixelGenerateArray(caerFilterDVSNoise noiseFilter);
+static void hotPixelMapGenerate(caerFilterDVSNoise noiseFilter);
+static bool hotPixelContinuousStart(caerFilterDVSNoise noiseFilter);
+static void hotPixelContinuousStop(caerFilterDVSNoise noiseFilter);
+static void hotPixelContinuousUpdate(caerFilterDVSNoise noiseFilter, int64_t ts);
+static ssize_t hotPixelContinuousGetHotPixels(caerFilterDVSNoise noiseFilter, caerFilterDVSPixel *hotPixels);
 static void caerFilterDVSNoiseApplyInternal(
 	caerFilterDVSNoise noiseFilter, caerPolarityEventPacket polarityPacket, bool statisticsOnly);
+static bool filterDVSNoiseApplyParallel(
+	caerFilterDVSNoise noiseFilter, caerPolarityEventPacket polarityPacket, bool statisticsOnly);
+static bool filterDVSNoiseBandsStart(caerFilterDVSNoise noiseFilter, uint32_t threads);
+static void filterDVSNoiseBandsStop(caerFilterDVSNoise noiseFilter);
+static void filterDVSNoiseBandsFree(caerFilterDVSNoise noiseFilter);
+static int filterDVSNoiseBandThreadRun(void *bandPtr);
 
 static void filterDVSNoiseLog(enum caer_log_level logLevel, caerFilterDVSNoise handle, const char *format, ...) {
 	// Only log messages above the specified severity level.
@@ -66,9 +212,141 @@ static void filterDVSNoiseLog(enum caer_log_level logLevel, caerFilterDVSNoise h
 	va_end(argumentList);
 }
 
+// A timestamps map entry supports an event if it is newer than the threshold,
+// and has the same polarity, if checked. Entries are compared as stored,
+// so compact ones with a threshold relative to the epoch.
+static inline uint32_t supportEntry(int64_t entry, int64_t threshold, int64_t polarity, int64_t polarityMask) {
+	return (U32T((entry > threshold) & (((entry ^ polarity) & polarityMask) == 0)));
+}
+
+static uint32_t supportKernelScalar(const void *rowAbove, const void *row, const void *rowBelow, size_t x,
+	int64_t threshold, int64_t polarity, int64_t polarityMask) {
+	const int64_t *rows[3] = {rowAbove, row, rowBelow};
+	uint32_t support       = 0;
+
+	for (size_t r = 0; r < 3; r++) {
+		for (size_t c = 0; c < 3; c++) {
+			support |= supportEntry(rows[r][x + c], threshold, polarity, polarityMask) << ((r * 3) + c);
+		}
+	}
+
+	return (support);
+}
+
+static uint32_t supportKernelCompactScalar(const void *rowAbove, const void *row, const void *rowBelow, size_t x,
+	int64_t threshold, int64_t polarity, int64_t polarityMask) {
+	const uint32_t *rows[3] = {rowAbove, row, rowBelow};
+	uint32_t support        = 0;
+
+	for (size_t r = 0; r < 3; r++) {
+		for (size_t c = 0; c < 3; c++) {
+			support |= supportEntry(rows[r][x + c], threshold, polarity, polarityMask) << ((r * 3) + c);
+		}
+	}
+
+	return (support);
+}
+
+#if defined(DVS_NOISE_KERNELS_AVX2)
+// One row at a time: four entries compared at once, the fourth one ignored.
+__attribute__((target("avx2"))) static inline uint32_t supportRowAVX2(
+	__m256i entries, __m256i threshold, __m256i polarity, __m256i polarityMask) {
+	__m256i newer   = _mm256_cmpgt_epi64(entries, threshold);
+	__m256i samePol = _mm256_cmpeq_epi64(
+		_mm256_and_si256(_mm256_xor_si256(entries, polarity), polarityMask), _mm256_setzero_si256());
+
+	return (U32T(_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_and_si256(newer, samePol)))) & 0x07);
+}
+
+__attribute__((target("avx2"))) static uint32_t supportKernelAVX2(const void *rowAbove, const void *row,
+	const void *rowBelow, size_t x, int64_t threshold, int64_t polarity, int64_t polarityMask) {
+	const int64_t *rows[3] = {rowAbove, row, rowBelow};
+	__m256i thresholdV     = _mm256_set1_epi64x(threshold);
+	__m256i polarityV      = _mm256_set1_epi64x(polarity);
+	__m256i polarityMaskV  = _mm256_set1_epi64x(polarityMask);
+	uint32_t support       = 0;
+
+	for (size_t r = 0; r < 3; r++) {
+		__m256i entries = _mm256_loadu_si256((const __m256i *) (rows[r] + x));
+
+		support |= supportRowAVX2(entries, thresholdV, polarityV, polarityMaskV) << (r * 3);
+	}
+
+	return (support);
+}
+
+__attribute__((target("avx2"))) static uint32_t supportKernelCompactAVX2(const void *rowAbove, const void *row,
+	const void *rowBelow, size_t x, int64_t threshold, int64_t polarity, int64_t polarityMask) {
+	const uint32_t *rows[3] = {rowAbove, row, rowBelow};
+	__m256i thresholdV      = _mm256_set1_epi64x(threshold);
+	__m256i polarityV       = _mm256_set1_epi64x(polarity);
+	__m256i polarityMaskV   = _mm256_set1_epi64x(polarityMask);
+	uint32_t support        = 0;
+
+	for (size_t r = 0; r < 3; r++) {
+		__m256i entries = _mm256_cvtepu32_epi64(_mm_loadu_si128((const __m128i *) (rows[r] + x)));
+
+		support |= supportRowAVX2(entries, thresholdV, polarityV, polarityMaskV) << (r * 3);
+	}
+
+	return (support);
+}
+#endif
+
+#if defined(DVS_NOISE_KERNELS_NEON)
+// One row at a time, as two pairs of entries, the fourth one ignored.
+static inline uint32_t supportRowNEON(
+	int64x2_t entriesLow, int64x2_t entriesHigh, int64x2_t threshold, int64x2_t polarity, int64x2_t polarityMask) {
+	uint64x2_t low = vandq_u64(vcgtq_s64(entriesLow, threshold),
+		vceqzq_s64(vandq_s64(veorq_s64(entriesLow, polarity), polarityMask)));
+	uint64x2_t high = vandq_u64(vcgtq_s64(entriesHigh, threshold),
+		vceqzq_s64(vandq_s64(veorq_s64(entriesHigh, polarity), polarityMask)));
+
+	return (U32T((vgetq_lane_u64(low, 0) & 0x01) | (vgetq_lane_u64(low, 1) & 0x02) | (vgetq_lane_u64(high, 0) & 0x04)));
+}
+
+static uint32_t supportKernelNEON(const void *rowAbove, const void *row, const void *rowBelow, size_t x,
+	int64_t threshold, int64_t polarity, int64_t polarityMask) {
+	const int64_t *rows[3] = {rowAbove, row, rowBelow};
+	int64x2_t thresholdV    = vdupq_n_s64(threshold);
+	int64x2_t polarityV     = vdupq_n_s64(polarity);
+	int64x2_t polarityMaskV = vdupq_n_s64(polarityMask);
+	uint32_t support        = 0;
+
+	for (size_t r = 0; r < 3; r++) {
+		int64x2_t entriesLow  = vld1q_s64(rows[r] + x);
+		int64x2_t entriesHigh = vld1q_s64(rows[r] + x + 2);
+
+		support |= supportRowNEON(entriesLow, entriesHigh, thresholdV, polarityV, polarityMaskV) << (r * 3);
+	}
+
+	return (support);
+}
+
+static uint32_t supportKernelCompactNEON(const void *rowAbove, const void *row, const void *rowBelow, size_t x,
+	int64_t threshold, int64_t polarity, int64_t polarityMask) {
+	const uint32_t *rows[3] = {rowAbove, row, rowBelow};
+	int64x2_t thresholdV    = vdupq_n_s64(threshold);
+	int64x2_t polarityV     = vdupq_n_s64(polarity);
+	int64x2_t polarityMaskV = vdupq_n_s64(polarityMask);
+	uint32_t support        = 0;
+
+	for (size_t r = 0; r < 3; r++) {
+		uint32x4_t entries    = vld1q_u32(rows[r] + x);
+		int64x2_t entriesLow  = vreinterpretq_s64_u64(vmovl_u32(vget_low_u32(entries)));
+		int64x2_t entriesHigh = vreinterpretq_s64_u64(vmovl_u32(vget_high_u32(entries)));
+
+		support |= supportRowNEON(entriesLow, entriesHigh, thresholdV, polarityV, polarityMaskV) << (r * 3);
+	}
+
+	return (support);
+}
+#endif
+
 caerFilterDVSNoise caerFilterDVSNoiseInitialize(uint16_t sizeX, uint16_t sizeY) {
+	// Zeroed padding included, see TS_MAP_STRIDE.
 	caerFilterDVSNoise noiseFilter
-		= calloc(1, sizeof(struct caer_filter_dvs_noise) + ((size_t) sizeX * (size_t) sizeY * sizeof(int64_t)));
+		= calloc(1, sizeof(struct caer_filter_dvs_noise) + (TS_MAP_ENTRIES(sizeX, sizeY) * sizeof(int64_t)));
 	if (noiseFilter == NULL) {
 		return (NULL);
 	}
@@ -76,6 +354,28 @@ caerFilterDVSNoise caerFilterDVSNoiseInitialize(uint16_t sizeX, uint16_t sizeY)
 	noiseFilter->sizeX = sizeX;
 	noiseFilter->sizeY = sizeY;
 
+	// Fastest Background Activity support kernels this CPU can run, picked once.
+	noiseFilter->backgroundActivitySupport        = &supportKernelScalar;
+	noiseFilter->backgroundActivitySupportCompact = &supportKernelCompactScalar;
+
+#if defined(DVS_NOISE_KERNELS_AVX2)
+	if (__builtin_cpu_supports("avx2")) {
+		noiseFilter->backgroundActivitySupport        = &supportKernelAVX2;
+		noiseFilter->backgroundActivitySupportCompact = &supportKernelCompactAVX2;
+	}
+#elif defined(DVS_NOISE_KERNELS_NEON)
+	noiseFilter->backgroundActivitySupport        = &supportKernelNEON;
+	noiseFilter->backgroundActivitySupportCompact = &supportKernelCompactNEON;
+#endif
+
+	// Hot pixel bitmap, so that filtering is a single lookup per event,
+	// independent of how many hot pixels there are.
+	noiseFilter->hotPixelMap = calloc(HOTPIXEL_MAP_SIZE((size_t) sizeX * (size_t) sizeY), sizeof(uint64_t));
+	if (noiseFilter->hotPixelMap == NULL) {
+		free(noiseFilter);
+		return (NULL);
+	}
+
 	// Default to global log-level.
 	enum caer_log_level logLevel = caerLogLevelGet();
 	noiseFilter->logLevel        = U8T(logLevel);
@@ -93,151 +393,192 @@ caerFilterDVSNoise caerFilterDVSNoiseInitialize(uint16_t sizeX, uint16_t sizeY)
 	return (noiseFilter);
 }
 
-static inline size_t doBackgroundActivityLookup(caerFilterDVSNoise noiseFilter, size_t x, size_t y, size_t pixelIndex,
-	int64_t timestamp, bool polarity, size_t *supportIndexes) {
-	// Compute map limits.
-	bool notBorderLeft  = (x != 0);
-	bool notBorderDown  = (y != (size_t)(noiseFilter->sizeY - 1));
-	bool notBorderRight = (x != (size_t)(noiseFilter->sizeX - 1));
-	bool notBorderUp    = (y != 0);
-
-	// Background Activity filter: if difference between current timestamp
-	// and stored neighbor timestamp is smaller than given time limit, it
-	// means the event is supported by a neighbor and thus valid. If it is
-	// bigger, then the event is not supported, and we need to check the
-	// next neighbor. If all are bigger, the event is invalid.
-	size_t result = 0;
-
-	{
-		if (notBorderLeft) {
-			pixelIndex--;
-
-			if ((timestamp - GET_TS(noiseFilter->timestampsMap[pixelIndex])) < noiseFilter->backgroundActivityTime) {
-				if (!noiseFilter->backgroundActivityCheckPolarity
-					|| polarity == GET_POL(noiseFilter->timestampsMap[pixelIndex])) {
-					if (supportIndexes != NULL) {
-						supportIndexes[result] = pixelIndex;
-					}
-					result++;
-				}
-			}
+// Timestamps map entries, in either layout, always read back as the full
+// 64 bit timestamp and polarity, as packed by SET_TSPOL().
+static inline int64_t timestampsMapGet(caerFilterDVSNoise noiseFilter, size_t mapIndex) {
+	if (noiseFilter->timestampsCompact) {
+		return ((noiseFilter->timestampsEpoch << 1) + ((uint32_t *) noiseFilter->timestampsMap)[mapIndex]);
+	}
 
-			pixelIndex++;
-		}
+	return (noiseFilter->timestampsMap[mapIndex]);
+}
 
-		if (notBorderRight) {
-			pixelIndex++;
+// Store into any row in the map's layout: the map itself, or a halo copy.
+static inline void timestampsEntrySet(caerFilterDVSNoise noiseFilter, void *row, size_t index, int64_t ts, bool pol) {
+	if (noiseFilter->timestampsCompact) {
+		((uint32_t *) row)[index] = U32T(SET_TSPOL(ts - noiseFilter->timestampsEpoch, pol));
+	}
+	else {
+		((int64_t *) row)[index] = SET_TSPOL(ts, pol);
+	}
+}
 
-			if ((timestamp - GET_TS(noiseFilter->timestampsMap[pixelIndex])) < noiseFilter->backgroundActivityTime) {
-				if (!noiseFilter->backgroundActivityCheckPolarity
-					|| polarity == GET_POL(noiseFilter->timestampsMap[pixelIndex])) {
-					if (supportIndexes != NULL) {
-						supportIndexes[result] = pixelIndex;
-					}
-					result++;
-				}
-			}
+static inline void timestampsMapSet(caerFilterDVSNoise noiseFilter, size_t mapIndex, int64_t ts, bool pol) {
+	if (noiseFilter->timestampsCompact) {
+		int64_t relativeTS = ts - noiseFilter->timestampsEpoch;
 
-			pixelIndex--;
+		if ((relativeTS < 0) || (relativeTS > TS_COMPACT_MAX)) {
+			// Out of range: move the epoch, keeping as much history as needed.
+			timestampsMapRebase(noiseFilter, (relativeTS < 0) ? (ts) : (ts - TS_COMPACT_WINDOW));
 		}
 	}
 
-	if (notBorderUp) {
-		pixelIndex -= noiseFilter->sizeX; // Previous row.
+	timestampsEntrySet(noiseFilter, noiseFilter->timestampsMap, mapIndex, ts, pol);
+}
 
-		if ((timestamp - GET_TS(noiseFilter->timestampsMap[pixelIndex])) < noiseFilter->backgroundActivityTime) {
-			if (!noiseFilter->backgroundActivityCheckPolarity
-				|| polarity == GET_POL(noiseFilter->timestampsMap[pixelIndex])) {
-				if (supportIndexes != NULL) {
-					supportIndexes[result] = pixelIndex;
-				}
-				result++;
-			}
-		}
+// Row of the timestamps map, counting the padding row above, as seen from a
+// band: owned rows from the shared map, the others from the band's halo
+// copies. Without a band, the whole map.
+static inline const void *timestampsRowGet(
+	caerFilterDVSNoise noiseFilter, const struct dvs_noise_band *band, size_t mapRow) {
+	if (band != NULL) {
+		return (band->rows[mapRow + 1 - band->rowStart]);
+	}
 
-		if (notBorderLeft) {
-			pixelIndex--;
+	size_t rowSize = TS_MAP_STRIDE(noiseFilter->sizeX) * TS_MAP_ENTRY_SIZE(noiseFilter->timestampsCompact);
 
-			if ((timestamp - GET_TS(noiseFilter->timestampsMap[pixelIndex])) < noiseFilter->backgroundActivityTime) {
-				if (!noiseFilter->backgroundActivityCheckPolarity
-					|| polarity == GET_POL(noiseFilter->timestampsMap[pixelIndex])) {
-					if (supportIndexes != NULL) {
-						supportIndexes[result] = pixelIndex;
-					}
-					result++;
-				}
-			}
+	return ((const uint8_t *) noiseFilter->timestampsMap + (mapRow * rowSize));
+}
 
-			pixelIndex++;
-		}
+// Population count of a support mask.
+static inline uint32_t supportCount(uint32_t support) {
+	support = support - ((support >> 1) & 0x55555555);
+	support = (support & 0x33333333) + ((support >> 2) & 0x33333333);
 
-		if (notBorderRight) {
-			pixelIndex++;
+	return ((((support + (support >> 4)) & 0x0F0F0F0F) * 0x01010101) >> 24);
+}
 
-			if ((timestamp - GET_TS(noiseFilter->timestampsMap[pixelIndex])) < noiseFilter->backgroundActivityTime) {
-				if (!noiseFilter->backgroundActivityCheckPolarity
-					|| polarity == GET_POL(noiseFilter->timestampsMap[pixelIndex])) {
-					if (supportIndexes != NULL) {
-						supportIndexes[result] = pixelIndex;
-					}
-					result++;
-				}
-			}
+// Background Activity filter: a neighbor supports the event if its stored
+// timestamp is within backgroundActivityTime of it, see filterDVSNoiseEvent()
+// for the threshold. Returns the supporting neighbors as a mask, in the
+// layout described at dvsNoiseSupportKernel.
+static inline uint32_t doBackgroundActivityLookup(caerFilterDVSNoise noiseFilter, const struct dvs_noise_band *band,
+	size_t x, size_t y, int64_t threshold, int64_t polarity) {
+	// Neighbors outside the array are in the map's padding, so all entries
+	// can be checked the same way, without branches, and then masked out.
+	uint32_t valid = BA_SUPPORT_NEIGHBORS;
+	valid &= ~(U32T(x == 0) * BA_SUPPORT_LEFT);
+	valid &= ~(U32T(x == (size_t) (noiseFilter->sizeX - 1)) * BA_SUPPORT_RIGHT);
+	valid &= ~(U32T(y == 0) * BA_SUPPORT_ABOVE);
+	valid &= ~(U32T(y == (size_t) (noiseFilter->sizeY - 1)) * BA_SUPPORT_BELOW);
+
+	// Map row y holds the row above the pixel, because of the padding row.
+	dvsNoiseSupportKernel support = (noiseFilter->timestampsCompact) ? (noiseFilter->backgroundActivitySupportCompact)
+																	 : (noiseFilter->backgroundActivitySupport);
+
+	return (support(timestampsRowGet(noiseFilter, band, y), timestampsRowGet(noiseFilter, band, y + 1),
+				timestampsRowGet(noiseFilter, band, y + 2), x, threshold, polarity,
+				noiseFilter->backgroundActivityCheckPolarity)
+			& valid);
+}
 
-			pixelIndex--;
-		}
+// Hot Pixel, Refractory Period and Background-Activity filters for one
+// event, plus the timestamps map update. Shared by serial and parallel
+// filtering, so that they always take the same decisions.
+static inline enum dvs_noise_filtered filterDVSNoiseEvent(caerFilterDVSNoise noiseFilter,
+	const struct dvs_noise_band *band, size_t x, size_t y, size_t pixelIndex, int64_t ts, bool pol) {
+	enum dvs_noise_filtered filtered = DVS_NOISE_PASSED;
+	size_t mapIndex                  = TS_MAP_INDEX(noiseFilter->sizeX, x, y);
 
-		pixelIndex += noiseFilter->sizeX; // Back to middle row.
+	// Hot Pixel filter: filter out abnormally active pixels by their address.
+	if (noiseFilter->hotPixelEnabled && HOTPIXEL_MAP_GET(noiseFilter->hotPixelMap, pixelIndex)) {
+		// Don't execute other filters and don't update timestamps map.
+		// Hot pixels don't provide any useful timing information, as
+		// they are repeating noise.
+		return (DVS_NOISE_HOTPIXEL);
 	}
 
-	if (notBorderDown) {
-		pixelIndex += noiseFilter->sizeX; // Next row.
+	// Refractory Period filter.
+	// Execute before BAFilter, as this is a much simpler check, so if we
+	// can we try to eliminate the event early in a less costly manner.
+	if (noiseFilter->refractoryPeriodEnabled) {
+		if ((ts - GET_TS(timestampsMapGet(noiseFilter, mapIndex))) < noiseFilter->refractoryPeriodTime) {
+			filtered = DVS_NOISE_REFRACTORY_PERIOD;
 
-		if ((timestamp - GET_TS(noiseFilter->timestampsMap[pixelIndex])) < noiseFilter->backgroundActivityTime) {
-			if (!noiseFilter->backgroundActivityCheckPolarity
-				|| polarity == GET_POL(noiseFilter->timestampsMap[pixelIndex])) {
-				if (supportIndexes != NULL) {
-					supportIndexes[result] = pixelIndex;
-				}
-				result++;
-			}
+			goto WriteTimestamp;
 		}
+	}
 
-		if (notBorderLeft) {
-			pixelIndex--;
+	if (noiseFilter->backgroundActivityEnabled) {
+		// Background Activity filter: if difference between current timestamp
+		// and stored neighbor timestamp is smaller than given time limit, it
+		// means the event is supported by a neighbor and thus valid. On the
+		// stored entries, as packed by SET_TSPOL() and relative to the epoch
+		// if compact, that is being above this threshold.
+		int64_t threshold = (2 * (ts - noiseFilter->timestampsEpoch - noiseFilter->backgroundActivityTime)) + 1;
 
-			if ((timestamp - GET_TS(noiseFilter->timestampsMap[pixelIndex])) < noiseFilter->backgroundActivityTime) {
-				if (!noiseFilter->backgroundActivityCheckPolarity
-					|| polarity == GET_POL(noiseFilter->timestampsMap[pixelIndex])) {
-					if (supportIndexes != NULL) {
-						supportIndexes[result] = pixelIndex;
+		uint32_t support = doBackgroundActivityLookup(noiseFilter, band, x, y, threshold, pol);
+		uint32_t supportPixelNum = supportCount(support);
+
+		if ((supportPixelNum >= noiseFilter->backgroundActivitySupportMin)
+			&& (supportPixelNum <= noiseFilter->backgroundActivitySupportMax)) {
+			if (noiseFilter->backgroundActivityTwoLevels) {
+				// Do the check again for all previously discovered supporting pixels.
+				for (size_t i = 0; support != 0; i++, support >>= 1) {
+					if ((support & 0x01)
+						&& (doBackgroundActivityLookup(
+								noiseFilter, band, x + (i % 3) - 1, y + (i / 3) - 1, threshold, pol)
+							!= 0)) {
+						goto WriteTimestamp;
 					}
-					result++;
 				}
 			}
-
-			pixelIndex++;
+			else {
+				goto WriteTimestamp;
+			}
 		}
 
-		if (notBorderRight) {
-			pixelIndex++;
+		// Event is not supported by any neighbor if we get here.
+		filtered = DVS_NOISE_BACKGROUND_ACTIVITY;
+	}
 
-			if ((timestamp - GET_TS(noiseFilter->timestampsMap[pixelIndex])) < noiseFilter->backgroundActivityTime) {
-				if (!noiseFilter->backgroundActivityCheckPolarity
-					|| polarity == GET_POL(noiseFilter->timestampsMap[pixelIndex])) {
-					if (supportIndexes != NULL) {
-						supportIndexes[result] = pixelIndex;
-					}
-					result++;
-				}
+WriteTimestamp:
+	// Update pixel timestamp (one write). Always update so filters are
+	// ready at enable-time right away.
+	timestampsMapSet(noiseFilter, mapIndex, ts, pol);
+
+	return (filtered);
+}
+
+static inline void filterDVSNoiseStatisticsAdd(
+	caerFilterDVSNoise noiseFilter, enum dvs_noise_filtered filtered, bool pol, uint64_t count) {
+	switch (filtered) {
+		case DVS_NOISE_HOTPIXEL:
+			if (pol) {
+				noiseFilter->hotPixelStatOn += count;
 			}
-		}
-	}
+			else {
+				noiseFilter->hotPixelStatOff += count;
+			}
+			break;
 
-	return (result);
+		case DVS_NOISE_REFRACTORY_PERIOD:
+			if (pol) {
+				noiseFilter->refractoryPeriodStatOn += count;
+			}
+			else {
+				noiseFilter->refractoryPeriodStatOff += count;
+			}
+			break;
+
+		case DVS_NOISE_BACKGROUND_ACTIVITY:
+			if (pol) {
+				noiseFilter->backgroundActivityStatOn += count;
+			}
+			else {
+				noiseFilter->backgroundActivityStatOff += count;
+			}
+			break;
+
+		default:
+			break;
+	}
 }
 
 void caerFilterDVSNoiseDestroy(caerFilterDVSNoise noiseFilter) {
+	// Stop parallel filtering worker threads, if any.
+	filterDVSNoiseBandsStop(noiseFilter);
+
 	// Ensure hot pixel map is also destroyed if still present,
 	// for example if learning never terminated.
 	if (noiseFilter->hotPixelLearningMap != NULL) {
@@ -249,6 +590,10 @@ void caerFilterDVSNoiseDestroy(caerFilterDVSNoise noiseFilter) {
 		free(noiseFilter->hotPixelArray);
 	}
 
+	free(noiseFilter->hotPixelMap);
+
+	hotPixelContinuousStop(noiseFilter);
+
 	free(noiseFilter);
 }
 
@@ -293,6 +638,20 @@ static void caerFilterDVSNoiseApplyInternal(
 		}
 	}
 
+	// Continuous hot pixel learning: evaluate the rows that are due, based
+	// on the events counted up to the previous packet.
+	if (noiseFilter->hotPixelRates != NULL) {
+		caerPolarityEventConst firstEvent = caerPolarityEventPacketGetEventConst(polarityPacket, 0);
+		hotPixelContinuousUpdate(noiseFilter, caerPolarityEventGetTimestamp64(firstEvent, polarityPacket));
+	}
+
+	// Parallel filtering, except while learning hot pixels: learning counts
+	// all events in order, and changes the hot pixels in the middle of a packet.
+	if ((noiseFilter->bandsNumber > 1) && !noiseFilter->hotPixelLearningStarted
+		&& filterDVSNoiseApplyParallel(noiseFilter, polarityPacket, statisticsOnly)) {
+		return;
+	}
+
 	CAER_POLARITY_ITERATOR_VALID_START(polarityPacket)
 	uint16_t x        = caerPolarityEventGetX(caerPolarityIteratorElement);
 	uint16_t y        = caerPolarityEventGetY(caerPolarityIteratorElement);
@@ -323,104 +682,390 @@ static void caerFilterDVSNoiseApplyInternal(
 		}
 	}
 
-	// Hot Pixel filter: filter out abnormally active pixels by their address.
-	if (noiseFilter->hotPixelEnabled) {
-		bool filteredOut = false;
+	// Continuous hot pixel learning counts all events too.
+	if (noiseFilter->hotPixelRates != NULL) {
+		noiseFilter->hotPixelRates[pixelIndex].count++;
+	}
 
-		for (size_t i = 0; i < noiseFilter->hotPixelArraySize; i++) {
-			if ((x == noiseFilter->hotPixelArray[i].x) && (y == noiseFilter->hotPixelArray[i].y)) {
-				if (!statisticsOnly) {
-					caerPolarityEventInvalidate(caerPolarityIteratorElement, polarityPacket);
-				}
-				if (pol) {
-					noiseFilter->hotPixelStatOn++;
-				}
-				else {
-					noiseFilter->hotPixelStatOff++;
-				}
+	enum dvs_noise_filtered filtered = filterDVSNoiseEvent(noiseFilter, NULL, x, y, pixelIndex, ts, pol);
 
-				filteredOut = true;
-				break;
+	if (filtered != DVS_NOISE_PASSED) {
+		if (!statisticsOnly) {
+			caerPolarityEventInvalidate(caerPolarityIteratorElement, polarityPacket);
+		}
+
+		filterDVSNoiseStatisticsAdd(noiseFilter, filtered, pol, 1);
+	}
+	CAER_POLARITY_ITERATOR_VALID_END
+}
+
+static bool filterDVSNoiseApplyParallel(
+	caerFilterDVSNoise noiseFilter, caerPolarityEventPacket polarityPacket, bool statisticsOnly) {
+	int32_t eventsNumber = caerEventPacketHeaderGetEventNumber(&polarityPacket->packetHeader);
+
+	// Any band may get all the events, grow buffers as needed.
+	if ((size_t) eventsNumber > noiseFilter->bandsEventsCapacity) {
+		for (size_t b = 0; b < noiseFilter->bandsNumber; b++) {
+			uint32_t *events = realloc(noiseFilter->bands[b].events, (size_t) eventsNumber * sizeof(uint32_t));
+			if (events == NULL) {
+				filterDVSNoiseLog(CAER_LOG_ERROR, noiseFilter,
+					"Parallel filtering: failed to allocate memory for band events, filtering serially.");
+				return (false);
 			}
+
+			noiseFilter->bands[b].events = events;
 		}
 
-		if (filteredOut) {
-			// Go to next event, don't execute other filters and don't
-			// update timestamps map. Hot pixels don't provide any useful
-			// timing information, as they are repeating noise.
-			continue;
+		noiseFilter->bandsEventsCapacity = (size_t) eventsNumber;
+	}
+
+	size_t lastBand = noiseFilter->bandsNumber - 1;
+	size_t bandRows = noiseFilter->bands[0].rowEnd;
+	size_t haloRows = (noiseFilter->backgroundActivityTwoLevels) ? (2) : (1);
+
+	for (size_t b = 0; b <= lastBand; b++) {
+		struct dvs_noise_band *band = &noiseFilter->bands[b];
+
+		band->eventsNumber     = 0;
+		band->invalidateNumber = 0;
+		memset(band->filtered, 0, sizeof(band->filtered));
+	}
+
+	// Split the events into the bands, keeping their order.
+	int64_t minTS = INT64_MAX;
+	int64_t maxTS = INT64_MIN;
+
+	CAER_POLARITY_CONST_ITERATOR_VALID_START(polarityPacket)
+	size_t y   = caerPolarityEventGetY(caerPolarityIteratorElement);
+	int64_t ts = caerPolarityEventGetTimestamp64(caerPolarityIteratorElement, polarityPacket);
+
+	if (ts < minTS) {
+		minTS = ts;
+	}
+	if (ts > maxTS) {
+		maxTS = ts;
+	}
+
+	size_t b = y / bandRows;
+	if (b > lastBand) {
+		b = lastBand; // Last band takes the remaining rows.
+	}
+
+	struct dvs_noise_band *band = &noiseFilter->bands[b];
+
+	band->events[band->eventsNumber++] = U32T(caerPolarityIteratorCounter);
+
+	// Events close to a band border also update the neighbor band's halo.
+	if ((b > 0) && (y < (band->rowStart + haloRows))) {
+		struct dvs_noise_band *bandAbove = &noiseFilter->bands[b - 1];
+
+		bandAbove->events[bandAbove->eventsNumber++] = U32T(caerPolarityIteratorCounter) | BAND_EVENT_HALO;
+	}
+	else if ((b < lastBand) && (y >= (band->rowEnd - haloRows))) {
+		struct dvs_noise_band *bandBelow = &noiseFilter->bands[b + 1];
+
+		bandBelow->events[bandBelow->eventsNumber++] = U32T(caerPolarityIteratorCounter) | BAND_EVENT_HALO;
+	}
+	CAER_POLARITY_ITERATOR_VALID_END
+
+	// The compact timestamps map can only be rebased here, before the bands
+	// start, so ensure the whole packet fits the epoch.
+	if (noiseFilter->timestampsCompact
+		&& ((minTS < noiseFilter->timestampsEpoch) || ((maxTS - noiseFilter->timestampsEpoch) > TS_COMPACT_MAX))) {
+		int64_t newEpoch = (minTS < noiseFilter->timestampsEpoch) ? (minTS) : (maxTS - TS_COMPACT_WINDOW);
+
+		if ((minTS < newEpoch) || ((maxTS - newEpoch) > TS_COMPACT_MAX)) {
+			// Packet spans too much time, let serial filtering deal with it.
+			return (false);
 		}
+
+		timestampsMapRebase(noiseFilter, newEpoch);
 	}
 
-	// Refractory Period filter.
-	// Execute before BAFilter, as this is a much simpler check, so if we
-	// can we try to eliminate the event early in a less costly manner.
-	if (noiseFilter->refractoryPeriodEnabled) {
-		if ((ts - GET_TS(noiseFilter->timestampsMap[pixelIndex])) < noiseFilter->refractoryPeriodTime) {
-			if (!statisticsOnly) {
-				caerPolarityEventInvalidate(caerPolarityIteratorElement, polarityPacket);
+	// Fresh halo copies, with the owner bands' current timestamps, and the
+	// rows seen from each band. Pixel row y is map row y + 1, see TS_MAP_STRIDE.
+	size_t rowSize   = TS_MAP_STRIDE(noiseFilter->sizeX) * TS_MAP_ENTRY_SIZE(noiseFilter->timestampsCompact);
+	uint8_t *mapRows = (uint8_t *) noiseFilter->timestampsMap;
+
+	for (size_t b = 0; b <= lastBand; b++) {
+		struct dvs_noise_band *band = &noiseFilter->bands[b];
+
+		if (b > 0) {
+			memcpy(band->haloAbove, mapRows + ((band->rowStart - haloRows + 1) * rowSize), haloRows * rowSize);
+		}
+		if (b < lastBand) {
+			memcpy(band->haloBelow, mapRows + ((band->rowEnd + 1) * rowSize), haloRows * rowSize);
+		}
+
+		// Rows no lookup can reach come from the map, clamped to its padding.
+		for (size_t i = 0; i < BAND_ROWS_SPAN(band); i++) {
+			ptrdiff_t y = (ptrdiff_t) (band->rowStart + i) - BAND_HALO_ROWS_MAX;
+
+			if ((b > 0) && (y < (ptrdiff_t) band->rowStart) && (y >= (ptrdiff_t) (band->rowStart - haloRows))) {
+				band->rows[i] = (uint8_t *) band->haloAbove + ((size_t) y + haloRows - band->rowStart) * rowSize;
 			}
-			if (pol) {
-				noiseFilter->refractoryPeriodStatOn++;
+			else if ((b < lastBand) && (y >= (ptrdiff_t) band->rowEnd)
+					 && (y < (ptrdiff_t) (band->rowEnd + haloRows))) {
+				band->rows[i] = (uint8_t *) band->haloBelow + ((size_t) y - band->rowEnd) * rowSize;
 			}
 			else {
-				noiseFilter->refractoryPeriodStatOff++;
+				y             = (y < -1) ? (-1) : ((y > noiseFilter->sizeY) ? (noiseFilter->sizeY) : (y));
+				band->rows[i] = mapRows + ((size_t) (y + 1) * rowSize);
 			}
+		}
+	}
 
-			goto WriteTimestamp;
+	// Run all bands and wait for them to be done.
+	mtx_lock(&noiseFilter->bandsLock);
+
+	noiseFilter->bandsPacket         = polarityPacket;
+	noiseFilter->bandsStatisticsOnly = statisticsOnly;
+	noiseFilter->bandsPending        = noiseFilter->bandsNumber;
+	noiseFilter->bandsGeneration++;
+
+	cnd_broadcast(&noiseFilter->bandsStartCond);
+
+	while (noiseFilter->bandsPending > 0) {
+		cnd_wait(&noiseFilter->bandsDoneCond, &noiseFilter->bandsLock);
+	}
+
+	mtx_unlock(&noiseFilter->bandsLock);
+
+	// Merge results back.
+	for (size_t b = 0; b <= lastBand; b++) {
+		struct dvs_noise_band *band = &noiseFilter->bands[b];
+
+		for (size_t i = 0; i < band->invalidateNumber; i++) {
+			caerPolarityEventInvalidate(
+				caerPolarityEventPacketGetEvent(polarityPacket, I32T(band->events[i])), polarityPacket);
+		}
+
+		for (size_t f = 0; f < DVS_NOISE_FILTERED_NUM; f++) {
+			filterDVSNoiseStatisticsAdd(noiseFilter, (enum dvs_noise_filtered) f, false, band->filtered[f][0]);
+			filterDVSNoiseStatisticsAdd(noiseFilter, (enum dvs_noise_filtered) f, true, band->filtered[f][1]);
 		}
 	}
 
-	if (noiseFilter->backgroundActivityEnabled) {
-		size_t supportPixelIndexes[8];
-		size_t supportPixelNum
-			= doBackgroundActivityLookup(noiseFilter, x, y, pixelIndex, ts, pol, supportPixelIndexes);
+	return (true);
+}
 
-		if ((supportPixelNum >= noiseFilter->backgroundActivitySupportMin)
-			&& (supportPixelNum <= noiseFilter->backgroundActivitySupportMax)) {
-			if (noiseFilter->backgroundActivityTwoLevels) {
-				// Do the check again for all previously discovered supporting pixels.
-				for (size_t i = 0; i < supportPixelNum; i++) {
-					size_t supportPixelIndex = supportPixelIndexes[i];
-					size_t supportPixelX     = supportPixelIndex % noiseFilter->sizeX;
-					size_t supportPixelY     = supportPixelIndex / noiseFilter->sizeX;
-
-					if (doBackgroundActivityLookup(
-							noiseFilter, supportPixelX, supportPixelY, supportPixelIndex, ts, pol, NULL)
-						> 0) {
-						goto WriteTimestamp;
-					}
-				}
+static void filterDVSNoiseBandRun(caerFilterDVSNoise noiseFilter, struct dvs_noise_band *band,
+	caerPolarityEventPacket polarityPacket, bool statisticsOnly) {
+	for (size_t i = 0; i < band->eventsNumber; i++) {
+		caerPolarityEvent event
+			= caerPolarityEventPacketGetEvent(polarityPacket, I32T(band->events[i] & ~BAND_EVENT_HALO));
+
+		uint16_t x        = caerPolarityEventGetX(event);
+		uint16_t y        = caerPolarityEventGetY(event);
+		bool pol          = caerPolarityEventGetPolarity(event);
+		int64_t ts        = caerPolarityEventGetTimestamp64(event, polarityPacket);
+		size_t pixelIndex = (y * (size_t) noiseFilter->sizeX) + x; // Target pixel.
+
+		if (band->events[i] & BAND_EVENT_HALO) {
+			// Neighbor band's event: only update the halo copy of the timestamps
+			// map, the same way the owner updates the map (hot pixels never do).
+			if (!(noiseFilter->hotPixelEnabled && HOTPIXEL_MAP_GET(noiseFilter->hotPixelMap, pixelIndex))) {
+				// Same row and entry as in the map, see timestampsRowGet().
+				void *haloRow = band->rows[y + BAND_HALO_ROWS_MAX - band->rowStart];
+
+				timestampsEntrySet(noiseFilter, haloRow, (size_t) x + 1, ts, pol);
 			}
-			else {
-				goto WriteTimestamp;
+
+			continue;
+		}
+
+		// Owned pixel: no other band counts it.
+		if (noiseFilter->hotPixelRates != NULL) {
+			noiseFilter->hotPixelRates[pixelIndex].count++;
+		}
+
+		enum dvs_noise_filtered filtered = filterDVSNoiseEvent(noiseFilter, band, x, y, pixelIndex, ts, pol);
+
+		if (filtered != DVS_NOISE_PASSED) {
+			// Other bands read the same events concurrently, so invalidation
+			// happens later. Never overwrites an entry not processed yet.
+			if (!statisticsOnly) {
+				band->events[band->invalidateNumber++] = band->events[i];
 			}
+
+			band->filtered[filtered][pol]++;
 		}
+	}
+}
 
-		// Event is not supported by any neighbor if we get here, invalidate it.
-		// Then jump over the Refractory Period filter, as it's useless to
-		// execute it (and would cause a double-invalidate error).
-		if (!statisticsOnly) {
-			caerPolarityEventInvalidate(caerPolarityIteratorElement, polarityPacket);
+static int filterDVSNoiseBandThreadRun(void *bandPtr) {
+	struct dvs_noise_band *band    = bandPtr;
+	caerFilterDVSNoise noiseFilter = band->noiseFilter;
+
+	thrd_set_name("DVSNoiseFilter");
+
+	mtx_lock(&noiseFilter->bandsLock);
+
+	while (true) {
+		// Wait for a new packet to filter, or shutdown.
+		while (noiseFilter->bandsRun && (noiseFilter->bandsGeneration == band->generation)) {
+			cnd_wait(&noiseFilter->bandsStartCond, &noiseFilter->bandsLock);
 		}
-		if (pol) {
-			noiseFilter->backgroundActivityStatOn++;
+
+		if (!noiseFilter->bandsRun) {
+			break;
 		}
-		else {
-			noiseFilter->backgroundActivityStatOff++;
+
+		band->generation = noiseFilter->bandsGeneration;
+
+		caerPolarityEventPacket polarityPacket = noiseFilter->bandsPacket;
+		bool statisticsOnly                    = noiseFilter->bandsStatisticsOnly;
+
+		mtx_unlock(&noiseFilter->bandsLock);
+
+		filterDVSNoiseBandRun(noiseFilter, band, polarityPacket, statisticsOnly);
+
+		mtx_lock(&noiseFilter->bandsLock);
+
+		noiseFilter->bandsPending--;
+
+		if (noiseFilter->bandsPending == 0) {
+			cnd_signal(&noiseFilter->bandsDoneCond);
 		}
 	}
 
-WriteTimestamp:
-	// Update pixel timestamp (one write). Always update so filters are
-	// ready at enable-time right away.
-	noiseFilter->timestampsMap[pixelIndex] = SET_TSPOL(ts, pol);
-	CAER_POLARITY_ITERATOR_VALID_END
+	mtx_unlock(&noiseFilter->bandsLock);
+
+	return (EXIT_SUCCESS);
+}
+
+static bool filterDVSNoiseBandsStart(caerFilterDVSNoise noiseFilter, uint32_t threads) {
+	// Bands must be high enough for the halo rows, see BAND_ROWS_MIN.
+	size_t bandsNumber = threads;
+	if (bandsNumber > (size_t) (noiseFilter->sizeY / BAND_ROWS_MIN)) {
+		bandsNumber = (size_t) (noiseFilter->sizeY / BAND_ROWS_MIN);
+	}
+
+	// One band: filter serially on the calling thread.
+	if (bandsNumber <= 1) {
+		return (true);
+	}
+
+	noiseFilter->bands = calloc(bandsNumber, sizeof(struct dvs_noise_band));
+	if (noiseFilter->bands == NULL) {
+		filterDVSNoiseLog(CAER_LOG_ERROR, noiseFilter, "Parallel filtering: failed to allocate memory for bands.");
+		return (false);
+	}
+
+	noiseFilter->bandsNumber = bandsNumber;
+
+	size_t bandRows = noiseFilter->sizeY / bandsNumber;
+
+	for (size_t b = 0; b < bandsNumber; b++) {
+		struct dvs_noise_band *band = &noiseFilter->bands[b];
+
+		band->noiseFilter = noiseFilter;
+		band->rowStart    = b * bandRows;
+		band->rowEnd      = (b == (bandsNumber - 1)) ? (noiseFilter->sizeY) : ((b + 1) * bandRows);
+
+		band->haloAbove = malloc(BAND_HALO_ROWS_MAX * TS_MAP_STRIDE(noiseFilter->sizeX) * sizeof(int64_t));
+		band->haloBelow = malloc(BAND_HALO_ROWS_MAX * TS_MAP_STRIDE(noiseFilter->sizeX) * sizeof(int64_t));
+		band->rows      = malloc(BAND_ROWS_SPAN(band) * sizeof(void *));
+		if ((band->haloAbove == NULL) || (band->haloBelow == NULL) || (band->rows == NULL)) {
+			filterDVSNoiseLog(
+				CAER_LOG_ERROR, noiseFilter, "Parallel filtering: failed to allocate memory for band halo.");
+			filterDVSNoiseBandsFree(noiseFilter);
+			return (false);
+		}
+	}
+
+	if (mtx_init(&noiseFilter->bandsLock, mtx_plain) != thrd_success) {
+		filterDVSNoiseLog(CAER_LOG_ERROR, noiseFilter, "Parallel filtering: failed to initialize mutex.");
+		filterDVSNoiseBandsFree(noiseFilter);
+		return (false);
+	}
+
+	if (cnd_init(&noiseFilter->bandsStartCond) != thrd_success) {
+		filterDVSNoiseLog(CAER_LOG_ERROR, noiseFilter, "Parallel filtering: failed to initialize condition.");
+		mtx_destroy(&noiseFilter->bandsLock);
+		filterDVSNoiseBandsFree(noiseFilter);
+		return (false);
+	}
+
+	if (cnd_init(&noiseFilter->bandsDoneCond) != thrd_success) {
+		filterDVSNoiseLog(CAER_LOG_ERROR, noiseFilter, "Parallel filtering: failed to initialize condition.");
+		cnd_destroy(&noiseFilter->bandsStartCond);
+		mtx_destroy(&noiseFilter->bandsLock);
+		filterDVSNoiseBandsFree(noiseFilter);
+		return (false);
+	}
+
+	noiseFilter->bandsRun = true;
+
+	for (size_t b = 0; b < bandsNumber; b++) {
+		struct dvs_noise_band *band = &noiseFilter->bands[b];
+
+		band->generation = noiseFilter->bandsGeneration;
+
+		if ((errno = thrd_create(&band->thread, &filterDVSNoiseBandThreadRun, band)) != thrd_success) {
+			filterDVSNoiseLog(
+				CAER_LOG_ERROR, noiseFilter, "Parallel filtering: failed to create thread. Error: %d.", errno);
+			filterDVSNoiseBandsStop(noiseFilter);
+			return (false);
+		}
+
+		noiseFilter->bandsThreads++;
+	}
+
+	return (true);
+}
+
+static void filterDVSNoiseBandsStop(caerFilterDVSNoise noiseFilter) {
+	if (noiseFilter->bands == NULL) {
+		return;
+	}
+
+	mtx_lock(&noiseFilter->bandsLock);
+	noiseFilter->bandsRun = false;
+	cnd_broadcast(&noiseFilter->bandsStartCond);
+	mtx_unlock(&noiseFilter->bandsLock);
+
+	for (size_t b = 0; b < noiseFilter->bandsThreads; b++) {
+		if ((errno = thrd_join(noiseFilter->bands[b].thread, NULL)) != thrd_success) {
+			// This should never happen!
+			filterDVSNoiseLog(
+				CAER_LOG_CRITICAL, noiseFilter, "Parallel filtering: failed to join thread. Error: %d.", errno);
+		}
+	}
+
+	noiseFilter->bandsThreads = 0;
+
+	cnd_destroy(&noiseFilter->bandsDoneCond);
+	cnd_destroy(&noiseFilter->bandsStartCond);
+	mtx_destroy(&noiseFilter->bandsLock);
+
+	filterDVSNoiseBandsFree(noiseFilter);
+}
+
+static void filterDVSNoiseBandsFree(caerFilterDVSNoise noiseFilter) {
+	for (size_t b = 0; b < noiseFilter->bandsNumber; b++) {
+		free(noiseFilter->bands[b].haloAbove);
+		free(noiseFilter->bands[b].haloBelow);
+		free(noiseFilter->bands[b].rows);
+		free(noiseFilter->bands[b].events);
+	}
+
+	free(noiseFilter->bands);
+	noiseFilter->bands = NULL;
+
+	noiseFilter->bandsNumber         = 0;
+	noiseFilter->bandsEventsCapacity = 0;
 }
 
 bool caerFilterDVSNoiseConfigSet(caerFilterDVSNoise noiseFilter, uint8_t paramAddr, uint64_t param) {
 	switch (paramAddr) {
 		case CAER_FILTER_DVS_HOTPIXEL_LEARN:
+			// One-shot learning replaces all hot pixels, which would
+			// silently discard what continuous learning found so far.
+			if (param && (noiseFilter->hotPixelRates != NULL)) {
+				return (false);
+			}
+
 			noiseFilter->hotPixelLearn = param;
 			break;
 
@@ -436,11 +1081,31 @@ bool caerFilterDVSNoiseConfigSet(caerFilterDVSNoise noiseFilter, uint8_t paramAd
 			noiseFilter->hotPixelEnabled = param;
 			break;
 
+		case CAER_FILTER_DVS_HOTPIXEL_CONTINUOUS:
+			if (param && (noiseFilter->hotPixelRates == NULL)) {
+				// Wait for one-shot learning to complete first.
+				if (noiseFilter->hotPixelLearn || !hotPixelContinuousStart(noiseFilter)) {
+					return (false);
+				}
+			}
+			else if (!param && (noiseFilter->hotPixelRates != NULL)) {
+				hotPixelContinuousStop(noiseFilter);
+
+				// Back to the hot pixels from one-shot learning.
+				hotPixelMapGenerate(noiseFilter);
+			}
+			break;
+
 		case CAER_FILTER_DVS_BACKGROUND_ACTIVITY_ENABLE:
 			noiseFilter->backgroundActivityEnabled = param;
 			break;
 
 		case CAER_FILTER_DVS_BACKGROUND_ACTIVITY_TIME:
+			// The compact timestamps map can't represent longer times.
+			if (noiseFilter->timestampsCompact && (param >= U64T(TS_COMPACT_WINDOW))) {
+				return (false);
+			}
+
 			noiseFilter->backgroundActivityTime = U32T(param);
 			break;
 
@@ -465,6 +1130,11 @@ bool caerFilterDVSNoiseConfigSet(caerFilterDVSNoise noiseFilter, uint8_t paramAd
 			break;
 
 		case CAER_FILTER_DVS_REFRACTORY_PERIOD_TIME:
+			// The compact timestamps map can't represent longer times.
+			if (noiseFilter->timestampsCompact && (param >= U64T(TS_COMPACT_WINDOW))) {
+				return (false);
+			}
+
 			noiseFilter->refractoryPeriodTime = U32T(param);
 			break;
 
@@ -472,6 +1142,34 @@ bool caerFilterDVSNoiseConfigSet(caerFilterDVSNoise noiseFilter, uint8_t paramAd
 			noiseFilter->logLevel = U8T(param);
 			break;
 
+		case CAER_FILTER_DVS_PARALLEL_THREADS:
+			// Restart worker threads with the new configuration.
+			filterDVSNoiseBandsStop(noiseFilter);
+			noiseFilter->parallelThreads = 0;
+
+			if (!filterDVSNoiseBandsStart(noiseFilter, U32T(param))) {
+				return (false);
+			}
+
+			noiseFilter->parallelThreads = U32T(param);
+			break;
+
+		case CAER_FILTER_DVS_TIMESTAMPS_COMPACT:
+			// Convert the current map, so no timing information is lost.
+			if (param && !noiseFilter->timestampsCompact) {
+				// Both filter times must stay within the window kept by rebasing.
+				if ((U64T(noiseFilter->backgroundActivityTime) >= U64T(TS_COMPACT_WINDOW))
+					|| (U64T(noiseFilter->refractoryPeriodTime) >= U64T(TS_COMPACT_WINDOW))) {
+					return (false);
+				}
+
+				timestampsMapCompact(noiseFilter);
+			}
+			else if (!param && noiseFilter->timestampsCompact) {
+				timestampsMapExpand(noiseFilter);
+			}
+			break;
+
 		case CAER_FILTER_DVS_RESET:
 			if (param) {
 				// Reset hot pixel list and timestamp map.
@@ -481,8 +1179,19 @@ bool caerFilterDVSNoiseConfigSet(caerFilterDVSNoise noiseFilter, uint8_t paramAd
 					noiseFilter->hotPixelArray = NULL;
 				}
 
+				memset(noiseFilter->hotPixelMap, 0,
+					HOTPIXEL_MAP_SIZE((size_t) noiseFilter->sizeX * (size_t) noiseFilter->sizeY) * sizeof(uint64_t));
+
+				// Continuous learning starts over too.
+				if (noiseFilter->hotPixelRates != NULL) {
+					memset(noiseFilter->hotPixelRates, 0, (size_t) noiseFilter->sizeX * (size_t) noiseFilter->sizeY
+															  * sizeof(struct dvs_pixel_rate));
+					noiseFilter->hotPixelContinuousStarted = false;
+				}
+
 				memset(noiseFilter->timestampsMap, 0,
-					(size_t) noiseFilter->sizeX * (size_t) noiseFilter->sizeY * sizeof(int64_t));
+					TS_MAP_ENTRIES(noiseFilter->sizeX, noiseFilter->sizeY) * sizeof(int64_t));
+				noiseFilter->timestampsEpoch = 0;
 
 				// Reset statistics to zero
 				noiseFilter->hotPixelStatOn            = 0;
@@ -525,6 +1234,10 @@ bool caerFilterDVSNoiseConfigGet(caerFilterDVSNoise noiseFilter, uint8_t paramAd
 			*param = noiseFilter->hotPixelEnabled;
 			break;
 
+		case CAER_FILTER_DVS_HOTPIXEL_CONTINUOUS:
+			*param = (noiseFilter->hotPixelRates != NULL);
+			break;
+
 		case CAER_FILTER_DVS_HOTPIXEL_STATISTICS:
 			*param = (noiseFilter->hotPixelStatOn + noiseFilter->hotPixelStatOff);
 			break;
@@ -597,6 +1310,14 @@ bool caerFilterDVSNoiseConfigGet(caerFilterDVSNoise noiseFilter, uint8_t paramAd
 			*param = noiseFilter->logLevel;
 			break;
 
+		case CAER_FILTER_DVS_TIMESTAMPS_COMPACT:
+			*param = noiseFilter->timestampsCompact;
+			break;
+
+		case CAER_FILTER_DVS_PARALLEL_THREADS:
+			*param = noiseFilter->parallelThreads;
+			break;
+
 		default:
 			// Unrecognized or invalid parameter address.
 			return (false);
@@ -610,6 +1331,11 @@ bool caerFilterDVSNoiseConfigGet(caerFilterDVSNoise noiseFilter, uint8_t paramAd
 ssize_t caerFilterDVSNoiseGetHotPixels(caerFilterDVSNoise noiseFilter, caerFilterDVSPixel *hotPixels) {
 	*hotPixels = NULL;
 
+	// Continuous learning changes the hot pixels all the time, list the current ones.
+	if (noiseFilter->hotPixelRates != NULL) {
+		return (hotPixelContinuousGetHotPixels(noiseFilter, hotPixels));
+	}
+
 	// No hot pixels listed.
 	if (noiseFilter->hotPixelArraySize == 0) {
 		return (0);
@@ -654,6 +1380,8 @@ static void hotPixelGenerateArray(caerFilterDVSNoise noiseFilter) {
 
 	size_t pixelNumber = (size_t)(noiseFilter->sizeX * noiseFilter->sizeY);
 
+	memset(noiseFilter->hotPixelMap, 0, HOTPIXEL_MAP_SIZE(pixelNumber) * sizeof(uint64_t));
+
 	// Count number of hot pixels.
 	size_t hotPixelsNumber = 0;
 
@@ -698,5 +1426,216 @@ static void hotPixelGenerateArray(caerFilterDVSNoise noiseFilter) {
 	for (size_t i = 0; i < hotPixelsNumber; i++) {
 		noiseFilter->hotPixelArray[i].x = hotPixels[i].address.x;
 		noiseFilter->hotPixelArray[i].y = hotPixels[i].address.y;
+
+		HOTPIXEL_MAP_SET(noiseFilter->hotPixelMap,
+			((size_t) hotPixels[i].address.y * noiseFilter->sizeX) + hotPixels[i].address.x);
+	}
+}
+
+static void hotPixelMapGenerate(caerFilterDVSNoise noiseFilter) {
+	memset(noiseFilter->hotPixelMap, 0,
+		HOTPIXEL_MAP_SIZE((size_t) noiseFilter->sizeX * (size_t) noiseFilter->sizeY) * sizeof(uint64_t));
+
+	for (size_t i = 0; i < noiseFilter->hotPixelArraySize; i++) {
+		HOTPIXEL_MAP_SET(noiseFilter->hotPixelMap,
+			((size_t) noiseFilter->hotPixelArray[i].y * noiseFilter->sizeX) + noiseFilter->hotPixelArray[i].x);
+	}
+}
+
+// Move the compact timestamps map to a new epoch. Entries that don't fit
+// anymore are clamped: if older than the new epoch, they still are older
+// than any filter time limit, as long as those are below TS_COMPACT_WINDOW.
+static void timestampsMapRebase(caerFilterDVSNoise noiseFilter, int64_t newEpoch) {
+	uint32_t *compactMap = (uint32_t *) noiseFilter->timestampsMap;
+	size_t entriesNumber = TS_MAP_ENTRIES(noiseFilter->sizeX, noiseFilter->sizeY);
+	int64_t epochShift   = newEpoch - noiseFilter->timestampsEpoch;
+
+	for (size_t i = 0; i < entriesNumber; i++) {
+		int64_t relativeTS = GET_TS((int64_t) compactMap[i]) - epochShift;
+
+		if (relativeTS < 0) {
+			relativeTS = 0;
+		}
+		else if (relativeTS > TS_COMPACT_MAX) {
+			relativeTS = TS_COMPACT_MAX;
+		}
+
+		compactMap[i] = U32T(SET_TSPOL(relativeTS, GET_POL(compactMap[i])));
+	}
+
+	noiseFilter->timestampsEpoch = newEpoch;
+
+	filterDVSNoiseLog(CAER_LOG_DEBUG, noiseFilter, "Timestamps map: rebased to epoch %" PRIi64 ".", newEpoch);
+}
+
+static void timestampsMapCompact(caerFilterDVSNoise noiseFilter) {
+	uint32_t *compactMap = (uint32_t *) noiseFilter->timestampsMap;
+	size_t entriesNumber = TS_MAP_ENTRIES(noiseFilter->sizeX, noiseFilter->sizeY);
+
+	// Pick an epoch so that the newest timestamps fit.
+	int64_t maxTS = 0;
+
+	for (size_t i = 0; i < entriesNumber; i++) {
+		if (GET_TS(noiseFilter->timestampsMap[i]) > maxTS) {
+			maxTS = GET_TS(noiseFilter->timestampsMap[i]);
+		}
+	}
+
+	int64_t epoch = (maxTS > TS_COMPACT_MAX) ? (maxTS - TS_COMPACT_WINDOW) : (0);
+
+	// In place, front to back: entry i is read before any write can reach it.
+	for (size_t i = 0; i < entriesNumber; i++) {
+		int64_t relativeTS = GET_TS(noiseFilter->timestampsMap[i]) - epoch;
+
+		if (relativeTS < 0) {
+			relativeTS = 0;
+		}
+
+		compactMap[i] = U32T(SET_TSPOL(relativeTS, GET_POL(noiseFilter->timestampsMap[i])));
+	}
+
+	noiseFilter->timestampsEpoch   = epoch;
+	noiseFilter->timestampsCompact = true;
+}
+
+static void timestampsMapExpand(caerFilterDVSNoise noiseFilter) {
+	uint32_t *compactMap = (uint32_t *) noiseFilter->timestampsMap;
+	size_t entriesNumber = TS_MAP_ENTRIES(noiseFilter->sizeX, noiseFilter->sizeY);
+
+	// In place, back to front: entry i is read before any write can reach it.
+	for (size_t i = entriesNumber; i > 0; i--) {
+		noiseFilter->timestampsMap[i - 1] = (noiseFilter->timestampsEpoch << 1) + compactMap[i - 1];
+	}
+
+	noiseFilter->timestampsEpoch   = 0;
+	noiseFilter->timestampsCompact = false;
+}
+
+static bool hotPixelContinuousStart(caerFilterDVSNoise noiseFilter) {
+	noiseFilter->hotPixelRates
+		= calloc((size_t) noiseFilter->sizeX * (size_t) noiseFilter->sizeY, sizeof(struct dvs_pixel_rate));
+	noiseFilter->hotPixelSweepTimes = calloc(noiseFilter->sizeY, sizeof(int64_t));
+
+	if ((noiseFilter->hotPixelRates == NULL) || (noiseFilter->hotPixelSweepTimes == NULL)) {
+		filterDVSNoiseLog(
+			CAER_LOG_ERROR, noiseFilter, "HotPixel Continuous Learning: failed to allocate memory for rates.");
+		hotPixelContinuousStop(noiseFilter);
+		return (false);
+	}
+
+	noiseFilter->hotPixelContinuousStarted = false;
+	noiseFilter->hotPixelSweepRow          = 0;
+
+	return (true);
+}
+
+static void hotPixelContinuousStop(caerFilterDVSNoise noiseFilter) {
+	free(noiseFilter->hotPixelRates);
+	noiseFilter->hotPixelRates = NULL;
+
+	free(noiseFilter->hotPixelSweepTimes);
+	noiseFilter->hotPixelSweepTimes = NULL;
+}
+
+// Evaluate the rows whose window is over: update each pixel's decayed rate
+// from its count and the time since its last evaluation, then promote it
+// to hot pixel, or demote it, with some hysteresis. Rows are evaluated in
+// order, so the next one is always the one waiting the longest.
+static void hotPixelContinuousUpdate(caerFilterDVSNoise noiseFilter, int64_t ts) {
+	if (!noiseFilter->hotPixelContinuousStarted) {
+		// First packet: the first window starts now for all rows.
+		for (size_t row = 0; row < noiseFilter->sizeY; row++) {
+			noiseFilter->hotPixelSweepTimes[row] = ts;
+		}
+
+		noiseFilter->hotPixelContinuousStarted = true;
+		return;
+	}
+
+	uint64_t window      = noiseFilter->hotPixelTime;
+	uint32_t promoteRate = noiseFilter->hotPixelCount;
+	uint32_t demoteRate  = noiseFilter->hotPixelCount / 2;
+
+	for (size_t rows = 0; rows < HOTPIXEL_SWEEP_ROWS_MAX; rows++) {
+		size_t row      = noiseFilter->hotPixelSweepRow;
+		int64_t elapsed = ts - noiseFilter->hotPixelSweepTimes[row];
+
+		if ((elapsed <= 0) || ((uint64_t) elapsed < window)) {
+			break;
+		}
+
+		size_t pixelIndex = row * noiseFilter->sizeX;
+
+		for (size_t x = 0; x < noiseFilter->sizeX; x++, pixelIndex++) {
+			struct dvs_pixel_rate *pixel = &noiseFilter->hotPixelRates[pixelIndex];
+
+			// Events per window, halfway between the old estimate and the
+			// new sample, rounded up so that a steady rate is reached.
+			uint64_t sample = ((uint64_t) pixel->count * window) / (uint64_t) elapsed;
+			uint64_t rate   = ((uint64_t) pixel->rate + sample + 1) / 2;
+
+			pixel->rate  = (rate > UINT32_MAX) ? (UINT32_MAX) : (U32T(rate));
+			pixel->count = 0;
+
+			if (pixel->rate >= promoteRate) {
+				HOTPIXEL_MAP_SET(noiseFilter->hotPixelMap, pixelIndex);
+			}
+			else if (pixel->rate < demoteRate) {
+				HOTPIXEL_MAP_CLR(noiseFilter->hotPixelMap, pixelIndex);
+			}
+		}
+
+		noiseFilter->hotPixelSweepTimes[row] = ts;
+		noiseFilter->hotPixelSweepRow        = (row + 1) % noiseFilter->sizeY;
+	}
+}
+
+static ssize_t hotPixelContinuousGetHotPixels(caerFilterDVSNoise noiseFilter, caerFilterDVSPixel *hotPixels) {
+	size_t pixelNumber = (size_t) noiseFilter->sizeX * (size_t) noiseFilter->sizeY;
+
+	// Count number of hot pixels.
+	size_t hotPixelsNumber = 0;
+
+	for (size_t i = 0; i < pixelNumber; i++) {
+		hotPixelsNumber += HOTPIXEL_MAP_GET(noiseFilter->hotPixelMap, i);
+	}
+
+	// No hot pixels listed.
+	if (hotPixelsNumber == 0) {
+		return (0);
+	}
+
+	// Sort by rate, same order as after one-shot learning.
+	struct dvs_pixel_with_count *hotPixelsWithRate = malloc(hotPixelsNumber * sizeof(struct dvs_pixel_with_count));
+	if (hotPixelsWithRate == NULL) {
+		// Memory allocation failure.
+		return (-1);
 	}
+
+	size_t idx = 0;
+	for (size_t i = 0; i < pixelNumber; i++) {
+		if (HOTPIXEL_MAP_GET(noiseFilter->hotPixelMap, i)) {
+			hotPixelsWithRate[idx].address.x = U16T(i % noiseFilter->sizeX);
+			hotPixelsWithRate[idx].address.y = U16T(i / noiseFilter->sizeX);
+			hotPixelsWithRate[idx].count     = noiseFilter->hotPixelRates[i].rate;
+			idx++;
+		}
+	}
+
+	qsort(hotPixelsWithRate, hotPixelsNumber, sizeof(struct dvs_pixel_with_count), &hotPixelArrayCountCompare);
+
+	*hotPixels = malloc(hotPixelsNumber * sizeof(struct caer_filter_dvs_pixel));
+	if (*hotPixels == NULL) {
+		// Memory allocation failure.
+		free(hotPixelsWithRate);
+		return (-1);
+	}
+
+	for (size_t i = 0; i < hotPixelsNumber; i++) {
+		(*hotPixels)[i] = hotPixelsWithRate[i].address;
+	}
+
+	free(hotPixelsWithRate);
+
+	return ((ssize_t) hotPixelsNumber);
 }
@@ -0,0 +1,102 @@
+#ifndef LIBCAER_SRC_POLARITY_GROUP_H_
+#define LIBCAER_SRC_POLARITY_GROUP_H_
+
+#include "libcaer/libcaer.h"
+
+#include "libcaer/events/polarity.h"
+
+/**
+ * Group events: an 8 bit mask of active pixels, that all share the same
+ * polarity and timestamp, and whose addresses only differ by their index
+ * in the group. For each mask, the table holds the number of active pixels
+ * in bits 24-27, and their indexes, lowest first, 3 bits each from bit 0.
+ * Expansion then needs no per-pixel tests, and writes complete events in
+ * one go, instead of setting them up field by field.
+ */
+static const uint32_t polarityGroupTable[256] = {
+	0x00000000, 0x01000000, 0x01000001, 0x02000008, 0x01000002, 0x02000010, 0x02000011, 0x03000088,
+	0x01000003, 0x02000018, 0x02000019, 0x030000C8, 0x0200001A, 0x030000D0, 0x030000D1, 0x04000688,
+	0x01000004, 0x02000020, 0x02000021, 0x03000108, 0x02000022, 0x03000110, 0x03000111, 0x04000888,
+	0x02000023, 0x03000118, 0x03000119, 0x040008C8, 0x0300011A, 0x040008D0, 0x040008D1, 0x05004688,
+	0x01000005, 0x02000028, 0x02000029, 0x03000148, 0x0200002A, 0x03000150, 0x03000151, 0x04000A88,
+	0x0200002B, 0x03000158, 0x03000159, 0x04000AC8, 0x0300015A, 0x04000AD0, 0x04000AD1, 0x05005688,
+	0x0200002C, 0x03000160, 0x03000161, 0x04000B08, 0x03000162, 0x04000B10, 0x04000B11, 0x05005888,
+	0x03000163, 0x04000B18, 0x04000B19, 0x050058C8, 0x04000B1A, 0x050058D0, 0x050058D1, 0x0602C688,
+	0x01000006, 0x02000030, 0x02000031, 0x03000188, 0x02000032, 0x03000190, 0x03000191, 0x04000C88,
+	0x02000033, 0x03000198, 0x03000199, 0x04000CC8, 0x0300019A, 0x04000CD0, 0x04000CD1, 0x05006688,
+	0x02000034, 0x030001A0, 0x030001A1, 0x04000D08, 0x030001A2, 0x04000D10, 0x04000D11, 0x05006888,
+	0x030001A3, 0x04000D18, 0x04000D19, 0x050068C8, 0x04000D1A, 0x050068D0, 0x050068D1, 0x06034688,
+	0x02000035, 0x030001A8, 0x030001A9, 0x04000D48, 0x030001AA, 0x04000D50, 0x04000D51, 0x05006A88,
+	0x030001AB, 0x04000D58, 0x04000D59, 0x05006AC8, 0x04000D5A, 0x05006AD0, 0x05006AD1, 0x06035688,
+	0x030001AC, 0x04000D60, 0x04000D61, 0x05006B08, 0x04000D62, 0x05006B10, 0x05006B11, 0x06035888,
+	0x04000D63, 0x05006B18, 0x05006B19, 0x060358C8, 0x05006B1A, 0x060358D0, 0x060358D1, 0x071AC688,
+	0x01000007, 0x02000038, 0x02000039, 0x030001C8, 0x0200003A, 0x030001D0, 0x030001D1, 0x04000E88,
+	0x0200003B, 0x030001D8, 0x030001D9, 0x04000EC8, 0x030001DA, 0x04000ED0, 0x04000ED1, 0x05007688,
+	0x0200003C, 0x030001E0, 0x030001E1, 0x04000F08, 0x030001E2, 0x04000F10, 0x04000F11, 0x05007888,
+	0x030001E3, 0x04000F18, 0x04000F19, 0x050078C8, 0x04000F1A, 0x050078D0, 0x050078D1, 0x0603C688,
+	0x0200003D, 0x030001E8, 0x030001E9, 0x04000F48, 0x030001EA, 0x04000F50, 0x04000F51, 0x05007A88,
+	0x030001EB, 0x04000F58, 0x04000F59, 0x05007AC8, 0x04000F5A, 0x05007AD0, 0x05007AD1, 0x0603D688,
+	0x030001EC, 0x04000F60, 0x04000F61, 0x05007B08, 0x04000F62, 0x05007B10, 0x05007B11, 0x0603D888,
+	0x04000F63, 0x05007B18, 0x05007B19, 0x0603D8C8, 0x05007B1A, 0x0603D8D0, 0x0603D8D1, 0x071EC688,
+	0x0200003E, 0x030001F0, 0x030001F1, 0x04000F88, 0x030001F2, 0x04000F90, 0x04000F91, 0x05007C88,
+	0x030001F3, 0x04000F98, 0x04000F99, 0x05007CC8, 0x04000F9A, 0x05007CD0, 0x05007CD1, 0x0603E688,
+	0x030001F4, 0x04000FA0, 0x04000FA1, 0x05007D08, 0x04000FA2, 0x05007D10, 0x05007D11, 0x0603E888,
+	0x04000FA3, 0x05007D18, 0x05007D19, 0x0603E8C8, 0x05007D1A, 0x0603E8D0, 0x0603E8D1, 0x071F4688,
+	0x030001F5, 0x04000FA8, 0x04000FA9, 0x05007D48, 0x04000FAA, 0x05007D50, 0x05007D51, 0x0603EA88,
+	0x04000FAB, 0x05007D58, 0x05007D59, 0x0603EAC8, 0x05007D5A, 0x0603EAD0, 0x0603EAD1, 0x071F5688,
+	0x04000FAC, 0x05007D60, 0x05007D61, 0x0603EB08, 0x05007D62, 0x0603EB10, 0x0603EB11, 0x071F5888,
+	0x05007D63, 0x0603EB18, 0x0603EB19, 0x071F58C8, 0x0603EB1A, 0x071F58D0, 0x071F58D1, 0x08FAC688
+};
+
+/**
+ * Number of active pixels in a group.
+ *
+ * @param mask active pixels in the group.
+ *
+ * @return number of events the group expands to.
+ */
+static inline int32_t polarityGroupCount(uint8_t mask) {
+	return (I32T(polarityGroupTable[mask] >> 24));
+}
+
+/**
+ * Append all active pixels of a group to a polarity packet, as valid events.
+ * The caller must ensure there is space for at least polarityGroupCount(mask)
+ * more events; 8 is always enough.
+ *
+ * @param packet polarity packet to append to.
+ * @param mask active pixels in the group.
+ * @param eventData data word (valid mark, polarity and addresses) of the
+ *                  group's first pixel, the one at index 0.
+ * @param indexShift POLARITY_X_ADDR_SHIFT or POLARITY_Y_ADDR_SHIFT, to which
+ *                   address the index in the group is added.
+ * @param timestamp timestamp of all events.
+ * @param highestFirst append the pixels by decreasing index instead of
+ *                     increasing, to follow the device's readout order.
+ *
+ * @return number of events appended.
+ */
+static inline int32_t polarityGroupExpand(caerPolarityEventPacket packet, uint8_t mask, uint32_t eventData,
+	uint8_t indexShift, int32_t timestamp, bool highestFirst) {
+	uint32_t entry           = polarityGroupTable[mask];
+	int32_t count            = I32T(entry >> 24);
+	int32_t eventNumber      = caerEventPacketHeaderGetEventNumber(&packet->packetHeader);
+	caerPolarityEvent events = &packet->events[eventNumber];
+	int32_t timestampLE      = I32T(htole32(U32T(timestamp)));
+
+	for (int32_t i = 0; i < count; i++, entry >>= 3) {
+		caerPolarityEvent event = (highestFirst) ? (&events[count - 1 - i]) : (&events[i]);
+
+		event->data      = htole32(eventData + ((entry & 0x07) << indexShift));
+		event->timestamp = timestampLE;
+	}
+
+	// Same as caerPolarityEventValidate() on each event.
+	caerEventPacketHeaderSetEventNumber(&packet->packetHeader, eventNumber + count);
+	caerEventPacketHeaderSetEventValid(
+		&packet->packetHeader, caerEventPacketHeaderGetEventValid(&packet->packetHeader) + count);
+
+	return (count);
+}
+
+#endif /* LIBCAER_SRC_POLARITY_GROUP_H_ */
@@ -72,6 +72,50 @@ bool caerRingBufferPut(caerRingBuffer rBuf, void *elem) {
 	return (false);
 }
 
+size_t caerRingBufferPutMany(caerRingBuffer rBuf, void **elems, size_t elemsNumber) {
+	// Count how many contiguous places, starting at the current put position,
+	// are still free (NULL). We can fill at most that many in one go.
+	size_t freeNumber = 0;
+
+	while ((freeNumber < elemsNumber) && (freeNumber < rBuf->size)) {
+		if (elems[freeNumber] == NULL) {
+			// NULL elements are disallowed (used as place-holders).
+			// Critical error, should never happen -> exit!
+			exit(EXIT_FAILURE);
+		}
+
+		size_t pos = ((rBuf->putPos + freeNumber) & (rBuf->size - 1));
+
+		if (atomic_load_explicit(&rBuf->elements[pos], memory_order_acquire) != (uintptr_t) NULL) {
+			break;
+		}
+
+		freeNumber++;
+	}
+
+	if (freeNumber == 0) {
+		// Buffer is full.
+		return (0);
+	}
+
+	// Fill all places but the first one without any ordering constraints. The
+	// consumer always reads places in order, so it can only see these after it
+	// has seen the first one, which is published last with release semantics.
+	// This way N elements cost one publish instead of N.
+	for (size_t i = 1; i < freeNumber; i++) {
+		size_t pos = ((rBuf->putPos + i) & (rBuf->size - 1));
+
+		atomic_store_explicit(&rBuf->elements[pos], (uintptr_t) elems[i], memory_order_relaxed);
+	}
+
+	atomic_store_explicit(&rBuf->elements[rBuf->putPos], (uintptr_t) elems[0], memory_order_release);
+
+	// Increase local put pointer.
+	rBuf->putPos = ((rBuf->putPos + freeNumber) & (rBuf->size - 1));
+
+	return (freeNumber);
+}
+
 bool caerRingBufferFull(caerRingBuffer rBuf) {
 	void *curr = (void *) atomic_load_explicit(&rBuf->elements[rBuf->putPos], memory_order_acquire);
 
@@ -103,6 +147,47 @@ void *caerRingBufferGet(caerRingBuffer rBuf) {
 	return (NULL);
 }
 
+size_t caerRingBufferGetMany(caerRingBuffer rBuf, void **elems, size_t elemsNumber) {
+	size_t getNumber = 0;
+
+	// Collect all valid content, in order, up to the requested amount. Each
+	// place is read with acquire semantics, as it may be the first place of a
+	// batch published by caerRingBufferPutMany().
+	while ((getNumber < elemsNumber) && (getNumber < rBuf->size)) {
+		size_t pos = ((rBuf->getPos + getNumber) & (rBuf->size - 1));
+
+		void *curr = (void *) atomic_load_explicit(&rBuf->elements[pos], memory_order_acquire);
+		if (curr == NULL) {
+			break;
+		}
+
+		elems[getNumber] = curr;
+		getNumber++;
+	}
+
+	if (getNumber == 0) {
+		// Buffer is empty.
+		return (0);
+	}
+
+	// Reset all the places we got content from to NULL. The producer checks
+	// every place before reusing it, so only the last reset needs to be
+	// ordered, to release the whole batch of free places at once.
+	for (size_t i = 0; i < (getNumber - 1); i++) {
+		size_t pos = ((rBuf->getPos + i) & (rBuf->size - 1));
+
+		atomic_store_explicit(&rBuf->elements[pos], (uintptr_t) NULL, memory_order_relaxed);
+	}
+
+	size_t lastPos = ((rBuf->getPos + getNumber - 1) & (rBuf->size - 1));
+	atomic_store_explicit(&rBuf->elements[lastPos], (uintptr_t) NULL, memory_order_release);
+
+	// Increase local get pointer.
+	rBuf->getPos = ((rBuf->getPos + getNumber) & (rBuf->size - 1));
+
+	return (getNumber);
+}
+
 void *caerRingBufferLook(caerRingBuffer rBuf) {
 	void *curr = (void *) atomic_load_explicit(&rBuf->elements[rBuf->getPos], memory_order_acquire);
 
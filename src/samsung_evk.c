@@ -72,23 +72,6 @@ ssize_t samsungEVKFind(caerDeviceDiscoveryResult *discoveredDevices) {
 static inline void freeAllDataMemory(samsungEVKState state) {
 	dataExchangeDestroy(&state->dataExchange);
 
-	// Since the current event packets aren't necessarily
-	// already assigned to the current packet container, we
-	// free them separately from it.
-	if (state->currentPackets.polarity != NULL) {
-		free(&state->currentPackets.polarity->packetHeader);
-		state->currentPackets.polarity = NULL;
-
-		containerGenerationSetPacket(&state->container, POLARITY_EVENT, NULL);
-	}
-
-	if (state->currentPackets.special != NULL) {
-		free(&state->currentPackets.special->packetHeader);
-		state->currentPackets.special = NULL;
-
-		containerGenerationSetPacket(&state->container, SPECIAL_EVENT, NULL);
-	}
-
 	containerGenerationDestroy(&state->container);
 }
 
@@ -402,9 +385,18 @@ bool samsungEVKConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 			break;
 
 		case CAER_HOST_CONFIG_PACKETS:
+			if (U8T(paramAddr) == CAER_HOST_CONFIG_PACKETS_MAX_CONTAINER_LATENCY) {
+				// Wake up often enough to commit on time, even without new data.
+				usbSetDataIdleInterval(&state->usbState, param);
+			}
+
 			return (containerGenerationConfigSet(&state->container, U8T(paramAddr), param));
 			break;
 
+		case CAER_HOST_CONFIG_STATISTICS:
+			return (statisticsConfigSet(&state->dataExchange.statistics, U8T(paramAddr), param));
+			break;
+
 		case CAER_HOST_CONFIG_LOG:
 			switch (paramAddr) {
 				case CAER_HOST_CONFIG_LOG_LEVEL:
@@ -1119,6 +1111,10 @@ bool samsungEVKConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 			return (containerGenerationConfigGet(&state->container, paramAddr, param));
 			break;
 
+		case CAER_HOST_CONFIG_STATISTICS:
+			return (statisticsConfigGet(&state->dataExchange.statistics, paramAddr, param));
+			break;
+
 		case CAER_HOST_CONFIG_LOG:
 			switch (paramAddr) {
 				case CAER_HOST_CONFIG_LOG_LEVEL:
@@ -1845,29 +1841,24 @@ bool samsungEVKDataStart(caerDeviceHandle cdh, void (*dataNotifyIncrease)(void *
 		return (false);
 	}
 
-	// Allocate packets.
-	if (!containerGenerationAllocate(&state->container, SAMSUNG_EVK_EVENT_TYPES)) {
+	// Prepare container recycling pool.
+	if (!containerGenerationPoolInit(&state->container)) {
 		freeAllDataMemory(state);
 
-		samsungEVKLog(CAER_LOG_CRITICAL, handle, "Failed to allocate event packet container.");
+		samsungEVKLog(CAER_LOG_CRITICAL, handle, "Failed to initialize event packet container pool.");
 		return (false);
 	}
 
-	state->currentPackets.polarity
-		= caerPolarityEventPacketAllocate(SAMSUNG_EVK_POLARITY_DEFAULT_SIZE, I16T(handle->info.deviceID), 0);
-	if (state->currentPackets.polarity == NULL) {
-		freeAllDataMemory(state);
-
-		samsungEVKLog(CAER_LOG_CRITICAL, handle, "Failed to allocate polarity event packet.");
-		return (false);
-	}
+	// Allocate packets. Polarity events are reserved from an exact count instead.
+	containerGenerationPacketsInit(&state->container, SAMSUNG_EVK_EVENT_TYPES, I16T(handle->info.deviceID),
+		handle->info.deviceString, &state->deviceLogLevel);
+	containerGenerationPacketsAdd(&state->container, POLARITY_EVENT, POLARITY_EVENT, &state->currentPackets.polarity,
+		&state->currentPackets.polarityPosition, SAMSUNG_EVK_POLARITY_DEFAULT_SIZE, 0);
+	containerGenerationPacketsAdd(&state->container, SPECIAL_EVENT, SPECIAL_EVENT, &state->currentPackets.special,
+		&state->currentPackets.specialPosition, SAMSUNG_EVK_SPECIAL_DEFAULT_SIZE, 1);
 
-	state->currentPackets.special
-		= caerSpecialEventPacketAllocate(SAMSUNG_EVK_SPECIAL_DEFAULT_SIZE, I16T(handle->info.deviceID), 0);
-	if (state->currentPackets.special == NULL) {
+	if (!containerGenerationPacketsAllocate(&state->container, 0, 0)) {
 		freeAllDataMemory(state);
-
-		samsungEVKLog(CAER_LOG_CRITICAL, handle, "Failed to allocate special event packet.");
 		return (false);
 	}
 
@@ -1918,22 +1909,60 @@ caerEventPacketContainer samsungEVKDataGet(caerDeviceHandle cdh) {
 	return (dataExchangeGet(&state->dataExchange, &state->usbState.dataTransfersRun));
 }
 
-static inline bool ensureSpaceForEvents(
-	caerEventPacketHeader *packet, size_t position, size_t numEvents, samsungEVKHandle handle) {
-	if ((position + numEvents) <= (size_t) caerEventPacketHeaderGetEventCapacity(*packet)) {
-		return (true);
-	}
+size_t samsungEVKDataGetMany(caerDeviceHandle cdh, caerEventPacketContainer *containers, size_t containersNumber) {
+	samsungEVKHandle handle = (samsungEVKHandle) cdh;
+	samsungEVKState state   = &handle->state;
 
-	caerEventPacketHeader grownPacket
-		= caerEventPacketGrow(*packet, caerEventPacketHeaderGetEventCapacity(*packet) * 2);
-	if (grownPacket == NULL) {
-		samsungEVKLog(CAER_LOG_CRITICAL, handle, "Failed to grow event packet of type %d.",
-			caerEventPacketHeaderGetEventType(*packet));
-		return (false);
+	return (dataExchangeGetMany(&state->dataExchange, &state->usbState.dataTransfersRun, containers, containersNumber));
+}
+
+int samsungEVKDataGetFD(caerDeviceHandle cdh) {
+	samsungEVKHandle handle = (samsungEVKHandle) cdh;
+	samsungEVKState state   = &handle->state;
+
+	return (dataExchangeGetFD(&state->dataExchange));
+}
+
+void samsungEVKDataRecycle(caerDeviceHandle cdh, caerEventPacketContainer container) {
+	samsungEVKHandle handle = (samsungEVKHandle) cdh;
+	samsungEVKState state   = &handle->state;
+
+	containerGenerationRecycle(&state->container, container);
+}
+
+/**
+ * Upper bound on the polarity events a buffer can generate: the exact
+ * number of active pixels in all its SGROUP events.
+ */
+static size_t samsungEVKPolarityEventsBound(const uint8_t *buffer, size_t bufferSize) {
+	size_t events = 0;
+
+	for (size_t bufferPos = 0; bufferPos < bufferSize; bufferPos += 4) {
+		uint32_t event = be32toh(*((const uint32_t *) (&buffer[bufferPos])));
+
+		if ((event & 0x80000000) && !(event & 0x76000000)) {
+			events += (size_t) (polarityGroupCount(U8T(event >> 8)) + polarityGroupCount(U8T(event)));
+		}
 	}
 
-	*packet = grownPacket;
-	return (true);
+	return (events);
+}
+
+// Allocate missing packets, and reserve space for the rest of the buffer: one
+// special event per word, and the polarity events counted up front.
+static bool samsungEVKPacketsAllocate(samsungEVKHandle handle, size_t words, size_t polarityEvents) {
+	samsungEVKState state = &handle->state;
+
+	return (containerGenerationPacketsAllocate(&state->container, words, 0)
+			&& containerGenerationPacketReserve(&state->container, POLARITY_EVENT, polarityEvents));
+}
+
+// Commit all non-empty packets in a container, and then the container itself.
+static void samsungEVKContainerCommit(samsungEVKHandle handle, bool tsReset) {
+	samsungEVKState state = &handle->state;
+
+	containerGenerationPacketsCommit(&state->container, tsReset, 0, state->timestamps.current, &state->dataExchange,
+		&state->usbState.dataTransfersRun);
 }
 
 static void samsungEVKEventTranslator(void *vhd, const uint8_t *buffer, size_t bufferSize) {
@@ -1948,6 +1977,8 @@ static void samsungEVKEventTranslator(void *vhd, const uint8_t *buffer, size_t b
 		return;
 	}
 
+	statisticsAddBytes(&state->dataExchange.statistics, bufferSize);
+
 	// Truncate off any extra partial event.
 	if ((bufferSize & 0x03) != 0) {
 		samsungEVKLog(
@@ -1955,31 +1986,16 @@ static void samsungEVKEventTranslator(void *vhd, const uint8_t *buffer, size_t b
 		bufferSize &= ~((size_t) 0x03);
 	}
 
-	for (size_t bufferPos = 0; bufferPos < bufferSize; bufferPos += 4) {
-		// Allocate new packets for next iteration as needed.
-		if (!containerGenerationAllocate(&state->container, SAMSUNG_EVK_EVENT_TYPES)) {
-			samsungEVKLog(CAER_LOG_CRITICAL, handle, "Failed to allocate event packet container.");
-			return;
-		}
+	// Packets only go away on commit, so they're allocated once here, and then
+	// again only after commits, instead of being checked every event. The same
+	// goes for the polarity space, reserved for the rest of the buffer at once.
+	size_t polarityEventsLeft = samsungEVKPolarityEventsBound(buffer, bufferSize);
 
-		if (state->currentPackets.special == NULL) {
-			state->currentPackets.special
-				= caerSpecialEventPacketAllocate(SAMSUNG_EVK_SPECIAL_DEFAULT_SIZE, I16T(handle->info.deviceID), 0);
-			if (state->currentPackets.special == NULL) {
-				samsungEVKLog(CAER_LOG_CRITICAL, handle, "Failed to allocate special event packet.");
-				return;
-			}
-		}
-
-		if (state->currentPackets.polarity == NULL) {
-			state->currentPackets.polarity
-				= caerPolarityEventPacketAllocate(SAMSUNG_EVK_POLARITY_DEFAULT_SIZE, I16T(handle->info.deviceID), 0);
-			if (state->currentPackets.polarity == NULL) {
-				samsungEVKLog(CAER_LOG_CRITICAL, handle, "Failed to allocate polarity event packet.");
-				return;
-			}
-		}
+	if ((bufferSize > 0) && !samsungEVKPacketsAllocate(handle, bufferSize / 4, polarityEventsLeft)) {
+		return;
+	}
 
+	for (size_t bufferPos = 0; bufferPos < bufferSize; bufferPos += 4) {
 		bool tsReset   = false;
 		bool tsBigWrap = false;
 
@@ -2002,31 +2018,21 @@ static void samsungEVKEventTranslator(void *vhd, const uint8_t *buffer, size_t b
 
 				groupAddr *= 8; // 8 pixels per group.
 
-				// 8-pixel group, two polarities, up to 16 events can be generated.
-				if (ensureSpaceForEvents((caerEventPacketHeader *) &state->currentPackets.polarity,
-						(size_t) state->currentPackets.polarityPosition, 16, handle)) {
-					for (uint16_t i = 0, mask = 0x8000; i < 16; i++, mask >>= 1) {
-						// Check if event present first.
-						if ((event & mask) == 0) {
-							continue;
-						}
-
-						bool polarity   = (i >= 8);
-						uint16_t offset = 7 - (i & 0x07);
-
-						// Received event!
-						caerPolarityEvent currentPolarityEvent = caerPolarityEventPacketGetEvent(
-							state->currentPackets.polarity, state->currentPackets.polarityPosition);
-
-						// Timestamp at event-stream insertion point.
-						caerPolarityEventSetTimestamp(currentPolarityEvent, state->timestamps.current);
-						caerPolarityEventSetPolarity(currentPolarityEvent, polarity);
-						caerPolarityEventSetX(currentPolarityEvent, state->dvs.lastX);
-						caerPolarityEventSetY(currentPolarityEvent, groupAddr + offset);
-						caerPolarityEventValidate(currentPolarityEvent, state->currentPackets.polarity);
-						state->currentPackets.polarityPosition++;
-					}
-				}
+				// 8-pixel group, two polarities, up to 16 events can be generated. Space for
+				// them was reserved at the start of the buffer. OFF events are in the upper
+				// byte, ON events in the lower one, both read out from the highest pixel.
+				// Timestamp at event-stream insertion point.
+				uint32_t offData = (U32T(state->dvs.lastX) << POLARITY_X_ADDR_SHIFT)
+								 | (U32T(groupAddr) << POLARITY_Y_ADDR_SHIFT) | (U32T(1) << VALID_MARK_SHIFT);
+				uint32_t onData  = offData | (U32T(1) << POLARITY_SHIFT);
+
+				int32_t events = polarityGroupExpand(state->currentPackets.polarity, U8T(event >> 8), offData,
+					POLARITY_Y_ADDR_SHIFT, state->timestamps.current, true);
+				events += polarityGroupExpand(state->currentPackets.polarity, U8T(event), onData,
+					POLARITY_Y_ADDR_SHIFT, state->timestamps.current, true);
+
+				state->currentPackets.polarityPosition += events;
+				polarityEventsLeft -= (size_t) events;
 			}
 		}
 		else {
@@ -2065,15 +2071,12 @@ static void samsungEVKEventTranslator(void *vhd, const uint8_t *buffer, size_t b
 				if (startOfFrame) {
 					samsungEVKLog(CAER_LOG_DEBUG, handle, "Start of Frame column marker detected.");
 
-					if (ensureSpaceForEvents((caerEventPacketHeader *) &state->currentPackets.special,
-							(size_t) state->currentPackets.specialPosition, 1, handle)) {
-						caerSpecialEvent currentSpecialEvent = caerSpecialEventPacketGetEvent(
-							state->currentPackets.special, state->currentPackets.specialPosition);
-						caerSpecialEventSetTimestamp(currentSpecialEvent, state->timestamps.current);
-						caerSpecialEventSetType(currentSpecialEvent, EVENT_READOUT_START);
-						caerSpecialEventValidate(currentSpecialEvent, state->currentPackets.special);
-						state->currentPackets.specialPosition++;
-					}
+					caerSpecialEvent currentSpecialEvent = caerSpecialEventPacketGetEvent(
+						state->currentPackets.special, state->currentPackets.specialPosition);
+					caerSpecialEventSetTimestamp(currentSpecialEvent, state->timestamps.current);
+					caerSpecialEventSetType(currentSpecialEvent, EVENT_READOUT_START);
+					caerSpecialEventValidate(currentSpecialEvent, state->currentPackets.special);
+					state->currentPackets.specialPosition++;
 				}
 			}
 
@@ -2102,33 +2105,20 @@ static void samsungEVKEventTranslator(void *vhd, const uint8_t *buffer, size_t b
 		// Commit packet containers to the ring-buffer, so they can be processed by the
 		// main-loop, when any of the required conditions are met.
 		if (tsReset || tsBigWrap || containerSizeCommit || containerTimeCommit) {
-			// One or more of the commit triggers are hit. Set the packet container up to contain
-			// any non-empty packets. Empty packets are not forwarded to save memory.
-			bool emptyContainerCommit = true;
-
-			if (state->currentPackets.polarityPosition > 0) {
-				containerGenerationSetPacket(
-					&state->container, POLARITY_EVENT, (caerEventPacketHeader) state->currentPackets.polarity);
-
-				state->currentPackets.polarity         = NULL;
-				state->currentPackets.polarityPosition = 0;
-				emptyContainerCommit                   = false;
-			}
-
-			if (state->currentPackets.specialPosition > 0) {
-				containerGenerationSetPacket(
-					&state->container, SPECIAL_EVENT, (caerEventPacketHeader) state->currentPackets.special);
+			samsungEVKContainerCommit(handle, tsReset);
 
-				state->currentPackets.special         = NULL;
-				state->currentPackets.specialPosition = 0;
-				emptyContainerCommit                  = false;
+			// Allocate new packets for the rest of the buffer.
+			if (((bufferPos + 4) < bufferSize)
+				&& !samsungEVKPacketsAllocate(handle, (bufferSize - (bufferPos + 4)) / 4, polarityEventsLeft)) {
+				return;
 			}
-
-			containerGenerationExecute(&state->container, emptyContainerCommit, tsReset, 0, state->timestamps.current,
-				&state->dataExchange, &state->usbState.dataTransfersRun, handle->info.deviceID,
-				handle->info.deviceString, &state->deviceLogLevel);
 		}
 	}
+
+	// Commit a container pending for too long, also when called without data (device idle).
+	if (containerGenerationIsLatencyElapsed(&state->container)) {
+		samsungEVKContainerCommit(handle, false);
+	}
 }
 
 static bool i2cConfigSend(usbState state, uint16_t deviceAddr, uint16_t byteAddr, uint8_t param) {
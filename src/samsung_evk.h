@@ -6,6 +6,7 @@
 
 #include "container_generation.h"
 #include "data_exchange.h"
+#include "polarity_group.h"
 #include "usb_utils.h"
 
 #define SAMSUNG_EVK_EVENT_TYPES 2
@@ -164,5 +165,8 @@ bool samsungEVKDataStart(caerDeviceHandle handle, void (*dataNotifyIncrease)(voi
 	void *dataShutdownUserPtr);
 bool samsungEVKDataStop(caerDeviceHandle handle);
 caerEventPacketContainer samsungEVKDataGet(caerDeviceHandle handle);
+size_t samsungEVKDataGetMany(caerDeviceHandle handle, caerEventPacketContainer *containers, size_t containersNumber);
+int samsungEVKDataGetFD(caerDeviceHandle handle);
+void samsungEVKDataRecycle(caerDeviceHandle handle, caerEventPacketContainer container);
 
 #endif /* LIBCAER_SRC_SAMSUNG_EVK_H_ */
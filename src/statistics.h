@@ -0,0 +1,146 @@
+#ifndef LIBCAER_SRC_STATISTICS_H_
+#define LIBCAER_SRC_STATISTICS_H_
+
+#include "libcaer/libcaer.h"
+
+#include "libcaer/devices/device.h"
+
+#include <stdatomic.h>
+
+/**
+ * Host-side data path statistics. All counters are only ever written by the
+ * data acquisition thread, with relaxed atomics, so they are cheap enough to
+ * always be kept up to date, and can be read at any time from other threads.
+ */
+struct host_statistics {
+	atomic_uint_fast64_t bytesReceived;
+	atomic_uint_fast64_t eventsDecoded[CAER_DEFAULT_EVENT_TYPES_COUNT];
+	atomic_uint_fast64_t containersCommitted;
+	atomic_uint_fast64_t containersDropped;
+	atomic_uint_fast32_t bufferHighWater;
+	atomic_int_fast64_t lastCommitTimestamp;
+};
+
+typedef struct host_statistics *hostStatistics;
+
+static inline void statisticsReset(hostStatistics state) {
+	atomic_store(&state->bytesReceived, 0);
+
+	for (size_t i = 0; i < CAER_DEFAULT_EVENT_TYPES_COUNT; i++) {
+		atomic_store(&state->eventsDecoded[i], 0);
+	}
+
+	atomic_store(&state->containersCommitted, 0);
+	atomic_store(&state->containersDropped, 0);
+	atomic_store(&state->bufferHighWater, 0);
+	atomic_store(&state->lastCommitTimestamp, -1);
+}
+
+static inline void statisticsAddBytes(hostStatistics state, size_t bytes) {
+	atomic_fetch_add_explicit(&state->bytesReceived, bytes, memory_order_relaxed);
+}
+
+/**
+ * Count the events of a container, by type. Done once per container, at commit
+ * time, instead of once per event inside the translators.
+ */
+static inline void statisticsAddEvents(hostStatistics state, caerEventPacketContainer container) {
+	CAER_EVENT_PACKET_CONTAINER_ITERATOR_START(container)
+	int16_t type = caerEventPacketHeaderGetEventType(caerEventPacketContainerIteratorElement);
+
+	if ((type >= 0) && (type < CAER_DEFAULT_EVENT_TYPES_COUNT)) {
+		atomic_fetch_add_explicit(&state->eventsDecoded[type],
+			U64T(caerEventPacketHeaderGetEventNumber(caerEventPacketContainerIteratorElement)), memory_order_relaxed);
+	}
+	CAER_EVENT_PACKET_CONTAINER_ITERATOR_END
+}
+
+static inline void statisticsContainerCommitted(hostStatistics state, int64_t commitTimestamp, uint32_t bufferUsage) {
+	atomic_fetch_add_explicit(&state->containersCommitted, 1, memory_order_relaxed);
+
+	if (commitTimestamp >= 0) {
+		atomic_store_explicit(&state->lastCommitTimestamp, commitTimestamp, memory_order_relaxed);
+	}
+
+	// Only written from here, no need for compare-and-swap.
+	if (bufferUsage > atomic_load_explicit(&state->bufferHighWater, memory_order_relaxed)) {
+		atomic_store_explicit(&state->bufferHighWater, bufferUsage, memory_order_relaxed);
+	}
+}
+
+static inline void statisticsContainerDropped(hostStatistics state) {
+	atomic_fetch_add_explicit(&state->containersDropped, 1, memory_order_relaxed);
+}
+
+static inline bool statisticsConfigSet(hostStatistics state, uint8_t paramAddr, uint32_t param) {
+	switch (paramAddr) {
+		case CAER_HOST_CONFIG_STATISTICS_RESET:
+			if (param) {
+				statisticsReset(state);
+			}
+			break;
+
+		default:
+			return (false);
+			break;
+	}
+
+	return (true);
+}
+
+static inline bool statisticsConfigGet(hostStatistics state, uint8_t paramAddr, uint32_t *param) {
+	// 64 bit values are split over two addresses, upper 32 bits first,
+	// so that they can be read with caerDeviceConfigGet64().
+	uint64_t value = 0;
+
+	switch (paramAddr) {
+		case CAER_HOST_CONFIG_STATISTICS_RESET:
+			// Always false because it's an impulse, it resets itself automatically.
+			*param = false;
+			return (true);
+			break;
+
+		case CAER_HOST_CONFIG_STATISTICS_BYTES_RECEIVED:
+		case CAER_HOST_CONFIG_STATISTICS_BYTES_RECEIVED + 1:
+			value = U64T(atomic_load_explicit(&state->bytesReceived, memory_order_relaxed));
+			break;
+
+		case CAER_HOST_CONFIG_STATISTICS_CONTAINERS_COMMITTED:
+		case CAER_HOST_CONFIG_STATISTICS_CONTAINERS_COMMITTED + 1:
+			value = U64T(atomic_load_explicit(&state->containersCommitted, memory_order_relaxed));
+			break;
+
+		case CAER_HOST_CONFIG_STATISTICS_CONTAINERS_DROPPED:
+		case CAER_HOST_CONFIG_STATISTICS_CONTAINERS_DROPPED + 1:
+			value = U64T(atomic_load_explicit(&state->containersDropped, memory_order_relaxed));
+			break;
+
+		case CAER_HOST_CONFIG_STATISTICS_BUFFER_HIGH_WATER:
+			*param = U32T(atomic_load_explicit(&state->bufferHighWater, memory_order_relaxed));
+			return (true);
+			break;
+
+		case CAER_HOST_CONFIG_STATISTICS_LAST_COMMIT_TIMESTAMP:
+		case CAER_HOST_CONFIG_STATISTICS_LAST_COMMIT_TIMESTAMP + 1:
+			value = U64T(atomic_load_explicit(&state->lastCommitTimestamp, memory_order_relaxed));
+			break;
+
+		default:
+			if ((paramAddr >= CAER_HOST_CONFIG_STATISTICS_EVENTS)
+				&& (paramAddr < (CAER_HOST_CONFIG_STATISTICS_EVENTS + (2 * CAER_DEFAULT_EVENT_TYPES_COUNT)))) {
+				size_t type = (size_t) (paramAddr - CAER_HOST_CONFIG_STATISTICS_EVENTS) / 2;
+				value       = U64T(atomic_load_explicit(&state->eventsDecoded[type], memory_order_relaxed));
+				break;
+			}
+
+			return (false);
+			break;
+	}
+
+	// All 64 bit values start at even addresses.
+	*param = ((paramAddr & 0x01) == 0) ? (U32T(value >> 32)) : (U32T(value));
+
+	return (true);
+}
+
+#endif /* LIBCAER_SRC_STATISTICS_H_ */
@@ -0,0 +1,630 @@
+#include "usb_capture.h"
+
+#include "portable_time.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+
+_Static_assert(sizeof(struct usb_capture_record) == 24, "usb_capture_record must have no padding.");
+
+// Replay pacing: longest sleep before checking for shutdown again (10 ms).
+#define USB_REPLAY_SLEEP_SLICE 10000000LL
+
+struct usb_capture {
+	FILE *file;
+	struct timespec startTime;
+	bool failed;
+};
+
+struct usb_replay_control {
+	uint8_t bRequest;
+	uint16_t wValue;
+	uint16_t wIndex;
+	size_t dataSize;
+	uint8_t *data;
+	bool used;
+};
+
+struct usb_replay {
+	FILE *file;
+	long dataOffset;
+	bool realTime;
+	mtx_t controlsLock;
+	struct usb_replay_control *controls;
+	size_t controlsLength;
+	thrd_t thread;
+	atomic_bool threadRun;
+	bool threadActive; // TRANSFERS LOCK PROTECTED.
+	uint8_t *buffer;
+	size_t bufferSize;
+};
+
+static once_flag usbCaptureInitFlag = ONCE_FLAG_INIT;
+static mtx_t usbCaptureSettingsLock;
+static char *usbCapturePath    = NULL;  // SETTINGS LOCK PROTECTED.
+static char *usbReplayPath     = NULL;  // SETTINGS LOCK PROTECTED.
+static bool usbReplayRealTime  = true;  // SETTINGS LOCK PROTECTED.
+static bool usbCaptureSettings = false; // SETTINGS LOCK PROTECTED.
+
+static void usbCaptureLog(enum caer_log_level logLevel, usbState state, const char *format, ...) ATTRIBUTE_FORMAT(3);
+static int usbReplayThreadRun(void *usbStatePtr);
+
+static void usbCaptureLog(enum caer_log_level logLevel, usbState state, const char *format, ...) {
+	// Only log messages above the specified severity level.
+	uint8_t systemLogLevel = atomic_load_explicit(&state->usbLogLevel, memory_order_relaxed);
+
+	if (logLevel > systemLogLevel) {
+		return;
+	}
+
+	va_list argumentList;
+	va_start(argumentList, format);
+	caerLogVAFull(systemLogLevel, logLevel, state->usbThreadName, format, argumentList);
+	va_end(argumentList);
+}
+
+static void usbCaptureInit(void) {
+	mtx_init(&usbCaptureSettingsLock, mtx_plain);
+}
+
+static char *usbCaptureStringCopy(const char *str) {
+	if ((str == NULL) || caerStrEquals(str, "")) {
+		return (NULL);
+	}
+
+	size_t length = strlen(str);
+
+	char *copy = malloc(length + 1);
+	if (copy == NULL) {
+		return (NULL);
+	}
+
+	memcpy(copy, str, length + 1);
+
+	return (copy);
+}
+
+// Settings from the API take precedence, else the environment is used,
+// so that existing applications can capture and replay unchanged.
+static char *usbCaptureGetPath(bool replay, bool *realTime) {
+	call_once(&usbCaptureInitFlag, &usbCaptureInit);
+
+	mtx_lock(&usbCaptureSettingsLock);
+
+	char *path = NULL;
+
+	if (usbCaptureSettings) {
+		path = usbCaptureStringCopy((replay) ? (usbReplayPath) : (usbCapturePath));
+
+		if (realTime != NULL) {
+			*realTime = usbReplayRealTime;
+		}
+	}
+	else {
+		path = usbCaptureStringCopy(getenv((replay) ? ("CAER_USB_REPLAY") : ("CAER_USB_CAPTURE")));
+
+		if (realTime != NULL) {
+			const char *fast = getenv("CAER_USB_REPLAY_FAST");
+			*realTime        = ((fast == NULL) || caerStrEquals(fast, "") || caerStrEquals(fast, "0"));
+		}
+	}
+
+	mtx_unlock(&usbCaptureSettingsLock);
+
+	return (path);
+}
+
+static void usbCaptureWriteRecord(usbState state, const struct usb_capture_record *record, const void *payload) {
+	struct usb_capture *capture = state->capture;
+
+	if (capture->failed) {
+		return;
+	}
+
+	if ((fwrite(record, sizeof(struct usb_capture_record), 1, capture->file) != 1)
+		|| ((record->length > 0) && (fwrite(payload, record->length, 1, capture->file) != 1))) {
+		// Stop trying on first error, the file is incomplete anyway.
+		capture->failed = true;
+
+		usbCaptureLog(CAER_LOG_ERROR, state, "Failed to write to USB capture file, capture stopped.");
+	}
+}
+
+void usbCaptureOpen(usbState state, uint16_t devVID, uint16_t devPID, const struct usb_info *deviceUSBInfo) {
+	char *path = usbCaptureGetPath(false, NULL);
+	if (path == NULL) {
+		return;
+	}
+
+	struct usb_capture *capture = calloc(1, sizeof(struct usb_capture));
+	if (capture == NULL) {
+		usbCaptureLog(CAER_LOG_ERROR, state, "Failed to allocate memory for USB capture.");
+		free(path);
+		return;
+	}
+
+	capture->file = fopen(path, "wb");
+	if (capture->file == NULL) {
+		usbCaptureLog(CAER_LOG_ERROR, state, "Failed to open USB capture file '%s'. Error: %d.", path, errno);
+		free(capture);
+		free(path);
+		return;
+	}
+
+	portable_clock_gettime_monotonic(&capture->startTime);
+
+	state->capture = capture;
+
+	struct usb_capture_info info = {0};
+	info.devVID                  = devVID;
+	info.devPID                  = devPID;
+	info.firmwareVersion         = deviceUSBInfo->firmwareVersion;
+	info.logicVersion            = deviceUSBInfo->logicVersion;
+	info.busNumber               = deviceUSBInfo->busNumber;
+	info.devAddress              = deviceUSBInfo->devAddress;
+	memcpy(info.serialNumber, deviceUSBInfo->serialNumber, MAX_SERIAL_NUMBER_LENGTH + 1);
+
+	struct usb_capture_record record = {0};
+	record.type                      = USB_CAPTURE_INFO;
+	record.length                    = sizeof(struct usb_capture_info);
+
+	if (fwrite(USB_CAPTURE_MAGIC, USB_CAPTURE_MAGIC_LENGTH, 1, capture->file) != 1) {
+		capture->failed = true;
+	}
+
+	usbCaptureWriteRecord(state, &record, &info);
+
+	usbCaptureLog(CAER_LOG_INFO, state, "Capturing raw USB data to '%s'.", path);
+
+	free(path);
+}
+
+void usbCaptureClose(usbState state) {
+	if (state->capture == NULL) {
+		return;
+	}
+
+	fclose(state->capture->file);
+
+	free(state->capture);
+	state->capture = NULL;
+}
+
+// Called from the USB thread only, like usbCaptureData().
+void usbCaptureControlIn(
+	usbState state, uint8_t bRequest, uint16_t wValue, uint16_t wIndex, const uint8_t *data, size_t dataSize) {
+	struct usb_capture_record record = {0};
+	record.type                      = USB_CAPTURE_CONTROL_IN;
+	record.bRequest                  = bRequest;
+	record.wValue                    = wValue;
+	record.wIndex                    = wIndex;
+	record.length                    = U32T(dataSize);
+
+	usbCaptureWriteRecord(state, &record, data);
+}
+
+void usbCaptureData(usbState state, const uint8_t *data, size_t dataSize) {
+	struct timespec now;
+	portable_clock_gettime_monotonic(&now);
+
+	const struct timespec *start = &state->capture->startTime;
+	int64_t timestamp
+		= (I64T(now.tv_sec - start->tv_sec) * 1000000000LL) + I64T(now.tv_nsec - start->tv_nsec);
+
+	struct usb_capture_record record = {0};
+	record.type                      = USB_CAPTURE_DATA;
+	record.length                    = U32T(dataSize);
+	record.timestamp                 = U64T(timestamp);
+
+	usbCaptureWriteRecord(state, &record, data);
+}
+
+bool usbReplayEnabled(void) {
+	char *path = usbCaptureGetPath(true, NULL);
+
+	bool enabled = (path != NULL);
+
+	free(path);
+
+	return (enabled);
+}
+
+static void usbReplayFree(struct usb_replay *replay) {
+	for (size_t i = 0; i < replay->controlsLength; i++) {
+		free(replay->controls[i].data);
+	}
+
+	free(replay->controls);
+	free(replay->buffer);
+
+	if (replay->file != NULL) {
+		fclose(replay->file);
+	}
+
+	free(replay);
+}
+
+static bool usbReplayAddControl(struct usb_replay *replay, const struct usb_capture_record *record, uint8_t *data) {
+	struct usb_replay_control *controls
+		= realloc(replay->controls, (replay->controlsLength + 1) * sizeof(struct usb_replay_control));
+	if (controls == NULL) {
+		return (false);
+	}
+
+	replay->controls = controls;
+
+	struct usb_replay_control *control = &replay->controls[replay->controlsLength];
+	control->bRequest                  = record->bRequest;
+	control->wValue                    = record->wValue;
+	control->wIndex                    = record->wIndex;
+	control->dataSize                  = record->length;
+	control->data                      = data;
+	control->used                      = false;
+
+	replay->controlsLength++;
+
+	return (true);
+}
+
+bool usbReplayOpen(usbState state, uint16_t devVID, uint16_t devPID, struct usb_info *deviceUSBInfo) {
+	bool realTime = true;
+
+	char *path = usbCaptureGetPath(true, &realTime);
+	if (path == NULL) {
+		errno = CAER_ERROR_OPEN_ACCESS;
+		return (false);
+	}
+
+	struct usb_replay *replay = calloc(1, sizeof(struct usb_replay));
+	if (replay == NULL) {
+		usbCaptureLog(CAER_LOG_CRITICAL, state, "Failed to allocate memory for USB replay.");
+		free(path);
+		errno = CAER_ERROR_RESOURCE_ALLOCATION;
+		return (false);
+	}
+
+	replay->realTime = realTime;
+
+	replay->file = fopen(path, "rb");
+	if (replay->file == NULL) {
+		usbCaptureLog(CAER_LOG_CRITICAL, state, "Failed to open USB replay file '%s'. Error: %d.", path, errno);
+		usbReplayFree(replay);
+		free(path);
+		errno = CAER_ERROR_OPEN_ACCESS;
+		return (false);
+	}
+
+	char magic[USB_CAPTURE_MAGIC_LENGTH];
+	if ((fread(magic, USB_CAPTURE_MAGIC_LENGTH, 1, replay->file) != 1)
+		|| (memcmp(magic, USB_CAPTURE_MAGIC, USB_CAPTURE_MAGIC_LENGTH) != 0)) {
+		usbCaptureLog(CAER_LOG_CRITICAL, state, "File '%s' is not a USB capture file.", path);
+		usbReplayFree(replay);
+		free(path);
+		errno = CAER_ERROR_OPEN_ACCESS;
+		return (false);
+	}
+
+	replay->dataOffset = ftell(replay->file);
+
+	// Load device information and all control replies, skip data for now.
+	struct usb_capture_info info;
+	bool infoFound = false;
+
+	struct usb_capture_record record;
+
+	while (fread(&record, sizeof(struct usb_capture_record), 1, replay->file) == 1) {
+		if ((record.type == USB_CAPTURE_INFO) && (record.length == sizeof(struct usb_capture_info))) {
+			if (fread(&info, sizeof(struct usb_capture_info), 1, replay->file) != 1) {
+				break;
+			}
+
+			infoFound = true;
+		}
+		else if (record.type == USB_CAPTURE_CONTROL_IN) {
+			uint8_t *data = malloc((record.length > 0) ? (record.length) : (1));
+			if ((data == NULL) || ((record.length > 0) && (fread(data, record.length, 1, replay->file) != 1))
+				|| !usbReplayAddControl(replay, &record, data)) {
+				free(data);
+				break;
+			}
+		}
+		else if (fseek(replay->file, (long) record.length, SEEK_CUR) != 0) {
+			break;
+		}
+	}
+
+	if (!infoFound || (info.devVID != devVID) || (info.devPID != devPID)) {
+		usbCaptureLog(CAER_LOG_DEBUG, state, "USB replay file '%s' doesn't match device %04" PRIX16 ":%04" PRIX16 ".",
+			path, devVID, devPID);
+		usbReplayFree(replay);
+		free(path);
+		errno = CAER_ERROR_OPEN_ACCESS;
+		return (false);
+	}
+
+	if (mtx_init(&replay->controlsLock, mtx_plain) != thrd_success) {
+		usbCaptureLog(CAER_LOG_CRITICAL, state, "Failed to initialize USB replay mutex.");
+		usbReplayFree(replay);
+		free(path);
+		errno = CAER_ERROR_RESOURCE_ALLOCATION;
+		return (false);
+	}
+
+	memset(deviceUSBInfo, 0, sizeof(struct usb_info));
+	deviceUSBInfo->busNumber       = info.busNumber;
+	deviceUSBInfo->devAddress      = info.devAddress;
+	deviceUSBInfo->firmwareVersion = info.firmwareVersion;
+	deviceUSBInfo->logicVersion    = info.logicVersion;
+	memcpy(deviceUSBInfo->serialNumber, info.serialNumber, MAX_SERIAL_NUMBER_LENGTH);
+	deviceUSBInfo->serialNumber[MAX_SERIAL_NUMBER_LENGTH] = '\0';
+
+	state->replay = replay;
+
+	usbCaptureLog(CAER_LOG_INFO, state, "Replaying raw USB data from '%s' (%s).", path,
+		(realTime) ? ("recorded pace") : ("as fast as possible"));
+
+	free(path);
+
+	return (true);
+}
+
+void usbReplayClose(usbState state) {
+	if (state->replay == NULL) {
+		return;
+	}
+
+	mtx_destroy(&state->replay->controlsLock);
+
+	usbReplayFree(state->replay);
+	state->replay = NULL;
+}
+
+bool usbReplayControl(usbState state, uint8_t bRequest, uint16_t wValue, uint16_t wIndex, uint8_t *data,
+	size_t dataSize, void (*controlOutCallback)(void *controlOutCallbackPtr, int status),
+	void (*controlInCallback)(void *controlInCallbackPtr, int status, const uint8_t *buffer, size_t bufferSize),
+	void *controlCallbackPtr, bool directionOut) {
+	(void) (data);     // UNUSED.
+	(void) (dataSize); // UNUSED, replies have their recorded length.
+
+	// There is no device to send to, so all requests succeed right away.
+	if (directionOut) {
+		if (controlOutCallback != NULL) {
+			(*controlOutCallback)(controlCallbackPtr, LIBUSB_TRANSFER_COMPLETED);
+		}
+
+		return (true);
+	}
+
+	struct usb_replay *replay = state->replay;
+
+	mtx_lock(&replay->controlsLock);
+
+	// Replies are used in recorded order; once all replies to a request
+	// were used, the last one keeps being returned.
+	struct usb_replay_control *reply = NULL;
+
+	for (size_t i = 0; i < replay->controlsLength; i++) {
+		struct usb_replay_control *control = &replay->controls[i];
+
+		if ((control->bRequest == bRequest) && (control->wValue == wValue) && (control->wIndex == wIndex)) {
+			reply = control;
+
+			if (!control->used) {
+				break;
+			}
+		}
+	}
+
+	if (reply != NULL) {
+		reply->used = true;
+	}
+
+	mtx_unlock(&replay->controlsLock);
+
+	if (reply == NULL) {
+		usbCaptureLog(CAER_LOG_ERROR, state,
+			"USB replay: no recorded reply to control request 0x%02" PRIX8 " (0x%04" PRIX16 ", 0x%04" PRIX16 ").",
+			bRequest, wValue, wIndex);
+		return (false);
+	}
+
+	if (controlInCallback != NULL) {
+		(*controlInCallback)(controlCallbackPtr, LIBUSB_TRANSFER_COMPLETED, reply->data, reply->dataSize);
+	}
+
+	return (true);
+}
+
+bool usbReplayStart(usbState state) {
+	struct usb_replay *replay = state->replay;
+
+	if (fseek(replay->file, replay->dataOffset, SEEK_SET) != 0) {
+		usbCaptureLog(CAER_LOG_CRITICAL, state, "Failed to rewind USB replay file.");
+		return (false);
+	}
+
+	atomic_store(&replay->threadRun, true);
+
+	if ((errno = thrd_create(&replay->thread, &usbReplayThreadRun, state)) != thrd_success) {
+		usbCaptureLog(CAER_LOG_CRITICAL, state, "Failed to create USB replay thread. Error: %d.", errno);
+		return (false);
+	}
+
+	replay->threadActive = true;
+
+	return (true);
+}
+
+void usbReplayStop(usbState state) {
+	struct usb_replay *replay = state->replay;
+
+	if (!replay->threadActive) {
+		return;
+	}
+
+	atomic_store(&replay->threadRun, false);
+
+	if ((errno = thrd_join(replay->thread, NULL)) != thrd_success) {
+		// This should never happen!
+		usbCaptureLog(CAER_LOG_CRITICAL, state, "Failed to join USB replay thread. Error: %d.", errno);
+	}
+
+	replay->threadActive = false;
+}
+
+// Sleep until the recorded arrival time is reached. Returns false on shutdown.
+// Idle time is handled as with a real device, see usbDataIdle().
+static bool usbReplayWait(usbState state, const struct timespec *startTime, uint64_t timestamp) {
+	struct usb_replay *replay = state->replay;
+
+	while (atomic_load_explicit(&replay->threadRun, memory_order_relaxed)) {
+		struct timespec now;
+		portable_clock_gettime_monotonic(&now);
+
+		int64_t elapsed = (I64T(now.tv_sec - startTime->tv_sec) * 1000000000LL)
+						+ I64T(now.tv_nsec - startTime->tv_nsec);
+		int64_t remaining = I64T(timestamp) - elapsed;
+
+		if (remaining <= 0) {
+			return (true);
+		}
+
+		if (remaining > USB_REPLAY_SLEEP_SLICE) {
+			remaining = USB_REPLAY_SLEEP_SLICE;
+		}
+
+		uint32_t idleInterval = usbGetDataIdleInterval(state);
+		if ((idleInterval > 0) && (remaining > (I64T(idleInterval) * 1000))) {
+			remaining = I64T(idleInterval) * 1000;
+		}
+
+		struct timespec sleepTime = {.tv_sec = 0, .tv_nsec = (long) remaining};
+		thrd_sleep(&sleepTime, NULL);
+
+		usbDataIdle(state);
+	}
+
+	return (false);
+}
+
+// This thread replaces the USB thread for data: it feeds all recorded data
+// transfers, in order, to the data callback, from data transfers start until
+// stop, or until the end of the recording, which is handled like a device
+// disconnect (exceptional shutdown).
+static int usbReplayThreadRun(void *usbStatePtr) {
+	usbState state            = usbStatePtr;
+	struct usb_replay *replay = state->replay;
+
+	// Set thread name.
+	thrd_set_name(state->usbThreadName);
+
+	usbCaptureLog(CAER_LOG_DEBUG, state, "USB replay thread running.");
+
+	struct timespec startTime;
+	portable_clock_gettime_monotonic(&startTime);
+
+	int64_t firstTimestamp = -1;
+	bool endReached        = true;
+
+	struct usb_capture_record record;
+
+	while (fread(&record, sizeof(struct usb_capture_record), 1, replay->file) == 1) {
+		if (!atomic_load_explicit(&replay->threadRun, memory_order_relaxed)) {
+			endReached = false;
+			break;
+		}
+
+		if (record.type != USB_CAPTURE_DATA) {
+			if (fseek(replay->file, (long) record.length, SEEK_CUR) != 0) {
+				break;
+			}
+
+			continue;
+		}
+
+		if (record.length > replay->bufferSize) {
+			uint8_t *buffer = realloc(replay->buffer, record.length);
+			if (buffer == NULL) {
+				usbCaptureLog(CAER_LOG_CRITICAL, state, "Failed to allocate USB replay buffer.");
+				break;
+			}
+
+			replay->buffer     = buffer;
+			replay->bufferSize = record.length;
+		}
+
+		if ((record.length > 0) && (fread(replay->buffer, record.length, 1, replay->file) != 1)) {
+			break;
+		}
+
+		// Keep the recorded spacing between transfers, relative to the first one.
+		if (replay->realTime) {
+			if (firstTimestamp < 0) {
+				firstTimestamp = I64T(record.timestamp);
+			}
+
+			if (!usbReplayWait(state, &startTime, record.timestamp - U64T(firstTimestamp))) {
+				endReached = false;
+				break;
+			}
+		}
+
+		if (record.length > 0) {
+			(*state->usbDataCallback)(state->usbDataCallbackPtr, replay->buffer, record.length);
+		}
+	}
+
+	if (endReached) {
+		usbCaptureLog(CAER_LOG_INFO, state, "USB replay reached end of recording.");
+
+		// Same as the last data transfer going away on disconnect.
+		atomic_store(&state->dataTransfersRun, TRANS_STOPPED);
+
+		if (state->usbShutdownCallback != NULL) {
+			state->usbShutdownCallback(state->usbShutdownCallbackPtr);
+		}
+	}
+
+	usbCaptureLog(CAER_LOG_DEBUG, state, "USB replay thread shut down.");
+
+	return (EXIT_SUCCESS);
+}
+
+bool caerDeviceUSBCaptureSet(const char *filePath) {
+	call_once(&usbCaptureInitFlag, &usbCaptureInit);
+
+	char *path = usbCaptureStringCopy(filePath);
+	if ((filePath != NULL) && !caerStrEquals(filePath, "") && (path == NULL)) {
+		return (false);
+	}
+
+	mtx_lock(&usbCaptureSettingsLock);
+
+	free(usbCapturePath);
+	usbCapturePath     = path;
+	usbCaptureSettings = true;
+
+	mtx_unlock(&usbCaptureSettingsLock);
+
+	return (true);
+}
+
+bool caerDeviceUSBReplaySet(const char *filePath, bool realTime) {
+	call_once(&usbCaptureInitFlag, &usbCaptureInit);
+
+	char *path = usbCaptureStringCopy(filePath);
+	if ((filePath != NULL) && !caerStrEquals(filePath, "") && (path == NULL)) {
+		return (false);
+	}
+
+	mtx_lock(&usbCaptureSettingsLock);
+
+	free(usbReplayPath);
+	usbReplayPath      = path;
+	usbReplayRealTime  = realTime;
+	usbCaptureSettings = true;
+
+	mtx_unlock(&usbCaptureSettingsLock);
+
+	return (true);
+}
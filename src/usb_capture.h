@@ -0,0 +1,66 @@
+#ifndef LIBCAER_SRC_USB_CAPTURE_H_
+#define LIBCAER_SRC_USB_CAPTURE_H_
+
+#include "usb_utils.h"
+
+/**
+ * Raw USB capture and replay.
+ *
+ * A capture file starts with USB_CAPTURE_MAGIC, followed by records, each a
+ * 'struct usb_capture_record' header plus 'length' bytes of payload:
+ * - USB_CAPTURE_INFO: 'struct usb_capture_info', the opened device.
+ * - USB_CAPTURE_CONTROL_IN: reply to a vendor control IN request.
+ * - USB_CAPTURE_DATA: one bulk data transfer, with its arrival time.
+ * All values are in host byte order.
+ *
+ * Replay answers control IN requests from the recorded replies, accepts all
+ * control OUT requests, and feeds the data transfers to the device's data
+ * callback from its own thread, so that device open, configuration, data
+ * translation and container generation all run as with real hardware.
+ */
+
+#define USB_CAPTURE_MAGIC        "CAERUSB1"
+#define USB_CAPTURE_MAGIC_LENGTH 8
+
+enum { USB_CAPTURE_INFO = 0, USB_CAPTURE_CONTROL_IN = 1, USB_CAPTURE_DATA = 2 };
+
+struct usb_capture_record {
+	uint64_t timestamp; // Nanoseconds since capture start, only for DATA.
+	uint32_t length;
+	uint16_t wValue;
+	uint16_t wIndex;
+	uint8_t type;
+	uint8_t bRequest;
+	uint16_t reserved1;
+	uint32_t reserved2;
+};
+
+struct usb_capture_info {
+	uint16_t devVID;
+	uint16_t devPID;
+	int16_t firmwareVersion;
+	int16_t logicVersion;
+	uint8_t busNumber;
+	uint8_t devAddress;
+	char serialNumber[MAX_SERIAL_NUMBER_LENGTH + 1];
+};
+
+// Capture, enabled by caerDeviceUSBCaptureSet() or the CAER_USB_CAPTURE environment variable.
+void usbCaptureOpen(usbState state, uint16_t devVID, uint16_t devPID, const struct usb_info *deviceUSBInfo);
+void usbCaptureClose(usbState state);
+void usbCaptureControlIn(
+	usbState state, uint8_t bRequest, uint16_t wValue, uint16_t wIndex, const uint8_t *data, size_t dataSize);
+void usbCaptureData(usbState state, const uint8_t *data, size_t dataSize);
+
+// Replay, enabled by caerDeviceUSBReplaySet() or the CAER_USB_REPLAY environment variable.
+bool usbReplayEnabled(void);
+bool usbReplayOpen(usbState state, uint16_t devVID, uint16_t devPID, struct usb_info *deviceUSBInfo);
+void usbReplayClose(usbState state);
+bool usbReplayStart(usbState state);
+void usbReplayStop(usbState state);
+bool usbReplayControl(usbState state, uint8_t bRequest, uint16_t wValue, uint16_t wIndex, uint8_t *data,
+	size_t dataSize, void (*controlOutCallback)(void *controlOutCallbackPtr, int status),
+	void (*controlInCallback)(void *controlInCallbackPtr, int status, const uint8_t *buffer, size_t bufferSize),
+	void *controlCallbackPtr, bool directionOut);
+
+#endif /* LIBCAER_SRC_USB_CAPTURE_H_ */
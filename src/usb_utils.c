@@ -1,11 +1,31 @@
+#if defined(OS_LINUX) && !defined(_GNU_SOURCE)
+// Needed for sched_setaffinity() and the CPU_* macros.
+#	define _GNU_SOURCE 1
+#endif
+
 #include "usb_utils.h"
 
+#include "portable_time.h"
+#include "usb_capture.h"
+
+#include <stddef.h>
+
+#if defined(OS_LINUX)
+#	include <sched.h>
+#	include <unistd.h>
+#endif
+
 struct usb_control_struct {
 	union {
 		void (*controlOutCallback)(void *controlOutCallbackPtr, int status);
 		void (*controlInCallback)(void *controlInCallbackPtr, int status, const uint8_t *buffer, size_t bufferSize);
 	};
 	void *controlCallbackPtr;
+	// Request details, only needed to capture control IN replies.
+	usbState state;
+	uint8_t bRequest;
+	uint16_t wValue;
+	uint16_t wIndex;
 };
 
 typedef struct usb_control_struct *usbControl;
@@ -18,11 +38,68 @@ struct usb_data_completion_struct {
 
 typedef struct usb_data_completion_struct *usbDataCompletion;
 
+// Data buffer passed between USB thread and translator thread.
+// The libusb transfer only ever sees the 'data' member.
+struct usb_data_buffer {
+	size_t dataSize;
+	uint8_t data[];
+};
+
+typedef struct usb_data_buffer *usbDataBuffer;
+
+// Process-wide libusb context and event handling thread, shared by
+// several devices. Created on first use, destroyed with its last device.
+struct usb_shared_context {
+	libusb_context *context;
+	uint32_t devices; // SHARED LOCK PROTECTED.
+	char threadName[MAX_THREAD_NAME_LENGTH + 1];
+	thrd_t thread;
+	atomic_bool threadRun;
+	size_t index;
+};
+
+static once_flag usbSharedInitFlag = ONCE_FLAG_INIT;
+static mtx_t usbSharedLock;
+static struct usb_shared_context usbSharedContexts[CAER_USB_SHARED_THREADS_MAX];
+static atomic_uint_fast8_t usbSharedThreadsNumber = ATOMIC_VAR_INIT(0);
+static atomic_int_fast32_t usbSharedThreadsCPU[CAER_USB_SHARED_THREADS_MAX]
+	= {ATOMIC_VAR_INIT(-1), ATOMIC_VAR_INIT(-1), ATOMIC_VAR_INIT(-1), ATOMIC_VAR_INIT(-1), ATOMIC_VAR_INIT(-1),
+		ATOMIC_VAR_INIT(-1), ATOMIC_VAR_INIT(-1), ATOMIC_VAR_INIT(-1)};
+
+// Maximum time the translator thread sleeps while waiting for data (10 ms).
+#define USB_TRANSLATOR_WAIT_SLICE 10000000L
+
+// Autotuning: evaluation window (100 ms), fill ratio thresholds (percent),
+// number of consecutive idle windows before lowering, shortest interval
+// between completions before larger transfers are preferred over more
+// transfers (250 µs), and limits relative to the configured values.
+#define USB_AUTOTUNE_WINDOW       100000000LL
+#define USB_AUTOTUNE_FILL_HIGH    90
+#define USB_AUTOTUNE_FILL_LOW     25
+#define USB_AUTOTUNE_IDLE_WINDOWS 10
+#define USB_AUTOTUNE_MIN_INTERVAL 250000LL
+#define USB_AUTOTUNE_SCALE        4
+#define USB_AUTOTUNE_MIN_SIZE     512
+
 static void caerUSBLog(enum caer_log_level logLevel, usbState state, const char *format, ...) ATTRIBUTE_FORMAT(3);
 static int usbThreadRun(void *usbStatePtr);
+static bool usbContextAcquire(usbState state);
+static void usbContextRelease(usbState state);
+static int usbSharedThreadRun(void *usbSharedContextPtr);
 static bool usbAllocateTransfers(usbState state);
+static struct libusb_transfer *usbAllocateTransfer(usbState state, size_t index, uint32_t bufferSize);
 static void usbCancelAndDeallocateTransfers(usbState state);
 static void LIBUSB_CALL usbDataTransferCallback(struct libusb_transfer *transfer);
+static void LIBUSB_CALL usbDataTransferTranslatorCallback(struct libusb_transfer *transfer);
+static void usbDataTransferEnd(usbState state, struct libusb_transfer *transfer);
+static bool usbDataTransferIsRetiring(usbState state, struct libusb_transfer *transfer);
+static bool usbDataTransferRetire(usbState state, struct libusb_transfer *transfer);
+static void usbAutotuneUpdate(usbState state, int length, int actualLength);
+static uint8_t *usbAllocateZeroCopyBuffer(usbState state, uint32_t bufferSize);
+static void usbFreeTransfer(struct libusb_transfer *transfer);
+static bool usbTranslatorStart(usbState state);
+static void usbTranslatorStop(usbState state);
+static int usbTranslatorThreadRun(void *usbStatePtr);
 static bool usbControlTransferAsync(usbState state, uint8_t bRequest, uint16_t wValue, uint16_t wIndex, uint8_t *data,
 	size_t dataSize, void (*controlOutCallback)(void *controlOutCallbackPtr, int status),
 	void (*controlInCallback)(void *controlInCallbackPtr, int status, const uint8_t *buffer, size_t bufferSize),
@@ -311,23 +388,28 @@ bool usbDeviceOpen(usbState state, uint16_t devVID, uint16_t devPID, uint8_t bus
 	// Ensure no content.
 	memset(deviceUSBInfo, 0, sizeof(struct usb_info));
 
-	// Search for device and open it.
-	// Initialize libusb using a separate context for each device.
-	// This is to correctly support one thread per device.
-	// libusb may create its own threads at this stage, so we temporarily set
-	// a different thread name.
-	char originalThreadName[MAX_THREAD_NAME_LENGTH + 1]; // +1 for terminating NUL character.
-	thrd_get_name(originalThreadName, MAX_THREAD_NAME_LENGTH);
-	originalThreadName[MAX_THREAD_NAME_LENGTH] = '\0';
+	// Replay a capture file instead of opening real hardware, if requested.
+	// The file must have been captured from a device with the same VID/PID.
+	if (usbReplayEnabled()) {
+		if (!usbReplayOpen(state, devVID, devPID, deviceUSBInfo)) {
+			return (false);
+		}
 
-	thrd_set_name(state->usbThreadName);
+		if (mtx_init(&state->dataTransfersLock, mtx_plain) != thrd_success) {
+			usbReplayClose(state);
 
-	int res = libusb_init(&state->deviceContext);
+			caerUSBLog(CAER_LOG_CRITICAL, state, "Failed to initialize USB transfer mutex.");
+			errno = CAER_ERROR_RESOURCE_ALLOCATION;
+			return (false);
+		}
 
-	thrd_set_name(originalThreadName);
+		return (true);
+	}
 
-	if (res != LIBUSB_SUCCESS) {
-		caerUSBLog(CAER_LOG_CRITICAL, state, "Failed to initialize libusb context. Error: %d.", res);
+	// Search for device and open it.
+	// Initialize libusb using a separate context for each device, or
+	// a shared one if enabled by caerDeviceUSBSharedThreadsSet().
+	if (!usbContextAcquire(state)) {
 		errno = CAER_ERROR_RESOURCE_ALLOCATION;
 		return (false);
 	}
@@ -674,13 +756,16 @@ bool usbDeviceOpen(usbState state, uint16_t devVID, uint16_t devPID, uint8_t bus
 	// Found and configured it!
 	if (devHandle != NULL) {
 		state->deviceHandle = devHandle;
-		errno               = 0; // Ensure reset on success.
+
+		// Start raw capture to file, if requested.
+		usbCaptureOpen(state, devVID, devPID, deviceUSBInfo);
+
+		errno = 0; // Ensure reset on success.
 		return (true);
 	}
 
 	// Didn't find anything.
-	libusb_exit(state->deviceContext);
-	state->deviceContext = NULL;
+	usbContextRelease(state);
 
 	// Filter errno due to libusb setting it to other values even if everything
 	// above returns no errors (like EAGAIN(11)). All errnos we want to set
@@ -699,14 +784,236 @@ bool usbDeviceOpen(usbState state, uint16_t devVID, uint16_t devPID, uint8_t bus
 }
 
 void usbDeviceClose(usbState state) {
+	// Data transfers may have gone away due to exceptional shutdown, without
+	// being stopped afterwards, so the translator thread could still exist.
+	usbTranslatorStop(state);
+
 	mtx_destroy(&state->dataTransfersLock);
 
+	if (usbReplayActive(state)) {
+		usbReplayClose(state);
+		return;
+	}
+
+	usbCaptureClose(state);
+
 	// Release interface 0 (default).
 	libusb_release_interface(state->deviceHandle, 0);
 
 	libusb_close(state->deviceHandle);
 
-	libusb_exit(state->deviceContext);
+	usbContextRelease(state);
+}
+
+static void usbSharedInit(void) {
+	mtx_init(&usbSharedLock, mtx_plain);
+}
+
+// Get a libusb context for the device: a new one, which will be served by the
+// device's own USB thread, or a shared one, served by its shared thread.
+static bool usbContextAcquire(usbState state) {
+	// libusb may create its own threads at this stage, so we temporarily set
+	// a different thread name.
+	char originalThreadName[MAX_THREAD_NAME_LENGTH + 1]; // +1 for terminating NUL character.
+	thrd_get_name(originalThreadName, MAX_THREAD_NAME_LENGTH);
+	originalThreadName[MAX_THREAD_NAME_LENGTH] = '\0';
+
+	uint8_t sharedThreads = U8T(atomic_load(&usbSharedThreadsNumber));
+
+	if (sharedThreads == 0) {
+		thrd_set_name(state->usbThreadName);
+
+		int res = libusb_init(&state->deviceContext);
+
+		thrd_set_name(originalThreadName);
+
+		if (res != LIBUSB_SUCCESS) {
+			caerUSBLog(CAER_LOG_CRITICAL, state, "Failed to initialize libusb context. Error: %d.", res);
+			return (false);
+		}
+
+		state->sharedContext = NULL;
+		return (true);
+	}
+
+	call_once(&usbSharedInitFlag, &usbSharedInit);
+
+	mtx_lock(&usbSharedLock);
+
+	// Assign to the shared context serving the fewest devices.
+	struct usb_shared_context *shared = &usbSharedContexts[0];
+
+	for (size_t i = 1; i < sharedThreads; i++) {
+		if (usbSharedContexts[i].devices < shared->devices) {
+			shared = &usbSharedContexts[i];
+		}
+	}
+
+	if (shared->devices == 0) {
+		shared->index = (size_t) (shared - usbSharedContexts);
+		snprintf(shared->threadName, MAX_THREAD_NAME_LENGTH + 1, "USBShared%zu", shared->index);
+
+		thrd_set_name(shared->threadName);
+
+		int res = libusb_init(&shared->context);
+
+		thrd_set_name(originalThreadName);
+
+		if (res != LIBUSB_SUCCESS) {
+			mtx_unlock(&usbSharedLock);
+
+			caerUSBLog(CAER_LOG_CRITICAL, state, "Failed to initialize shared libusb context. Error: %d.", res);
+			return (false);
+		}
+
+		atomic_store(&shared->threadRun, true);
+
+		if ((errno = thrd_create(&shared->thread, &usbSharedThreadRun, shared)) != thrd_success) {
+			libusb_exit(shared->context);
+			shared->context = NULL;
+
+			mtx_unlock(&usbSharedLock);
+
+			caerUSBLog(CAER_LOG_CRITICAL, state, "Failed to create shared USB thread. Error: %d.", errno);
+			return (false);
+		}
+	}
+
+	shared->devices++;
+
+	mtx_unlock(&usbSharedLock);
+
+	caerUSBLog(CAER_LOG_DEBUG, state, "Using shared USB thread %zu.", shared->index);
+
+	state->deviceContext = shared->context;
+	state->sharedContext = shared;
+
+	return (true);
+}
+
+static void usbContextRelease(usbState state) {
+	if (state->sharedContext == NULL) {
+		libusb_exit(state->deviceContext);
+		state->deviceContext = NULL;
+		return;
+	}
+
+	struct usb_shared_context *shared = state->sharedContext;
+
+	mtx_lock(&usbSharedLock);
+
+	shared->devices--;
+
+	// Last device gone, shut down shared thread and context.
+	if (shared->devices == 0) {
+		atomic_store(&shared->threadRun, false);
+
+		if ((errno = thrd_join(shared->thread, NULL)) != thrd_success) {
+			// This should never happen!
+			caerUSBLog(CAER_LOG_CRITICAL, state, "Failed to join shared USB thread. Error: %d.", errno);
+		}
+
+		libusb_exit(shared->context);
+		shared->context = NULL;
+	}
+
+	mtx_unlock(&usbSharedLock);
+
+	state->deviceContext = NULL;
+	state->sharedContext = NULL;
+}
+
+// Returns false if the platform doesn't support it.
+static bool usbSharedThreadSetAffinity(int32_t cpuCore) {
+#if defined(OS_LINUX)
+	cpu_set_t cpuSet;
+	CPU_ZERO(&cpuSet);
+
+	if (cpuCore >= 0) {
+		CPU_SET((size_t) cpuCore, &cpuSet);
+	}
+	else {
+		long cpuCores = sysconf(_SC_NPROCESSORS_CONF);
+
+		for (long i = 0; (i < cpuCores) && (i < CPU_SETSIZE); i++) {
+			CPU_SET((size_t) i, &cpuSet);
+		}
+	}
+
+	// Zero means the calling thread.
+	return (sched_setaffinity(0, sizeof(cpuSet), &cpuSet) == 0);
+#else
+	(void) (cpuCore); // UNUSED.
+
+	return (false);
+#endif
+}
+
+// Same as usbThreadRun(), but for a shared context, so it runs from when the
+// first device using it opens, to when the last one closes.
+static int usbSharedThreadRun(void *usbSharedContextPtr) {
+	struct usb_shared_context *shared = usbSharedContextPtr;
+
+	// Set thread name.
+	thrd_set_name(shared->threadName);
+
+	caerLog(CAER_LOG_DEBUG, shared->threadName, "Shared USB thread running.");
+
+	// Handle USB events (10 millisecond timeout).
+	struct timeval te = {.tv_sec = 0, .tv_usec = 10000};
+
+	// Default affinity, nothing to do until a CPU core is requested.
+	int32_t currentCPU = -1;
+
+	while (atomic_load_explicit(&shared->threadRun, memory_order_relaxed)) {
+		int32_t wantedCPU = I32T(atomic_load_explicit(&usbSharedThreadsCPU[shared->index], memory_order_relaxed));
+
+		if (wantedCPU != currentCPU) {
+			if (!usbSharedThreadSetAffinity(wantedCPU)) {
+				caerLog(CAER_LOG_ERROR, shared->threadName, "Failed to set CPU affinity to %" PRIi32 ".", wantedCPU);
+			}
+
+			currentCPU = wantedCPU;
+		}
+
+		libusb_handle_events_timeout(shared->context, &te);
+	}
+
+	caerLog(CAER_LOG_DEBUG, shared->threadName, "Shared USB thread shut down.");
+
+	return (EXIT_SUCCESS);
+}
+
+bool caerDeviceUSBSharedThreadsSet(uint8_t threadsNumber) {
+	if (threadsNumber > CAER_USB_SHARED_THREADS_MAX) {
+		return (false);
+	}
+
+	atomic_store(&usbSharedThreadsNumber, threadsNumber);
+
+	return (true);
+}
+
+uint8_t caerDeviceUSBSharedThreadsGet(void) {
+	return (U8T(atomic_load(&usbSharedThreadsNumber)));
+}
+
+bool caerDeviceUSBSharedThreadsAffinitySet(uint8_t threadIndex, int32_t cpuCore) {
+#if defined(OS_LINUX)
+	if ((threadIndex >= CAER_USB_SHARED_THREADS_MAX) || (cpuCore < -1) || (cpuCore >= CPU_SETSIZE)) {
+		return (false);
+	}
+
+	// Picked up by the shared thread itself, see usbSharedThreadRun().
+	atomic_store(&usbSharedThreadsCPU[threadIndex], cpuCore);
+
+	return (true);
+#else
+	(void) (threadIndex); // UNUSED.
+	(void) (cpuCore);     // UNUSED.
+
+	return (false);
+#endif
 }
 
 void usbSetLogLevel(usbState state, enum caer_log_level level) {
@@ -780,12 +1087,20 @@ void usbSetTransfersNumber(usbState state, uint32_t transfersNumber) {
 	atomic_store(&state->usbBufferNumber, transfersNumber);
 
 	// Cancel transfers, wait for them to terminate, deallocate, and
-	// then reallocate with new size/number.
-	if (usbDataTransfersAreRunning(state)) {
+	// then reallocate with new size/number. Replay has no transfers.
+	if (usbDataTransfersAreRunning(state) && !usbReplayActive(state)) {
 		usbCancelAndDeallocateTransfers(state);
 
+		// The translator buffers depend on transfer number and size too.
+		bool translatorThread = state->translatorThreadActive;
+		usbTranslatorStop(state);
+
 		// Check again, for exceptional shutdown may have set this to false.
 		if (usbDataTransfersAreRunning(state)) {
+			if (translatorThread) {
+				usbTranslatorStart(state);
+			}
+
 			usbAllocateTransfers(state);
 		}
 	}
@@ -805,12 +1120,20 @@ void usbSetTransfersSize(usbState state, uint32_t transfersSize) {
 	atomic_store(&state->usbBufferSize, transfersSize);
 
 	// Cancel transfers, wait for them to terminate, deallocate, and
-	// then reallocate with new size/number.
-	if (usbDataTransfersAreRunning(state)) {
+	// then reallocate with new size/number. Replay has no transfers.
+	if (usbDataTransfersAreRunning(state) && !usbReplayActive(state)) {
 		usbCancelAndDeallocateTransfers(state);
 
+		// The translator buffers depend on transfer number and size too.
+		bool translatorThread = state->translatorThreadActive;
+		usbTranslatorStop(state);
+
 		// Check again, for exceptional shutdown may have set this to false.
 		if (usbDataTransfersAreRunning(state)) {
+			if (translatorThread) {
+				usbTranslatorStart(state);
+			}
+
 			usbAllocateTransfers(state);
 		}
 	}
@@ -844,6 +1167,12 @@ char *usbGenerateDeviceString(struct usb_info usbInfo, const char *deviceName, u
 }
 
 bool usbThreadStart(usbState state) {
+	// Shared contexts are already served by their shared thread.
+	// Replay has no USB events to handle.
+	if ((state->sharedContext != NULL) || usbReplayActive(state)) {
+		return (true);
+	}
+
 	// Start USB thread.
 	if ((errno = thrd_create(&state->usbThread, &usbThreadRun, state)) != thrd_success) {
 		caerUSBLog(CAER_LOG_CRITICAL, state, "Failed to create USB thread. Error: %d.", errno);
@@ -859,6 +1188,10 @@ bool usbThreadStart(usbState state) {
 }
 
 void usbThreadStop(usbState state) {
+	if ((state->sharedContext != NULL) || usbReplayActive(state)) {
+		return;
+	}
+
 	// Shut down USB thread.
 	atomic_store(&state->usbThreadRun, false);
 
@@ -884,11 +1217,21 @@ static int usbThreadRun(void *usbStatePtr) {
 
 	caerUSBLog(CAER_LOG_DEBUG, state, "USB thread running.");
 
-	// Handle USB events (10 millisecond timeout).
-	struct timeval te = {.tv_sec = 0, .tv_usec = 10000};
-
 	while (atomic_load_explicit(&state->usbThreadRun, memory_order_relaxed)) {
+		// Handle USB events (10 millisecond timeout, or less to respect the idle interval).
+		uint32_t idleInterval = usbGetDataIdleInterval(state);
+		struct timeval te     = {.tv_sec = 0, .tv_usec = 10000};
+
+		if ((idleInterval > 0) && (idleInterval < 10000)) {
+			te.tv_usec = (suseconds_t) idleInterval;
+		}
+
 		libusb_handle_events_timeout(state->deviceContext, &te);
+
+		// Data is translated right here, unless the translator thread (or replay) does it.
+		if (!state->translatorThreadActive && !usbReplayActive(state)) {
+			usbDataIdle(state);
+		}
 	}
 
 	caerUSBLog(CAER_LOG_DEBUG, state, "USB thread shut down.");
@@ -898,10 +1241,36 @@ static int usbThreadRun(void *usbStatePtr) {
 
 bool usbDataTransfersStart(usbState state) {
 	mtx_lock(&state->dataTransfersLock);
+
+	// Replay feeds recorded data directly to the data callback, from its own
+	// thread, so neither transfers nor the translator thread are needed.
+	if (usbReplayActive(state)) {
+		atomic_store(&state->dataTransfersRun, TRANS_RUNNING);
+
+		bool retVal = usbReplayStart(state);
+		if (!retVal) {
+			atomic_store(&state->dataTransfersRun, TRANS_STOPPED);
+		}
+
+		mtx_unlock(&state->dataTransfersLock);
+
+		return (retVal);
+	}
+
+	// Translator thread must be up before the first transfer completes.
+	if (usbGetTranslatorThread(state) && !usbTranslatorStart(state)) {
+		mtx_unlock(&state->dataTransfersLock);
+		return (false);
+	}
+
 	bool retVal = usbAllocateTransfers(state);
 	if (retVal) {
 		atomic_store(&state->dataTransfersRun, TRANS_RUNNING);
 	}
+	else {
+		usbTranslatorStop(state);
+	}
+
 	mtx_unlock(&state->dataTransfersLock);
 
 	return (retVal);
@@ -910,7 +1279,15 @@ bool usbDataTransfersStart(usbState state) {
 void usbDataTransfersStop(usbState state) {
 	mtx_lock(&state->dataTransfersLock);
 	atomic_store(&state->dataTransfersRun, TRANS_STOPPED);
-	usbCancelAndDeallocateTransfers(state);
+
+	if (usbReplayActive(state)) {
+		usbReplayStop(state);
+	}
+	else {
+		usbCancelAndDeallocateTransfers(state);
+		usbTranslatorStop(state);
+	}
+
 	mtx_unlock(&state->dataTransfersLock);
 }
 
@@ -928,49 +1305,20 @@ static bool usbAllocateTransfers(usbState state) {
 	}
 	state->dataTransfersLength = bufferNum;
 
+	// Autotuning always starts from the configured values.
+	state->autotuneTransfersNumber     = bufferNum;
+	state->autotuneTransfersSize       = bufferSize;
+	state->autotuneBytes               = 0;
+	state->autotuneCapacity            = 0;
+	state->autotuneCompletions         = 0;
+	state->autotuneIdleWindows         = 0;
+	state->dataTransfersRetiring       = 0;
+	state->dataTransfersRetiringActive = 0;
+	portable_clock_gettime_monotonic(&state->autotuneWindowStart);
+
 	// Allocate transfers and set them up.
 	for (size_t i = 0; i < bufferNum; i++) {
-		state->dataTransfers[i] = libusb_alloc_transfer(0);
-		if (state->dataTransfers[i] == NULL) {
-			caerUSBLog(CAER_LOG_CRITICAL, state, "Unable to allocate further libusb transfers (%zu of %" PRIu32 ").", i,
-				bufferNum);
-			continue;
-		}
-
-		// Create data buffer.
-		state->dataTransfers[i]->length = (int) bufferSize;
-		state->dataTransfers[i]->buffer = malloc(bufferSize);
-		if (state->dataTransfers[i]->buffer == NULL) {
-			caerUSBLog(
-				CAER_LOG_CRITICAL, state, "Unable to allocate buffer for libusb transfer %zu. Error: %d.", i, errno);
-
-			libusb_free_transfer(state->dataTransfers[i]);
-			state->dataTransfers[i] = NULL;
-
-			continue;
-		}
-
-		// Initialize Transfer.
-		state->dataTransfers[i]->dev_handle = state->deviceHandle;
-		state->dataTransfers[i]->endpoint   = state->dataEndPoint;
-		state->dataTransfers[i]->type       = LIBUSB_TRANSFER_TYPE_BULK;
-		state->dataTransfers[i]->callback   = &usbDataTransferCallback;
-		state->dataTransfers[i]->user_data  = state;
-		state->dataTransfers[i]->timeout    = 0;
-		state->dataTransfers[i]->flags      = LIBUSB_TRANSFER_FREE_BUFFER;
-
-		if ((errno = libusb_submit_transfer(state->dataTransfers[i])) == LIBUSB_SUCCESS) {
-			atomic_fetch_add(&state->activeDataTransfers, 1);
-		}
-		else {
-			caerUSBLog(CAER_LOG_CRITICAL, state, "Unable to submit libusb transfer %zu. Error: %s (%d).", i,
-				libusb_strerror(errno), errno);
-
-			// The transfer buffer is freed automatically here thanks to
-			// the LIBUSB_TRANSFER_FREE_BUFFER flag set above.
-			libusb_free_transfer(state->dataTransfers[i]);
-			state->dataTransfers[i] = NULL;
-		}
+		state->dataTransfers[i] = usbAllocateTransfer(state, i, bufferSize);
 	}
 
 	if (atomic_load(&state->activeDataTransfers) == 0) {
@@ -986,6 +1334,73 @@ static bool usbAllocateTransfers(usbState state) {
 	return (true);
 }
 
+// Allocate, set up and submit a single data transfer. Returns NULL on failure.
+static struct libusb_transfer *usbAllocateTransfer(usbState state, size_t index, uint32_t bufferSize) {
+	struct libusb_transfer *transfer = libusb_alloc_transfer(0);
+	if (transfer == NULL) {
+		caerUSBLog(CAER_LOG_CRITICAL, state, "Unable to allocate libusb transfer %zu.", index);
+		return (NULL);
+	}
+
+	// Create data buffer. With the translator thread, buffers come from its pool
+	// and are swapped on every completion, so libusb must not free them.
+	transfer->length = (int) bufferSize;
+
+	if (state->translatorThreadActive) {
+		usbDataBuffer buffer = caerRingBufferGet(state->translatorPool);
+
+		transfer->buffer   = (buffer != NULL) ? (buffer->data) : (NULL);
+		transfer->callback = &usbDataTransferTranslatorCallback;
+		transfer->flags    = 0;
+	}
+	else {
+		transfer->callback = &usbDataTransferCallback;
+
+		// Device memory buffers must be freed with libusb_dev_mem_free(), so
+		// libusb must not free them. usbFreeTransfer() relies on this flag.
+		uint8_t *zeroCopyBuffer = NULL;
+		if (usbGetZeroCopy(state)) {
+			zeroCopyBuffer = usbAllocateZeroCopyBuffer(state, bufferSize);
+		}
+
+		if (zeroCopyBuffer != NULL) {
+			transfer->buffer = zeroCopyBuffer;
+			transfer->flags  = 0;
+		}
+		else {
+			transfer->buffer = malloc(bufferSize);
+			transfer->flags  = LIBUSB_TRANSFER_FREE_BUFFER;
+		}
+	}
+
+	if (transfer->buffer == NULL) {
+		caerUSBLog(
+			CAER_LOG_CRITICAL, state, "Unable to allocate buffer for libusb transfer %zu. Error: %d.", index, errno);
+
+		libusb_free_transfer(transfer);
+		return (NULL);
+	}
+
+	// Initialize Transfer.
+	transfer->dev_handle = state->deviceHandle;
+	transfer->endpoint   = state->dataEndPoint;
+	transfer->type       = LIBUSB_TRANSFER_TYPE_BULK;
+	transfer->user_data  = state;
+	transfer->timeout    = 0;
+
+	if ((errno = libusb_submit_transfer(transfer)) != LIBUSB_SUCCESS) {
+		caerUSBLog(CAER_LOG_CRITICAL, state, "Unable to submit libusb transfer %zu. Error: %s (%d).", index,
+			libusb_strerror(errno), errno);
+
+		usbFreeTransfer(transfer);
+		return (NULL);
+	}
+
+	atomic_fetch_add(&state->activeDataTransfers, 1);
+
+	return (transfer);
+}
+
 // MUST LOCK ON 'dataTransfersLock'.
 static void usbCancelAndDeallocateTransfers(usbState state) {
 	// Wait for all transfers to go away.
@@ -1012,7 +1427,7 @@ static void usbCancelAndDeallocateTransfers(usbState state) {
 	// No more transfers in flight, deallocate them all here.
 	for (size_t i = 0; i < state->dataTransfersLength; i++) {
 		if (state->dataTransfers[i] != NULL) {
-			libusb_free_transfer(state->dataTransfers[i]);
+			usbFreeTransfer(state->dataTransfers[i]);
 			state->dataTransfers[i] = NULL;
 		}
 	}
@@ -1021,6 +1436,9 @@ static void usbCancelAndDeallocateTransfers(usbState state) {
 	free(state->dataTransfers);
 	state->dataTransfers       = NULL;
 	state->dataTransfersLength = 0;
+
+	state->dataTransfersRetiring       = 0;
+	state->dataTransfersRetiringActive = 0;
 }
 
 static void LIBUSB_CALL usbDataTransferCallback(struct libusb_transfer *transfer) {
@@ -1030,6 +1448,10 @@ static void LIBUSB_CALL usbDataTransferCallback(struct libusb_transfer *transfer
 	// if they do have data attached, try to parse them.
 	if (((transfer->status == LIBUSB_TRANSFER_COMPLETED) || (transfer->status == LIBUSB_TRANSFER_CANCELLED))
 		&& (transfer->actual_length > 0)) {
+		if (state->capture != NULL) {
+			usbCaptureData(state, transfer->buffer, (size_t) transfer->actual_length);
+		}
+
 		// Handle data.
 		(*state->usbDataCallback)(state->usbDataCallbackPtr, transfer->buffer, (size_t) transfer->actual_length);
 	}
@@ -1039,12 +1461,351 @@ static void LIBUSB_CALL usbDataTransferCallback(struct libusb_transfer *transfer
 	// are not recoverable, as all of them appear on different OSes when a
 	// device is physically unplugged for example.
 	if (transfer->status == LIBUSB_TRANSFER_COMPLETED) {
+		// Transfers replaced by autotuning are not submitted again.
+		if ((state->dataTransfersRetiring > 0) && usbDataTransferRetire(state, transfer)) {
+			return;
+		}
+
+		int length       = transfer->length;
+		int actualLength = transfer->actual_length;
+
 		// Submit transfer again.
 		if (libusb_submit_transfer(transfer) == LIBUSB_SUCCESS) {
+			if (atomic_load_explicit(&state->autotuneEnabled, memory_order_relaxed)) {
+				usbAutotuneUpdate(state, length, actualLength);
+			}
+
 			return;
 		}
 	}
 
+	usbDataTransferEnd(state, transfer);
+}
+
+static bool usbDataTransferIsRetiring(usbState state, struct libusb_transfer *transfer) {
+	for (size_t i = 0; i < state->dataTransfersRetiring; i++) {
+		if (state->dataTransfers[i] == transfer) {
+			return (true);
+		}
+	}
+
+	return (false);
+}
+
+// Retire a completed transfer if autotuning replaced it. The transfer stays
+// in 'dataTransfers' and is freed later, either by the next autotuning step
+// or by usbCancelAndDeallocateTransfers(), under lock.
+static bool usbDataTransferRetire(usbState state, struct libusb_transfer *transfer) {
+	if (!usbDataTransferIsRetiring(state, transfer)) {
+		return (false);
+	}
+
+	// Never leave the endpoint without transfers in flight: if all the
+	// new ones already went away, the replaced ones are the only ones
+	// left, so the autotuning step is abandoned and they all stay.
+	if (atomic_load(&state->activeDataTransfers) == 1) {
+		state->dataTransfersRetiring       = 0;
+		state->dataTransfersRetiringActive = 0;
+		return (false);
+	}
+
+	state->dataTransfersRetiringActive--;
+	atomic_fetch_sub(&state->activeDataTransfers, 1);
+
+	return (true);
+}
+
+// Replace the current data transfers with 'transfersNumber' new ones of size
+// 'transfersSize'. The new transfers are submitted first, behind the current
+// ones on the same endpoint, so data order is kept and the endpoint always has
+// transfers in flight; the current ones then retire as they complete.
+// MUST LOCK ON 'dataTransfersLock' and be called from the USB thread.
+static void usbAutotuneApply(usbState state, uint32_t transfersNumber, uint32_t transfersSize) {
+	uint32_t retiring = state->dataTransfersRetiring;
+	uint32_t current  = state->dataTransfersLength - retiring;
+
+	struct libusb_transfer **transfers = calloc(current + transfersNumber, sizeof(struct libusb_transfer *));
+	if (transfers == NULL) {
+		caerUSBLog(CAER_LOG_ERROR, state, "Autotune: failed to allocate memory for %" PRIu32 " libusb transfers.",
+			current + transfersNumber);
+		return;
+	}
+
+	// Previously retired transfers are all done by now.
+	for (size_t i = 0; i < retiring; i++) {
+		if (state->dataTransfers[i] != NULL) {
+			usbFreeTransfer(state->dataTransfers[i]);
+		}
+	}
+
+	for (size_t i = 0; i < current; i++) {
+		transfers[i] = state->dataTransfers[retiring + i];
+	}
+
+	// Only transfers still in flight will complete and retire. No retiring
+	// ones are left at this point, so those are all the current ones; any
+	// others in the array already ended on an error.
+	uint32_t currentActive = U32T(atomic_load(&state->activeDataTransfers));
+
+	uint32_t submitted = 0;
+	for (size_t i = 0; i < transfersNumber; i++) {
+		transfers[current + i] = usbAllocateTransfer(state, current + i, transfersSize);
+
+		if (transfers[current + i] != NULL) {
+			submitted++;
+		}
+	}
+
+	free(state->dataTransfers);
+	state->dataTransfers       = transfers;
+	state->dataTransfersLength = current + transfersNumber;
+
+	// If no new transfer could be submitted, simply keep the current ones going.
+	if (submitted == 0) {
+		state->dataTransfersRetiring       = 0;
+		state->dataTransfersRetiringActive = 0;
+		return;
+	}
+
+	state->dataTransfersRetiring       = current;
+	state->dataTransfersRetiringActive = currentActive;
+
+	state->autotuneTransfersNumber = transfersNumber;
+	state->autotuneTransfersSize   = transfersSize;
+
+	caerUSBLog(CAER_LOG_DEBUG, state, "Autotune: now using %" PRIu32 " transfers of %" PRIu32 " bytes.", submitted,
+		transfersSize);
+}
+
+// Track how full completed transfers are, and how often they complete, and at
+// the end of every window decide if number or size of transfers should change.
+static void usbAutotuneUpdate(usbState state, int length, int actualLength) {
+	state->autotuneBytes += (uint64_t) actualLength;
+	state->autotuneCapacity += (uint64_t) length;
+	state->autotuneCompletions++;
+
+	struct timespec now;
+	portable_clock_gettime_monotonic(&now);
+
+	int64_t windowTime = (I64T(now.tv_sec - state->autotuneWindowStart.tv_sec) * 1000000000LL)
+					   + I64T(now.tv_nsec - state->autotuneWindowStart.tv_nsec);
+	if (windowTime < USB_AUTOTUNE_WINDOW) {
+		return;
+	}
+
+	uint64_t fill         = (state->autotuneBytes * 100) / state->autotuneCapacity;
+	int64_t interval      = windowTime / state->autotuneCompletions;
+	uint32_t configNumber = usbGetTransfersNumber(state);
+	uint32_t configSize   = usbGetTransfersSize(state);
+	uint32_t newNumber    = state->autotuneTransfersNumber;
+	uint32_t newSize      = state->autotuneTransfersSize;
+
+	state->autotuneWindowStart = now;
+	state->autotuneBytes       = 0;
+	state->autotuneCapacity    = 0;
+	state->autotuneCompletions = 0;
+
+	if (fill >= USB_AUTOTUNE_FILL_HIGH) {
+		// Burst: transfers arrive full. If they also complete very often, prefer
+		// larger transfers to cut per-transfer overhead, else more transfers.
+		state->autotuneIdleWindows = 0;
+
+		bool sizeCanGrow   = (newSize < (configSize * USB_AUTOTUNE_SCALE));
+		bool numberCanGrow = (newNumber < (configNumber * USB_AUTOTUNE_SCALE));
+
+		if (sizeCanGrow && ((interval < USB_AUTOTUNE_MIN_INTERVAL) || (!numberCanGrow))) {
+			newSize *= 2;
+		}
+		else if (numberCanGrow) {
+			newNumber *= 2;
+		}
+	}
+	else if (fill <= USB_AUTOTUNE_FILL_LOW) {
+		// Idle: lower size first, as that reduces latency, then number.
+		state->autotuneIdleWindows++;
+
+		if (state->autotuneIdleWindows < USB_AUTOTUNE_IDLE_WINDOWS) {
+			return;
+		}
+
+		state->autotuneIdleWindows = 0;
+
+		uint32_t minSize = configSize / USB_AUTOTUNE_SCALE;
+		if (minSize < USB_AUTOTUNE_MIN_SIZE) {
+			minSize = USB_AUTOTUNE_MIN_SIZE;
+		}
+
+		if (newSize > minSize) {
+			newSize /= 2;
+		}
+		else if (newNumber > configNumber) {
+			newNumber /= 2;
+		}
+	}
+	else {
+		state->autotuneIdleWindows = 0;
+	}
+
+	if ((newNumber == state->autotuneTransfersNumber) && (newSize == state->autotuneTransfersSize)) {
+		return;
+	}
+
+	// Wait for the previous step to complete. Autotuning is not possible with the
+	// translator thread, whose buffers have a fixed size, or after failures.
+	if ((state->dataTransfersRetiringActive > 0) || (state->failedDataTransfers > 0)) {
+		return;
+	}
+
+	// Never block the USB thread: buffer number/size changes hold this lock while
+	// waiting on transfers to be cancelled, which needs the USB thread to run.
+	if (mtx_trylock(&state->dataTransfersLock) != thrd_success) {
+		return;
+	}
+
+	if (usbDataTransfersAreRunning(state) && (!state->translatorThreadActive)) {
+		usbAutotuneApply(state, newNumber, newSize);
+	}
+
+	mtx_unlock(&state->dataTransfersLock);
+}
+
+static inline usbDataBuffer usbDataBufferFromData(uint8_t *data) {
+	return ((usbDataBuffer) (void *) (data - offsetof(struct usb_data_buffer, data)));
+}
+
+// Take a free buffer from the translator pool. If there is none, all buffers
+// are waiting to be translated, and the USB thread must never wait for the
+// translator thread to catch up: the caller parks the transfer instead.
+static uint8_t *usbTranslatorGetFreeBuffer(usbState state) {
+	usbDataBuffer buffer = caerRingBufferGet(state->translatorPool);
+
+	if (buffer == NULL) {
+		return (NULL);
+	}
+
+	if (state->translatorOverrun) {
+		state->translatorOverrun = false;
+
+		caerUSBLog(CAER_LOG_INFO, state, "Translator thread caught up, %" PRIu64 " transfers parked so far.",
+			state->translatorOverruns);
+	}
+
+	return (buffer->data);
+}
+
+static void usbTranslatorQueueBuffer(usbState state, usbDataBuffer buffer) {
+	// Never fails: the queue can hold all existing buffers at once.
+	caerRingBufferPut(state->translatorQueue, buffer);
+
+	// Wake up the translator thread if it's waiting for data. The fence
+	// pairs with the one in usbTranslatorWait(), so that either the
+	// translator thread sees the new buffer, or we see it waiting.
+	atomic_thread_fence(memory_order_seq_cst);
+
+	if (atomic_load_explicit(&state->translatorWaiting, memory_order_relaxed)) {
+		mtx_lock(&state->translatorLock);
+		cnd_signal(&state->translatorCond);
+		mtx_unlock(&state->translatorLock);
+	}
+}
+
+static void LIBUSB_CALL usbDataTransferTranslatorCallback(struct libusb_transfer *transfer) {
+	usbState state = transfer->user_data;
+
+	usbDataBuffer fullBuffer = NULL;
+
+	// Completed or cancelled transfers with data attached get their buffer
+	// detached here, to be queued for the translator thread.
+	if (((transfer->status == LIBUSB_TRANSFER_COMPLETED) || (transfer->status == LIBUSB_TRANSFER_CANCELLED))
+		&& (transfer->actual_length > 0)) {
+		if (state->capture != NULL) {
+			usbCaptureData(state, transfer->buffer, (size_t) transfer->actual_length);
+		}
+
+		fullBuffer           = usbDataBufferFromData(transfer->buffer);
+		fullBuffer->dataSize = (size_t) transfer->actual_length;
+
+		transfer->buffer = NULL;
+	}
+
+	// Same as usbDataTransferCallback(), but the transfer is resubmitted first,
+	// with a fresh buffer, and only then the received data is queued. Transfers
+	// all complete in this thread, so the queue order is the order of arrival.
+	if (transfer->status == LIBUSB_TRANSFER_COMPLETED) {
+		if (transfer->buffer == NULL) {
+			transfer->buffer = usbTranslatorGetFreeBuffer(state);
+
+			if (transfer->buffer == NULL) {
+				// Translator thread overrun: park the transfer, the translator thread
+				// resubmits it with the next buffer it is done with. The device has to
+				// wait meanwhile, but no data is lost and the USB thread never blocks.
+				// Parked before queueing, so that the translator thread sees it
+				// by the time it has translated the buffer queued right after.
+				caerRingBufferPut(state->translatorParked, transfer);
+				usbTranslatorQueueBuffer(state, fullBuffer);
+
+				state->translatorOverruns++;
+
+				if (!state->translatorOverrun) {
+					state->translatorOverrun = true;
+
+					caerUSBLog(
+						CAER_LOG_INFO, state, "Translator thread overrun, parking transfers until it catches up.");
+				}
+
+				return;
+			}
+		}
+
+		if (libusb_submit_transfer(transfer) == LIBUSB_SUCCESS) {
+			if (fullBuffer != NULL) {
+				usbTranslatorQueueBuffer(state, fullBuffer);
+			}
+
+			return;
+		}
+	}
+
+	if (fullBuffer != NULL) {
+		usbTranslatorQueueBuffer(state, fullBuffer);
+	}
+
+	// Parked transfers can also end in the translator thread.
+	mtx_lock(&state->translatorLock);
+	usbDataTransferEnd(state, transfer);
+	mtx_unlock(&state->translatorLock);
+}
+
+// Give a buffer the translator thread is done with to a parked transfer and
+// resubmit it, or end the transfer if data transfers are being stopped.
+// Returns false if there was no parked transfer to take the buffer.
+static bool usbTranslatorResubmitParked(usbState state, usbDataBuffer buffer) {
+	struct libusb_transfer *transfer = caerRingBufferGet(state->translatorParked);
+	if (transfer == NULL) {
+		return (false);
+	}
+
+	transfer->buffer = buffer->data;
+
+	if (usbDataTransfersAreRunning(state)) {
+		if (libusb_submit_transfer(transfer) == LIBUSB_SUCCESS) {
+			return (true);
+		}
+	}
+	else {
+		// Stopping: ends like any other transfer cancelled by the user.
+		transfer->status = LIBUSB_TRANSFER_CANCELLED;
+	}
+
+	// Ended transfers keep their buffer, it is freed with the transfer.
+	mtx_lock(&state->translatorLock);
+	usbDataTransferEnd(state, transfer);
+	mtx_unlock(&state->translatorLock);
+
+	return (true);
+}
+
+static void usbDataTransferEnd(usbState state, struct libusb_transfer *transfer) {
 	// Cannot recover (cancelled, no device, or other critical error).
 	// Signal this by adjusting the counters and exiting.
 	// Freeing the transfers is taken care of by usbCancelAndDeallocateTransfers().
@@ -1066,6 +1827,11 @@ static void LIBUSB_CALL usbDataTransferCallback(struct libusb_transfer *transfer
 		state->failedDataTransfers++;
 	}
 
+	// A transfer being retired by autotuning is done, whichever way it ended.
+	if ((state->dataTransfersRetiring > 0) && usbDataTransferIsRetiring(state, transfer)) {
+		state->dataTransfersRetiringActive--;
+	}
+
 	// Transfers are handled sequentially always in the same thread, so these
 	// reads here are correct.
 	if ((atomic_load(&state->activeDataTransfers) == 1) && (state->failedDataTransfers > 0)) {
@@ -1093,6 +1859,266 @@ static void LIBUSB_CALL usbDataTransferCallback(struct libusb_transfer *transfer
 	}
 }
 
+// Returns NULL if device memory is not supported or exhausted, the caller
+// falls back to normal memory then.
+static uint8_t *usbAllocateZeroCopyBuffer(usbState state, uint32_t bufferSize) {
+#if LIBUSB_API_VERSION >= 0x01000105
+	uint8_t *buffer = libusb_dev_mem_alloc(state->deviceHandle, bufferSize);
+	if (buffer == NULL) {
+		caerUSBLog(CAER_LOG_DEBUG, state, "Unable to allocate device memory for libusb transfer, using normal memory.");
+	}
+
+	return (buffer);
+#else
+	(void) (bufferSize); // UNUSED.
+
+	caerUSBLog(CAER_LOG_DEBUG, state, "Device memory not supported by libusb, using normal memory.");
+
+	return (NULL);
+#endif
+}
+
+static void usbFreeTransfer(struct libusb_transfer *transfer) {
+	// Translator thread buffers are not freed by libusb, and may
+	// already have been detached and queued for translation.
+	if ((transfer->callback == &usbDataTransferTranslatorCallback) && (transfer->buffer != NULL)) {
+		free(usbDataBufferFromData(transfer->buffer));
+	}
+
+#if LIBUSB_API_VERSION >= 0x01000105
+	// Device memory buffers, see usbAllocateTransfers().
+	if ((transfer->callback == &usbDataTransferCallback) && ((transfer->flags & LIBUSB_TRANSFER_FREE_BUFFER) == 0)
+		&& (transfer->buffer != NULL)) {
+		libusb_dev_mem_free(transfer->dev_handle, transfer->buffer, (size_t) transfer->length);
+	}
+#endif
+
+	libusb_free_transfer(transfer);
+}
+
+static void usbTranslatorFreeBuffers(usbState state) {
+	if (state->translatorPool != NULL) {
+		usbDataBuffer buffer;
+		while ((buffer = caerRingBufferGet(state->translatorPool)) != NULL) {
+			free(buffer);
+		}
+
+		caerRingBufferFree(state->translatorPool);
+		state->translatorPool = NULL;
+	}
+
+	if (state->translatorQueue != NULL) {
+		caerRingBufferFree(state->translatorQueue);
+		state->translatorQueue = NULL;
+	}
+
+	if (state->translatorParked != NULL) {
+		caerRingBufferFree(state->translatorParked);
+		state->translatorParked = NULL;
+	}
+}
+
+// MUST LOCK ON 'dataTransfersLock'.
+static bool usbTranslatorStart(usbState state) {
+	uint32_t bufferNum  = usbGetTransfersNumber(state);
+	uint32_t bufferSize = usbGetTransfersSize(state);
+
+	// One buffer for each transfer in flight, and as many again
+	// that can wait for translation before USB handling has to wait.
+	size_t buffersNumber = 2 * (size_t) bufferNum;
+
+	// Ring-buffers need a power of two size.
+	size_t ringSize = 1;
+	while (ringSize < buffersNumber) {
+		ringSize <<= 1;
+	}
+
+	state->translatorQueue  = caerRingBufferInit(ringSize);
+	state->translatorPool   = caerRingBufferInit(ringSize);
+	state->translatorParked = caerRingBufferInit(ringSize);
+	if ((state->translatorQueue == NULL) || (state->translatorPool == NULL) || (state->translatorParked == NULL)) {
+		caerUSBLog(CAER_LOG_CRITICAL, state, "Failed to allocate translator thread ring-buffers.");
+		usbTranslatorFreeBuffers(state);
+		return (false);
+	}
+
+	for (size_t i = 0; i < buffersNumber; i++) {
+		usbDataBuffer buffer = malloc(sizeof(struct usb_data_buffer) + bufferSize);
+		if (buffer == NULL) {
+			caerUSBLog(
+				CAER_LOG_CRITICAL, state, "Failed to allocate translator thread buffer %zu. Error: %d.", i, errno);
+			usbTranslatorFreeBuffers(state);
+			return (false);
+		}
+
+		caerRingBufferPut(state->translatorPool, buffer);
+	}
+
+	if (mtx_init(&state->translatorLock, mtx_plain) != thrd_success) {
+		caerUSBLog(CAER_LOG_CRITICAL, state, "Failed to initialize translator thread mutex.");
+		usbTranslatorFreeBuffers(state);
+		return (false);
+	}
+
+#if defined(HAVE_PTHREADS)
+	if (cnd_init_monotonic(&state->translatorCond) != thrd_success) {
+#else
+	if (cnd_init(&state->translatorCond) != thrd_success) {
+#endif
+		caerUSBLog(CAER_LOG_CRITICAL, state, "Failed to initialize translator thread condition.");
+		mtx_destroy(&state->translatorLock);
+		usbTranslatorFreeBuffers(state);
+		return (false);
+	}
+
+	// Thread name is the USB thread one, with a ' T' suffix that always fits.
+	size_t nameLength = strlen(state->usbThreadName);
+	if (nameLength > (MAX_THREAD_NAME_LENGTH - 2)) {
+		nameLength = MAX_THREAD_NAME_LENGTH - 2;
+	}
+
+	memcpy(state->translatorThreadName, state->usbThreadName, nameLength);
+	memcpy(state->translatorThreadName + nameLength, " T", 3);
+
+	atomic_store(&state->translatorWaiting, false);
+	atomic_store(&state->translatorThreadRun, true);
+
+	state->translatorOverruns = 0;
+	state->translatorOverrun  = false;
+
+	if ((errno = thrd_create(&state->translatorThread, &usbTranslatorThreadRun, state)) != thrd_success) {
+		caerUSBLog(CAER_LOG_CRITICAL, state, "Failed to create translator thread. Error: %d.", errno);
+		cnd_destroy(&state->translatorCond);
+		mtx_destroy(&state->translatorLock);
+		usbTranslatorFreeBuffers(state);
+		return (false);
+	}
+
+	state->translatorThreadActive = true;
+
+	return (true);
+}
+
+// MUST LOCK ON 'dataTransfersLock', or be the only user left (device close).
+// All transfers must already be deallocated, so that all buffers are back.
+static void usbTranslatorStop(usbState state) {
+	if (!state->translatorThreadActive) {
+		return;
+	}
+
+	// Shut down translator thread. It translates any queued data before exiting.
+	atomic_store(&state->translatorThreadRun, false);
+
+	mtx_lock(&state->translatorLock);
+	cnd_signal(&state->translatorCond);
+	mtx_unlock(&state->translatorLock);
+
+	if ((errno = thrd_join(state->translatorThread, NULL)) != thrd_success) {
+		// This should never happen!
+		caerUSBLog(CAER_LOG_CRITICAL, state, "Failed to join translator thread. Error: %d.", errno);
+	}
+
+	cnd_destroy(&state->translatorCond);
+	mtx_destroy(&state->translatorLock);
+
+	// Free all buffers, they're all back in the pool at this point.
+	usbTranslatorFreeBuffers(state);
+
+	state->translatorThreadActive = false;
+}
+
+static void usbTranslatorWait(usbState state) {
+	// Wake up often enough to respect the idle interval too.
+	struct timespec waitSlice = {.tv_sec = 0, .tv_nsec = USB_TRANSLATOR_WAIT_SLICE};
+	uint32_t idleInterval     = usbGetDataIdleInterval(state);
+
+	if ((idleInterval > 0) && ((I64T(idleInterval) * 1000) < waitSlice.tv_nsec)) {
+		waitSlice.tv_nsec = (long) idleInterval * 1000;
+	}
+
+#if !defined(HAVE_PTHREADS)
+	// C11 only has wall-clock timeouts, a clock change affects this one wait.
+	struct timespec waitEnd;
+	portable_clock_gettime_realtime(&waitEnd);
+
+	waitEnd.tv_nsec += waitSlice.tv_nsec;
+
+	if (waitEnd.tv_nsec >= 1000000000) {
+		waitEnd.tv_sec++;
+		waitEnd.tv_nsec -= 1000000000;
+	}
+#endif
+
+	atomic_store(&state->translatorWaiting, true);
+	atomic_thread_fence(memory_order_seq_cst);
+
+	mtx_lock(&state->translatorLock);
+
+	// Check again while holding the lock: a buffer queued before we
+	// announced we're waiting would not wake us up anymore.
+	if (caerRingBufferEmpty(state->translatorQueue) && atomic_load(&state->translatorThreadRun)) {
+#if defined(HAVE_PTHREADS)
+		cnd_timedwait_relative(&state->translatorCond, &state->translatorLock, &waitSlice);
+#else
+		cnd_timedwait(&state->translatorCond, &state->translatorLock, &waitEnd);
+#endif
+	}
+
+	mtx_unlock(&state->translatorLock);
+
+	atomic_store(&state->translatorWaiting, false);
+}
+
+// This thread decodes all data received by the USB thread, in order,
+// from data transfers start to data transfers stop.
+static int usbTranslatorThreadRun(void *usbStatePtr) {
+	usbState state = usbStatePtr;
+
+	caerUSBLog(CAER_LOG_DEBUG, state, "Starting translator thread ...");
+
+	// Set thread name.
+	thrd_set_name(state->translatorThreadName);
+
+	while (true) {
+		usbDataBuffer buffer = caerRingBufferGet(state->translatorQueue);
+
+		if (buffer == NULL) {
+			if (atomic_load(&state->translatorThreadRun)) {
+				// Nothing to translate: a chance to commit pending data on time.
+				usbDataIdle(state);
+
+				usbTranslatorWait(state);
+				continue;
+			}
+
+			// Shutting down, check one last time for data queued before
+			// run was set to false, and exit once everything is translated.
+			buffer = caerRingBufferGet(state->translatorQueue);
+			if (buffer == NULL) {
+				break;
+			}
+		}
+
+		// Handle data. Translators may issue asynchronous control transfers
+		// (spiConfigSendAsync()/spiConfigReceiveAsync()) from here, which is
+		// safe off the USB thread: libusb_submit_transfer() may be called from
+		// any thread, and the completion callbacks still run on the USB thread,
+		// where they only update device info fields with fences around them,
+		// same as the ones also read concurrently by user threads.
+		(*state->usbDataCallback)(state->usbDataCallbackPtr, buffer->data, buffer->dataSize);
+
+		// Parked transfers get the buffer first, they're holding up the device.
+		if (!usbTranslatorResubmitParked(state, buffer)) {
+			// Never fails: the pool can hold all existing buffers at once.
+			caerRingBufferPut(state->translatorPool, buffer);
+		}
+	}
+
+	caerUSBLog(CAER_LOG_DEBUG, state, "Translator thread shut down.");
+
+	return (EXIT_SUCCESS);
+}
+
 static bool usbControlTransferAsync(usbState state, uint8_t bRequest, uint16_t wValue, uint16_t wIndex, uint8_t *data,
 	size_t dataSize, void (*controlOutCallback)(void *controlOutCallbackPtr, int status),
 	void (*controlInCallback)(void *controlInCallbackPtr, int status, const uint8_t *buffer, size_t bufferSize),
@@ -1107,6 +2133,12 @@ static bool usbControlTransferAsync(usbState state, uint8_t bRequest, uint16_t w
 		return (false);
 	}
 
+	// Replay answers control requests from the capture file.
+	if (usbReplayActive(state)) {
+		return (usbReplayControl(state, bRequest, wValue, wIndex, data, dataSize, controlOutCallback,
+			controlInCallback, controlCallbackPtr, directionOut));
+	}
+
 	struct libusb_transfer *controlTransfer = libusb_alloc_transfer(0);
 	if (controlTransfer == NULL) {
 		return (false);
@@ -1135,6 +2167,10 @@ static bool usbControlTransferAsync(usbState state, uint8_t bRequest, uint16_t w
 		extraControlData->controlInCallback = controlInCallback;
 	}
 	extraControlData->controlCallbackPtr = controlCallbackPtr;
+	extraControlData->state              = state;
+	extraControlData->bRequest           = bRequest;
+	extraControlData->wValue             = wValue;
+	extraControlData->wIndex             = wIndex;
 
 	// Initialize Transfer.
 	uint8_t direction = (directionOut) ? (LIBUSB_ENDPOINT_OUT) : (LIBUSB_ENDPOINT_IN);
@@ -1191,6 +2227,12 @@ static void LIBUSB_CALL usbControlOutCallback(struct libusb_transfer *transfer)
 
 static void LIBUSB_CALL usbControlInCallback(struct libusb_transfer *transfer) {
 	usbControl extraControlData = transfer->user_data;
+	usbState state              = extraControlData->state;
+
+	if ((state->capture != NULL) && (transfer->status == LIBUSB_TRANSFER_COMPLETED)) {
+		usbCaptureControlIn(state, extraControlData->bRequest, extraControlData->wValue, extraControlData->wIndex,
+			libusb_control_transfer_get_data(transfer), (size_t) transfer->actual_length);
+	}
 
 	if (extraControlData->controlInCallback != NULL) {
 		(*extraControlData->controlInCallback)(extraControlData->controlCallbackPtr, (int) transfer->status,
@@ -1287,5 +2329,9 @@ static void syncControlInCallback(void *controlInCallbackPtr, int status, const
 }
 
 bool usbControlResetDataEndpoint(usbState state, uint8_t endpoint) {
+	if (usbReplayActive(state)) {
+		return (true);
+	}
+
 	return (libusb_clear_halt(state->deviceHandle, endpoint) == LIBUSB_SUCCESS);
 }
@@ -4,6 +4,7 @@
 #include "libcaer/libcaer.h"
 
 #include "libcaer/devices/usb.h"
+#include "libcaer/ringbuffer.h"
 
 #include <libusb.h>
 #include <stdatomic.h>
@@ -23,12 +24,20 @@
 
 enum { TRANS_STOPPED = 0, TRANS_RUNNING = 1 };
 
+struct usb_shared_context;
+struct usb_capture;
+struct usb_replay;
+
 struct usb_state {
 	// Per-device log-level (USB functions)
 	atomic_uint_fast8_t usbLogLevel;
 	// USB Device State
 	libusb_context *deviceContext;
+	struct usb_shared_context *sharedContext; // NULL if the device has its own context and thread.
 	libusb_device_handle *deviceHandle;
+	// Raw USB capture to file, and replay from file instead of a device.
+	struct usb_capture *capture; // NULL if not capturing.
+	struct usb_replay *replay;   // NULL if a real device is open.
 	// USB thread state
 	char usbThreadName[MAX_THREAD_NAME_LENGTH + 1]; // +1 for terminating NUL character.
 	thrd_t usbThread;
@@ -36,6 +45,7 @@ struct usb_state {
 	// USB Data Transfers
 	atomic_uint_fast32_t usbBufferNumber;
 	atomic_uint_fast32_t usbBufferSize;
+	atomic_bool usbZeroCopy; // Takes effect on next data transfers start.
 	uint8_t dataEndPoint;
 	atomic_uint_fast32_t dataTransfersRun;
 	mtx_t dataTransfersLock;
@@ -43,9 +53,38 @@ struct usb_state {
 	uint32_t dataTransfersLength;           // LOCK PROTECTED.
 	atomic_uint_fast32_t activeDataTransfers;
 	uint32_t failedDataTransfers;
+	// USB Data Transfers autotuning. Only accessed by the USB thread, or with the lock
+	// held before submitting any data transfer.
+	atomic_bool autotuneEnabled;
+	uint32_t autotuneTransfersNumber;
+	uint32_t autotuneTransfersSize;
+	struct timespec autotuneWindowStart;
+	uint64_t autotuneBytes;
+	uint64_t autotuneCapacity;
+	uint32_t autotuneCompletions;
+	uint32_t autotuneIdleWindows;
+	uint32_t dataTransfersRetiring;       // Leading 'dataTransfers' entries being retired.
+	uint32_t dataTransfersRetiringActive; // How many of those are still in flight.
+	// Optional translator thread, decodes data outside of the USB thread.
+	atomic_bool translatorThreadEnabled; // Takes effect on next data transfers start.
+	bool translatorThreadActive;         // LOCK PROTECTED.
+	char translatorThreadName[MAX_THREAD_NAME_LENGTH + 1];
+	thrd_t translatorThread;
+	atomic_bool translatorThreadRun;
+	caerRingBuffer translatorQueue;  // Full buffers, USB thread to translator thread.
+	caerRingBuffer translatorPool;   // Free buffers, translator thread to USB thread.
+	caerRingBuffer translatorParked; // Transfers waiting for a free buffer, USB thread to translator thread.
+	mtx_t translatorLock; // Also serializes transfer ends between USB and translator threads.
+	cnd_t translatorCond;
+	atomic_bool translatorWaiting;
+	uint64_t translatorOverruns; // USB thread only. Transfers parked while no free buffer was left.
+	bool translatorOverrun;      // USB thread only. Currently parking transfers.
 	// USB Data Transfers handling callback
 	void (*usbDataCallback)(void *usbDataCallbackPtr, const uint8_t *buffer, size_t bytesSent);
 	void *usbDataCallbackPtr;
+	// If not zero, the data callback is also called without data (NULL, 0) at
+	// least this often (in µs) while idle, so it can commit pending data on time.
+	atomic_uint_fast32_t dataIdleInterval;
 	// USB Data Transfers shutdown callback
 	void (*usbShutdownCallback)(void *usbShutdownCallbackPtr);
 	void *usbShutdownCallbackPtr;
@@ -84,6 +123,38 @@ void usbSetTransfersSize(usbState state, uint32_t transfersSize);
 uint32_t usbGetTransfersNumber(usbState state);
 uint32_t usbGetTransfersSize(usbState state);
 
+static inline void usbSetTranslatorThread(usbState state, bool translatorThread) {
+	atomic_store(&state->translatorThreadEnabled, translatorThread);
+}
+
+static inline bool usbGetTranslatorThread(usbState state) {
+	return (atomic_load(&state->translatorThreadEnabled));
+}
+
+static inline void usbSetZeroCopy(usbState state, bool zeroCopy) {
+	atomic_store(&state->usbZeroCopy, zeroCopy);
+}
+
+static inline bool usbGetZeroCopy(usbState state) {
+	return (atomic_load(&state->usbZeroCopy));
+}
+
+static inline void usbSetAutotune(usbState state, bool autotune) {
+	atomic_store(&state->autotuneEnabled, autotune);
+}
+
+static inline bool usbGetAutotune(usbState state) {
+	return (atomic_load(&state->autotuneEnabled));
+}
+
+static inline void usbSetDataIdleInterval(usbState state, uint32_t idleInterval) {
+	atomic_store(&state->dataIdleInterval, idleInterval);
+}
+
+static inline uint32_t usbGetDataIdleInterval(usbState state) {
+	return (U32T(atomic_load_explicit(&state->dataIdleInterval, memory_order_relaxed)));
+}
+
 static inline bool usbConfigSet(usbState state, uint8_t paramAddr, uint32_t param) {
 	switch (paramAddr) {
 		case CAER_HOST_CONFIG_USB_BUFFER_NUMBER:
@@ -94,6 +165,18 @@ static inline bool usbConfigSet(usbState state, uint8_t paramAddr, uint32_t para
 			usbSetTransfersSize(state, param);
 			break;
 
+		case CAER_HOST_CONFIG_USB_TRANSLATOR_THREAD:
+			usbSetTranslatorThread(state, param);
+			break;
+
+		case CAER_HOST_CONFIG_USB_ZERO_COPY:
+			usbSetZeroCopy(state, param);
+			break;
+
+		case CAER_HOST_CONFIG_USB_AUTOTUNE:
+			usbSetAutotune(state, param);
+			break;
+
 		default:
 			return (false);
 			break;
@@ -112,6 +195,18 @@ static inline bool usbConfigGet(usbState state, uint8_t paramAddr, uint32_t *par
 			*param = usbGetTransfersSize(state);
 			break;
 
+		case CAER_HOST_CONFIG_USB_TRANSLATOR_THREAD:
+			*param = usbGetTranslatorThread(state);
+			break;
+
+		case CAER_HOST_CONFIG_USB_ZERO_COPY:
+			*param = usbGetZeroCopy(state);
+			break;
+
+		case CAER_HOST_CONFIG_USB_AUTOTUNE:
+			*param = usbGetAutotune(state);
+			break;
+
 		default:
 			return (false);
 			break;
@@ -122,6 +217,10 @@ static inline bool usbConfigGet(usbState state, uint8_t paramAddr, uint32_t *par
 
 char *usbGenerateDeviceString(struct usb_info usbInfo, const char *deviceName, uint16_t deviceID);
 
+static inline bool usbReplayActive(usbState state) {
+	return (state->replay != NULL);
+}
+
 bool usbThreadStart(usbState state);
 void usbThreadStop(usbState state);
 
@@ -131,6 +230,14 @@ static inline bool usbDataTransfersAreRunning(usbState state) {
 bool usbDataTransfersStart(usbState state);
 void usbDataTransfersStop(usbState state);
 
+// Call the data callback without data, see 'dataIdleInterval'. Only from the
+// thread that normally calls the data callback.
+static inline void usbDataIdle(usbState state) {
+	if ((usbGetDataIdleInterval(state) > 0) && usbDataTransfersAreRunning(state)) {
+		(*state->usbDataCallback)(state->usbDataCallbackPtr, NULL, 0);
+	}
+}
+
 bool usbControlTransferOutAsync(usbState state, uint8_t bRequest, uint16_t wValue, uint16_t wIndex, uint8_t *data,
 	size_t dataSize, void (*controlOutCallback)(void *controlOutCallbackPtr, int status), void *controlOutCallbackPtr);
 bool usbControlTransferInAsync(usbState state, uint8_t bRequest, uint16_t wValue, uint16_t wIndex, size_t dataSize,